@@ -0,0 +1,212 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+
+#include "atlas/array/ArrayView.h"
+#include "atlas/array/LocalView.h"
+#include "atlas/array/MakeView.h"
+#include "atlas/library/config.h"
+#include "atlas/runtime/Exception.h"
+
+namespace atlas {
+namespace array {
+
+//------------------------------------------------------------------------------------------------------
+
+/// @brief Tag to create a ContiguousView with make_view
+///
+/// @code{.cpp}
+///    auto view = make_view<double, 2, Contiguous>(field);
+/// @endcode
+struct Contiguous {};
+
+/// @brief Multi-dimensional access with unit stride in the innermost dimension, known at compile time
+///
+/// An ArrayView multiplies every index with a runtime stride, which prevents compilers from vectorising loops
+/// over the innermost dimension (typically levels). A ContiguousView only stores strides of the outer
+/// dimensions, which may be padded or strided. It has the same access API as ArrayView.
+///
+/// Create it with `make_view<Value,Rank,Contiguous>(array)` or `make_contiguous_view(view)`, which throw
+/// if the innermost stride is not 1. Use `is_contiguous_innermost(view)` to dispatch at runtime.
+template <typename Value, int Rank>
+class ContiguousView {
+public:
+    // -- Type definitions
+    using value_type           = Value;
+    using non_const_value_type = typename std::remove_const<Value>::type;
+    static constexpr int RANK{Rank};
+
+public:
+    // -- Constructors
+
+    template <typename ValueTp, typename = std::enable_if_t<std::is_convertible_v<ValueTp*, value_type*>>>
+    ContiguousView(const ContiguousView<ValueTp, Rank>& other):
+        data_(other.data_), size_(other.size_), shape_(other.shape_), strides_(other.strides_) {}
+
+    /// @brief Create from any view (ArrayView, LocalView, ...) with unit innermost stride
+    template <typename View, typename = std::enable_if_t<std::is_convertible_v<
+                                 decltype(std::declval<View&>().data()), value_type*>>>
+    explicit ContiguousView(View& view): data_(view.data()), size_(view.size()) {
+        static_assert(std::decay_t<View>::RANK == Rank, "Rank of view does not match");
+        if (view.stride(Rank - 1) != 1 && view.shape(Rank - 1) > 1) {
+            throw_Exception("ContiguousView requires unit stride in the innermost dimension", Here());
+        }
+        for (int j = 0; j < Rank; ++j) {
+            shape_[j]   = view.shape(j);
+            strides_[j] = view.stride(j);
+        }
+        strides_[Rank - 1] = 1;
+    }
+
+    // -- Access methods
+
+    /// @brief Multidimensional index operator: view(i,j,k,...)
+    template <typename... Idx, int Rank_ = Rank, typename = std::enable_if_t<sizeof...(Idx) == Rank_>>
+    value_type& operator()(Idx... idx) {
+        return data_[index_part<0>(idx...)];
+    }
+
+    /// @brief Multidimensional index operator: view(i,j,k,...)
+    template <typename... Idx, int Rank_ = Rank, typename = std::enable_if_t<sizeof...(Idx) == Rank_>>
+    const value_type& operator()(Idx... idx) const {
+        return data_[index_part<0>(idx...)];
+    }
+
+    /// @brief Access to data using square bracket [idx] operator @m_class{m-label m-warning} **Rank==1**.
+    template <typename Idx, int Rank_ = Rank, typename = std::enable_if_t<Rank_ == 1>>
+    value_type& operator[](Idx idx) {
+        return data_[idx];
+    }
+
+    /// @brief Access to data using square bracket [idx] operator @m_class{m-label m-warning} **Rank==1**.
+    template <typename Idx, int Rank_ = Rank, typename = std::enable_if_t<Rank_ == 1>>
+    const value_type& operator[](Idx idx) const {
+        return data_[idx];
+    }
+
+    /// @brief Return number of values in dimension **Dim** (template argument)
+    template <unsigned int Dim>
+    idx_t shape() const {
+        return shape_[Dim];
+    }
+
+    /// @brief Return stride for values in dimension **Dim** (template argument)
+    template <unsigned int Dim>
+    idx_t stride() const {
+        return strides_[Dim];
+    }
+
+    /// @brief Return number of values in dimension idx
+    template <typename Int>
+    idx_t shape(Int idx) const {
+        return shape_[idx];
+    }
+
+    /// @brief Return stride for values in dimension idx
+    template <typename Int>
+    idx_t stride(Int idx) const {
+        return strides_[idx];
+    }
+
+    const idx_t* shape() const { return shape_.data(); }
+
+    const idx_t* strides() const { return strides_.data(); }
+
+    /// @brief Return total number of values (accumulated over all dimensions)
+    size_t size() const { return size_; }
+
+    /// @brief Return the number of dimensions
+    static constexpr idx_t rank() { return Rank; }
+
+    /// @brief Access to internal data. @m_class{m-label m-danger} **dangerous**
+    value_type const* data() const { return data_; }
+
+    /// @brief Access to internal data. @m_class{m-label m-danger} **dangerous**
+    value_type* data() { return data_; }
+
+    /// @brief Return true when all values are contiguous in memory.
+    bool contiguous() const { return (size_ == size_t(shape_[0]) * size_t(strides_[0]) ? true : false); }
+
+private:
+    // -- Private methods
+
+    template <int Dim, typename Int, typename... Ints>
+    constexpr idx_t index_part(Int idx, Ints... next_idx) const {
+        return idx * strides_[Dim] + index_part<Dim + 1>(next_idx...);
+    }
+
+    template <int Dim, typename Int>
+    constexpr idx_t index_part(Int last_idx) const {
+        return last_idx;
+    }
+
+    // -- Private data
+
+    template <typename, int>
+    friend class ContiguousView;
+
+    value_type* data_;
+    size_t size_;
+    std::array<idx_t, Rank> shape_;
+    std::array<idx_t, Rank> strides_;
+};
+
+//------------------------------------------------------------------------------------------------------
+
+/// @brief Return true if the innermost dimension of the view has unit stride, so that a ContiguousView can be made
+template <typename View>
+bool is_contiguous_innermost(const View& view) {
+    constexpr int Rank = std::decay_t<View>::RANK;
+    return view.stride(Rank - 1) == 1 || view.shape(Rank - 1) <= 1;
+}
+
+template <typename Value, int Rank>
+ContiguousView<Value, Rank> make_contiguous_view(ArrayView<Value, Rank>& view) {
+    return ContiguousView<Value, Rank>(view);
+}
+
+template <typename Value, int Rank>
+ContiguousView<const Value, Rank> make_contiguous_view(const ArrayView<Value, Rank>& view) {
+    return ContiguousView<const Value, Rank>(view);
+}
+
+template <typename Value, int Rank>
+ContiguousView<Value, Rank> make_contiguous_view(LocalView<Value, Rank>& view) {
+    return ContiguousView<Value, Rank>(view);
+}
+
+template <typename Value, int Rank>
+ContiguousView<const Value, Rank> make_contiguous_view(const LocalView<Value, Rank>& view) {
+    return ContiguousView<const Value, Rank>(view);
+}
+
+template <typename Value, int Rank, typename Layout,
+          typename std::enable_if<std::is_same<Layout, Contiguous>::value, int>::type = 0>
+ContiguousView<Value, Rank> make_view(Array& array) {
+    auto view = make_view<Value, Rank>(array);
+    return ContiguousView<Value, Rank>(view);
+}
+
+template <typename Value, int Rank, typename Layout,
+          typename std::enable_if<std::is_same<Layout, Contiguous>::value, int>::type = 0>
+ContiguousView<const Value, Rank> make_view(const Array& array) {
+    auto view = make_view<Value, Rank>(array);
+    return ContiguousView<const Value, Rank>(view);
+}
+
+//------------------------------------------------------------------------------------------------------
+
+}  // namespace array
+}  // namespace atlas
@@ -14,4 +14,5 @@
 
 #include "atlas/field/Field.h"
 #include "atlas/field/FieldSet.h"
+#include "atlas/field/MultiField.h"
 #include "atlas/option.h"
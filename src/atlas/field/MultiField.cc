@@ -0,0 +1,33 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#include "atlas/field/MultiField.h"
+
+#include <memory>
+#include <string>
+
+#include "eckit/config/Parametrisation.h"
+
+#include "atlas/field/MultiFieldCreator.h"
+
+namespace atlas {
+
+namespace {
+field::MultiFieldImpl* create(const eckit::Parametrisation& config) {
+    std::string creator_factory = "IFS";
+    config.get("creator", creator_factory);
+    std::unique_ptr<field::MultiFieldCreator> creator(field::MultiFieldCreatorFactory::build(creator_factory, config));
+    return creator->create(config);
+}
+}  // namespace
+
+MultiField::MultiField(const eckit::Parametrisation& config): Handle(create(config)) {}
+
+}  // namespace atlas
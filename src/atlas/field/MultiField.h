@@ -0,0 +1,104 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "atlas/array_fwd.h"
+#include "atlas/field/Field.h"
+#include "atlas/field/FieldSet.h"
+#include "atlas/field/detail/MultiFieldImpl.h"
+#include "atlas/library/config.h"
+#include "atlas/util/Config.h"
+#include "atlas/util/ObjectHandle.h"
+
+namespace eckit {
+class Parametrisation;
+}
+namespace atlas {
+class FunctionSpace;
+}
+namespace atlas {
+namespace util {
+class Metadata;
+}
+}  // namespace atlas
+
+namespace atlas {
+
+/// @brief Multiple variables, allocated together in one contiguous array
+///
+/// Instead of allocating each variable of e.g. a model state separately, a MultiField allocates the
+/// storage for all variables at once, with a layout selected by its MultiFieldCreator ("creator" parameter):
+///   - "IFS"   (default) : [nblk][nvar][nlev][nproma], as functionspace::BlockStructuredColumns
+///   - "Array"           : [ngptot][nlev][nvar], as functionspace::StructuredColumns or NodeColumns
+///
+/// Each variable is accessible as a regular Field, which is a strided view into the shared storage.
+/// These Fields, or the FieldSet containing them, can be passed to any routine that expects a Field or FieldSet.
+/// They remain valid only as long as the MultiField is alive.
+///
+/// The whole storage is also available as one Field via combined(), with "variables" metadata set.
+/// FunctionSpaces can halo-exchange, gather or checksum this Field as a single array,
+/// so that all variables are communicated in one go:
+///
+/// @code{.cpp}
+///    MultiField multifield(Config("creator", "IFS")("ngptot", fs.size())("nproma", fs.nproma())
+///                              ("nlev", fs.levels())("fields", std::vector<std::string>{"u", "v", "t"}));
+///    multifield.set_functionspace(fs);
+///    auto t = array::make_view<double, 3>(multifield["t"]);   // [nblk][nlev][nproma]
+///    fs.haloExchange(multifield.combined());
+/// @endcode
+class MultiField : DOXYGEN_HIDE(public util::ObjectHandle<field::MultiFieldImpl>) {
+public:  // methods
+    using Handle::Handle;
+    MultiField() = default;
+
+    /// @brief Create MultiField from parametrisation, see MultiFieldCreatorIFS and MultiFieldCreatorArray
+    MultiField(const eckit::Parametrisation&);
+
+    idx_t size() const { return get()->size(); }
+    bool has(const std::string& name) const { return get()->has(name); }
+    std::vector<std::string> field_names() const { return get()->field_names(); }
+
+    const Field& field(const std::string& name) const { return get()->field(name); }
+    Field& field(const std::string& name) { return get()->field(name); }
+    const Field& field(idx_t idx) const { return get()->field(idx); }
+    Field& field(idx_t idx) { return get()->field(idx); }
+
+    const Field& operator[](const std::string& name) const { return field(name); }
+    Field& operator[](const std::string& name) { return field(name); }
+    const Field& operator[](idx_t idx) const { return field(idx); }
+    Field& operator[](idx_t idx) { return field(idx); }
+
+    const FieldSet& fieldset() const { return get()->fieldset(); }
+    FieldSet& fieldset() { return get()->fieldset(); }
+
+    operator const FieldSet&() const { return fieldset(); }
+    operator FieldSet&() { return fieldset(); }
+
+    /// @brief Field spanning the storage of all variables
+    const Field& combined() const { return get()->combined(); }
+    Field& combined() { return get()->combined(); }
+
+    const array::Array& array() const { return get()->array(); }
+    array::Array& array() { return get()->array(); }
+
+    const util::Metadata& metadata() const { return get()->metadata(); }
+    util::Metadata& metadata() { return get()->metadata(); }
+
+    /// @brief Associate combined Field and all variables with given FunctionSpace
+    void set_functionspace(const FunctionSpace& functionspace) { get()->set_functionspace(functionspace); }
+
+    size_t footprint() const { return get()->footprint(); }
+};
+
+}  // namespace atlas
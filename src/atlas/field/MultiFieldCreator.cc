@@ -0,0 +1,159 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+// file deepcode ignore CppMemoryLeak: static pointers for global registry are OK and will be cleaned up at end
+
+#include "atlas/field/MultiFieldCreator.h"
+
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "eckit/config/Parametrisation.h"
+#include "eckit/thread/AutoLock.h"
+#include "eckit/thread/Mutex.h"
+
+#include "atlas/field/MultiFieldCreatorArray.h"
+#include "atlas/field/MultiFieldCreatorIFS.h"
+#include "atlas/runtime/Exception.h"
+#include "atlas/runtime/Log.h"
+
+namespace {
+static eckit::Mutex* local_mutex                                         = nullptr;
+static std::map<std::string, atlas::field::MultiFieldCreatorFactory*>* m = nullptr;
+static pthread_once_t once                                               = PTHREAD_ONCE_INIT;
+
+static void init() {
+    local_mutex = new eckit::Mutex();
+    m           = new std::map<std::string, atlas::field::MultiFieldCreatorFactory*>();
+}
+}  // namespace
+
+namespace atlas {
+namespace field {
+
+namespace {
+
+template <typename T>
+void load_builder(const std::string& name) {
+    MultiFieldCreatorBuilder<T> tmp(name);
+}
+struct force_link {
+    force_link() {
+        load_builder<MultiFieldCreatorIFS>("tmp_IFS");
+        load_builder<MultiFieldCreatorArray>("tmp_Array");
+    }
+};
+
+}  // namespace
+
+// ------------------------------------------------------------------
+
+MultiFieldCreator::MultiFieldCreator() = default;
+
+MultiFieldCreator::~MultiFieldCreator() = default;
+
+array::DataType MultiFieldCreator::config_datatype(const eckit::Parametrisation& params) {
+    std::string datatype_str;
+    if (params.get("datatype", datatype_str)) {
+        return array::DataType(datatype_str);
+    }
+    array::DataType::kind_t kind(array::DataType::kind<double>());
+    params.get("kind", kind);
+    if (!array::DataType::kind_valid(kind)) {
+        throw_Exception("Could not create multi-field. kind parameter unrecognized", Here());
+    }
+    return array::DataType(kind);
+}
+
+std::vector<std::string> MultiFieldCreator::config_fields(const eckit::Parametrisation& params) {
+    std::vector<std::string> fields;
+    if (!params.get("fields", fields) || fields.empty()) {
+        throw_Exception("Could not find parameter 'fields' in Parametrisation", Here());
+    }
+    return fields;
+}
+
+MultiFieldCreatorFactory::MultiFieldCreatorFactory(const std::string& name): name_(name) {
+    pthread_once(&once, init);
+
+    eckit::AutoLock<eckit::Mutex> lock(local_mutex);
+
+    if (m->find(name) != m->end()) {
+        throw_Exception("MultiFieldCreatorFactory [" + name + "] already registered\n\nBacktrace:\n" + backtrace(),
+                        Here());
+    }
+    (*m)[name] = this;
+}
+
+MultiFieldCreatorFactory::~MultiFieldCreatorFactory() {
+    eckit::AutoLock<eckit::Mutex> lock(local_mutex);
+    m->erase(name_);
+}
+
+void MultiFieldCreatorFactory::list(std::ostream& out) {
+    pthread_once(&once, init);
+
+    eckit::AutoLock<eckit::Mutex> lock(local_mutex);
+
+    static force_link static_linking;
+
+    const char* sep = "";
+    for (std::map<std::string, MultiFieldCreatorFactory*>::const_iterator j = m->begin(); j != m->end(); ++j) {
+        out << sep << (*j).first;
+        sep = ", ";
+    }
+}
+
+MultiFieldCreator* MultiFieldCreatorFactory::build(const std::string& name) {
+    pthread_once(&once, init);
+
+    eckit::AutoLock<eckit::Mutex> lock(local_mutex);
+
+    static force_link static_linking;
+
+    std::map<std::string, MultiFieldCreatorFactory*>::const_iterator j = m->find(name);
+
+    if (j == m->end()) {
+        Log::error() << "No MultiFieldCreatorFactory for [" << name << "]" << '\n';
+        Log::error() << "MultiFieldCreatorFactories are:" << '\n';
+        for (j = m->begin(); j != m->end(); ++j) {
+            Log::error() << "   " << (*j).first << '\n';
+        }
+        throw_Exception(std::string("No MultiFieldCreatorFactory called ") + name);
+    }
+
+    return (*j).second->make();
+}
+
+MultiFieldCreator* MultiFieldCreatorFactory::build(const std::string& name, const eckit::Parametrisation& param) {
+    pthread_once(&once, init);
+
+    eckit::AutoLock<eckit::Mutex> lock(local_mutex);
+
+    static force_link static_linking;
+
+    std::map<std::string, MultiFieldCreatorFactory*>::const_iterator j = m->find(name);
+
+    if (j == m->end()) {
+        Log::error() << "No MultiFieldCreatorFactory for [" << name << "]" << '\n';
+        Log::error() << "MultiFieldCreatorFactories are:" << '\n';
+        for (j = m->begin(); j != m->end(); ++j) {
+            Log::error() << "   " << (*j).first << '\n';
+        }
+        throw_Exception(std::string("No MultiFieldCreatorFactory called ") + name);
+    }
+
+    return (*j).second->make(param);
+}
+
+}  // namespace field
+}  // namespace atlas
@@ -0,0 +1,109 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "atlas/array/DataType.h"
+#include "atlas/util/Object.h"
+
+namespace eckit {
+class Parametrisation;
+}
+namespace atlas {
+namespace field {
+class MultiFieldImpl;
+}
+}  // namespace atlas
+
+//------------------------------------------------------------------------------------------------------
+
+namespace atlas {
+namespace field {
+
+//------------------------------------------------------------------------------------------------------
+
+/*!
+ * \brief Base class for creating new multi-fields based on Parametrisation
+ *
+ * \details
+ *  Example to create a MultiField with variables "temperature" and "pressure",
+ *  stored as array[nblk][2][nlev][nproma] of default type double:
+ * \code{.cpp}
+ *    MultiField multifield(
+ *         Config
+ *           ("creator","IFS")                                             // IFS MultiFieldCreator
+ *           ("ngptot",ngptot)("nproma",nproma)("nlev",nlev)               // Blocking as for IFS fields
+ *           ("fields",std::vector<std::string>{"temperature","pressure"}) // Variable names
+ *         );
+ * \endcode
+ */
+class MultiFieldCreator : public util::Object {
+public:
+    MultiFieldCreator();
+
+    virtual ~MultiFieldCreator();
+
+    virtual MultiFieldImpl* create(const eckit::Parametrisation&) const = 0;
+
+protected:
+    /// @brief DataType from "datatype" or "kind" parameter, defaulting to double
+    static array::DataType config_datatype(const eckit::Parametrisation&);
+
+    /// @brief Variable names from "fields" parameter
+    static std::vector<std::string> config_fields(const eckit::Parametrisation&);
+};
+
+//------------------------------------------------------------------------------------------------------
+
+class MultiFieldCreatorFactory {
+public:
+    /*!
+   * \brief build MultiFieldCreator with factory key, and default options
+   * \return MultiFieldCreator
+   */
+    static MultiFieldCreator* build(const std::string&);
+
+    /*!
+   * \brief build MultiFieldCreator with options specified in parametrisation
+   * \return MultiFieldCreator
+   */
+    static MultiFieldCreator* build(const std::string&, const eckit::Parametrisation&);
+
+    /*!
+   * \brief list all registered multi-field creators
+   */
+    static void list(std::ostream&);
+
+private:
+    std::string name_;
+    virtual MultiFieldCreator* make()                              = 0;
+    virtual MultiFieldCreator* make(const eckit::Parametrisation&) = 0;
+
+protected:
+    MultiFieldCreatorFactory(const std::string&);
+    virtual ~MultiFieldCreatorFactory();
+};
+
+template <class T>
+class MultiFieldCreatorBuilder : public MultiFieldCreatorFactory {
+    virtual MultiFieldCreator* make() { return new T(); }
+    virtual MultiFieldCreator* make(const eckit::Parametrisation& param) { return new T(param); }
+
+public:
+    MultiFieldCreatorBuilder(const std::string& name): MultiFieldCreatorFactory(name) {}
+};
+
+//------------------------------------------------------------------------------------------------------
+
+}  // namespace field
+}  // namespace atlas
@@ -0,0 +1,77 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#include "atlas/field/MultiFieldCreatorArray.h"
+
+#include <string>
+#include <vector>
+
+#include "eckit/config/Parametrisation.h"
+
+#include "atlas/array/ArraySpec.h"
+#include "atlas/array/DataType.h"
+#include "atlas/field/detail/MultiFieldImpl.h"
+#include "atlas/runtime/Exception.h"
+#include "atlas/runtime/Log.h"
+
+namespace atlas {
+namespace field {
+
+MultiFieldImpl* MultiFieldCreatorArray::create(const eckit::Parametrisation& params) const {
+    size_t ngptot;
+    size_t nlev = 0;
+
+    if (!params.get("ngptot", ngptot)) {
+        throw_Exception("Could not find parameter 'ngptot' in Parametrisation");
+    }
+    params.get("nlev", nlev);
+
+    array::DataType datatype       = config_datatype(params);
+    std::vector<std::string> names = config_fields(params);
+    size_t nvar                    = names.size();
+
+    array::ArrayShape shape;
+    array::ArrayShape var_shape;
+    array::ArrayStrides var_strides;
+    if (nlev > 0) {
+        shape       = array::make_shape(ngptot, nlev, nvar);
+        var_shape   = array::make_shape(ngptot, nlev);
+        var_strides = array::make_strides(nlev * nvar, nvar);
+    }
+    else {
+        shape       = array::make_shape(ngptot, nvar);
+        var_shape   = array::make_shape(ngptot);
+        var_strides = array::make_strides(nvar);
+    }
+
+    std::string name;
+    params.get("name", name);
+    Log::debug() << "Creating " << datatype.str() << " multi-field: " << name << "[ngptot=" << ngptot
+                 << "][nlev=" << nlev << "][nvar=" << nvar << "]\n";
+
+    auto multifield = new MultiFieldImpl(name, datatype, array::ArraySpec(shape));
+    Field& combined = multifield->combined();
+    combined.set_variables(nvar);
+    combined.set_levels(nlev);
+    for (size_t jvar = 0; jvar < nvar; ++jvar) {
+        Field field = multifield->add(names[jvar], var_shape, var_strides, jvar);
+        field.set_levels(nlev);
+    }
+    return multifield;
+}
+
+namespace {
+static MultiFieldCreatorBuilder<MultiFieldCreatorArray> __Array("Array");
+}
+
+// ------------------------------------------------------------------
+
+}  // namespace field
+}  // namespace atlas
@@ -0,0 +1,58 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#pragma once
+
+#include "atlas/field/MultiFieldCreator.h"
+
+namespace eckit {
+class Parametrisation;
+}
+namespace atlas {
+namespace field {
+class MultiFieldImpl;
+}
+}  // namespace atlas
+
+namespace atlas {
+namespace field {
+
+// ------------------------------------------------------------------
+
+/*!
+ * \brief MultiField creator with the horizontal index first
+ * \details
+ * All variables are stored in one array with indexing [ngptot][nlev][nvar], as created by
+ * functionspace::StructuredColumns or functionspace::NodeColumns with option::levels(nlev) and
+ * option::variables(nvar). Each variable is exposed as a Field with indexing [ngptot][nlev].
+ * Without "nlev" parameter the level dimension is omitted: [ngptot][nvar] and [ngptot].
+ * Example use:
+ * \code{.cpp}
+ *     MultiField multifield(
+ *         Config
+ *           ("creator","Array")              // Array MultiFieldCreator
+ *           ("ngptot",functionspace.size())  // Total number of grid points, including halo
+ *           ("nlev",nlev)                    // Number of levels
+ *           ("fields",names)                 // Names of the variables
+ *           ("datatype","real64")            // Data type
+ *         );
+ * \endcode
+ */
+class MultiFieldCreatorArray : public MultiFieldCreator {
+public:
+    MultiFieldCreatorArray() {}
+    MultiFieldCreatorArray(const eckit::Parametrisation&) {}
+    virtual MultiFieldImpl* create(const eckit::Parametrisation&) const;
+};
+
+// ------------------------------------------------------------------
+
+}  // namespace field
+}  // namespace atlas
@@ -0,0 +1,90 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#include "atlas/field/MultiFieldCreatorIFS.h"
+
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include "eckit/config/Parametrisation.h"
+
+#include "atlas/array/ArraySpec.h"
+#include "atlas/array/DataType.h"
+#include "atlas/field/detail/MultiFieldImpl.h"
+#include "atlas/runtime/Exception.h"
+#include "atlas/runtime/Log.h"
+
+namespace atlas {
+namespace field {
+
+MultiFieldImpl* MultiFieldCreatorIFS::create(const eckit::Parametrisation& params) const {
+    size_t ngptot;
+    size_t nblk;
+    size_t nproma = 1;
+    size_t nlev   = 1;
+
+    if (!params.get("ngptot", ngptot)) {
+        throw_Exception("Could not find parameter 'ngptot' in Parametrisation");
+    }
+    params.get("nproma", nproma);
+    params.get("nlev", nlev);
+
+    array::DataType datatype       = config_datatype(params);
+    std::vector<std::string> names = config_fields(params);
+    size_t nvar                    = names.size();
+
+    nblk = std::ceil(static_cast<double>(ngptot) / static_cast<double>(nproma));
+
+    array::ArrayShape shape;
+    array::ArrayShape var_shape;
+    array::ArrayStrides var_strides;
+    size_t var_offset;
+    bool fortran(false);
+    params.get("fortran", fortran);
+    if (fortran) {
+        shape       = array::make_shape(nproma, nlev, nvar, nblk);
+        var_shape   = array::make_shape(nproma, nlev, nblk);
+        var_strides = array::make_strides(nlev * nvar * nblk, nvar * nblk, 1);
+        var_offset  = nblk;
+    }
+    else {
+        shape       = array::make_shape(nblk, nvar, nlev, nproma);
+        var_shape   = array::make_shape(nblk, nlev, nproma);
+        var_strides = array::make_strides(nvar * nlev * nproma, nproma, 1);
+        var_offset  = nlev * nproma;
+    }
+
+    std::string name;
+    params.get("name", name);
+    Log::debug() << "Creating IFS " << datatype.str() << " multi-field: " << name << "[nblk=" << nblk
+                 << "][nvar=" << nvar << "][nlev=" << nlev << "][nproma=" << nproma << "]\n";
+
+    auto multifield = new MultiFieldImpl(name, datatype, array::ArraySpec(shape));
+    Field& combined = multifield->combined();
+    combined.set_variables(nvar);
+    combined.set_levels(nlev);
+    combined.set_horizontal_dimension({0, 3});
+    for (size_t jvar = 0; jvar < nvar; ++jvar) {
+        Field field = multifield->add(names[jvar], var_shape, var_strides, jvar * var_offset);
+        field.set_levels(nlev);
+        field.set_horizontal_dimension({0, 2});
+    }
+    return multifield;
+}
+
+namespace {
+static MultiFieldCreatorBuilder<MultiFieldCreatorIFS> __IFS("IFS");
+}
+
+// ------------------------------------------------------------------
+
+}  // namespace field
+}  // namespace atlas
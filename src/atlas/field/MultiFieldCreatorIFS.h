@@ -0,0 +1,59 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#pragma once
+
+#include "atlas/field/MultiFieldCreator.h"
+
+namespace eckit {
+class Parametrisation;
+}
+namespace atlas {
+namespace field {
+class MultiFieldImpl;
+}
+}  // namespace atlas
+
+namespace atlas {
+namespace field {
+
+// ------------------------------------------------------------------
+
+/*!
+ * \brief MultiField creator using IFS parametrisation
+ * \details
+ * All variables are stored in one array with indexing [nblk][nvar][nlev][nproma], as created by
+ * FieldCreatorIFS and by functionspace::BlockStructuredColumns with option::variables(nvar).
+ * Each variable is exposed as a Field with indexing [nblk][nlev][nproma].
+ * With ("fortran",true) the indexing is reversed: [nproma][nlev][nvar][nblk] and [nproma][nlev][nblk].
+ * Example use:
+ * \code{.cpp}
+ *     MultiField multifield(
+ *         Config
+ *           ("creator","IFS")  // IFS MultiFieldCreator
+ *           ("ngptot",ngptot)  // Total number of grid points
+ *           ("nproma",nproma)  // Grouping of grid points for vectorlength
+ *           ("nlev",nlev)      // Number of levels
+ *           ("fields",names)   // Names of the variables
+ *           ("kind",8)         // Real kind in bytes
+ *         );
+ * \endcode
+ */
+class MultiFieldCreatorIFS : public MultiFieldCreator {
+public:
+    MultiFieldCreatorIFS() {}
+    MultiFieldCreatorIFS(const eckit::Parametrisation&) {}
+    virtual MultiFieldImpl* create(const eckit::Parametrisation&) const;
+};
+
+// ------------------------------------------------------------------
+
+}  // namespace field
+}  // namespace atlas
@@ -96,16 +96,37 @@ size_t FieldImpl::footprint() const {
     size += functionspace_->footprint();
     size += array_->footprint();
     size += metadata_.footprint();
-    size += name_.capacity() * sizeof(std::string::value_type);
+    size += attributes_.name.capacity() * sizeof(std::string::value_type);
+    size += attributes_.horizontal_dimension.capacity() * sizeof(idx_t);
     return size;
 }
 
-bool FieldImpl::dirty() const {
-    return metadata().getBool("dirty", true);
+void FieldImpl::set_dirty(bool value) const {
+    if (attributes().dirty == value) {
+        return;
+    }
+    set_attribute("dirty", value, &Attributes::dirty);
 }
 
-void FieldImpl::set_dirty(bool value) const {
-    const_cast<FieldImpl&>(*this).metadata().set("dirty", value);
+void FieldImpl::update_attributes() const {
+    std::lock_guard<std::mutex> lock(attributes_mutex_);
+    const size_t modifications = metadata_.modifications();
+    if (attributes_modifications_.load(std::memory_order_relaxed) == modifications) {
+        return;
+    }
+    attributes_.name = metadata_.getString("name", "");
+
+    attributes_.levels    = 0;
+    attributes_.variables = 0;
+    metadata_.get("levels", attributes_.levels);
+    metadata_.get("variables", attributes_.variables);
+
+    attributes_.horizontal_dimension = {0};
+    metadata_.get("horizontal_dimension", attributes_.horizontal_dimension);
+
+    attributes_.dirty = metadata_.getBool("dirty", true);
+
+    attributes_modifications_.store(modifications, std::memory_order_release);
 }
 
 void FieldImpl::dump(std::ostream& os) const {
@@ -130,11 +151,6 @@ std::string vector_to_str(const std::vector<T>& t) {
 
 }  // namespace
 
-const std::string& FieldImpl::name() const {
-    name_ = metadata().get<std::string>("name");
-    return name_;
-}
-
 void FieldImpl::print(std::ostream& os, bool dump) const {
     os << "FieldImpl[name=" << name() << ",datatype=" << datatype().str() << ",size=" << size()
        << ",shape=" << vector_to_str(shape()) << ",strides=" << vector_to_str(strides())
@@ -13,7 +13,10 @@
 
 #pragma once
 
+#include <atomic>
 #include <functional>
+#include <limits>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -96,12 +99,15 @@ public:  // Destructor
     array::DataType datatype() const { return array_->datatype(); }
 
     /// @brief Name associated to this field
-    const std::string& name() const;
+    const std::string& name() const { return attributes().name; }
 
     /// @brief Rename this field
-    void rename(const std::string& name) { metadata().set("name", name); }
+    void rename(const std::string& name) { set_attribute("name", name, &Attributes::name); }
 
     /// @brief Access to metadata associated to this field
+    ///
+    /// The attributes that are cached from metadata (name, levels, variables, horizontal_dimension, dirty) are
+    /// read again from metadata on next use after any change to the metadata.
     const util::Metadata& metadata() const { return metadata_; }
     util::Metadata& metadata() { return metadata_; }
 
@@ -143,18 +149,17 @@ public:  // Destructor
     /// @brief Output information of field plus raw data
     void dump(std::ostream& os) const;
 
-    /// Metadata that is more intrinsic to the Field, and queried often
-    void set_levels(idx_t n) { metadata().set("levels", n); }
-    void set_variables(idx_t n) { metadata().set("variables", n); }
-    idx_t levels() const { return metadata().get<idx_t>("levels"); }
-    idx_t variables() const { return metadata().get<idx_t>("variables"); }
-
-    void set_horizontal_dimension(const std::vector<idx_t>& h_dim) { metadata().set("horizontal_dimension", h_dim); }
-    std::vector<idx_t> horizontal_dimension() const {
-        std::vector<idx_t> h_dim{0};
-        metadata().get("horizontal_dimension", h_dim);
-        return h_dim;
+    /// Metadata that is more intrinsic to the Field, and queried often.
+    /// These are stored in metadata, and cached as typed attributes to avoid string-keyed lookups.
+    void set_levels(idx_t n) { set_attribute("levels", n, &Attributes::levels); }
+    void set_variables(idx_t n) { set_attribute("variables", n, &Attributes::variables); }
+    idx_t levels() const { return attributes().levels; }
+    idx_t variables() const { return attributes().variables; }
+
+    void set_horizontal_dimension(const std::vector<idx_t>& h_dim) {
+        set_attribute("horizontal_dimension", h_dim, &Attributes::horizontal_dimension);
     }
+    std::vector<idx_t> horizontal_dimension() const { return attributes().horizontal_dimension; }
 
     void set_functionspace(const FunctionSpace&);
     const FunctionSpace& functionspace() const;
@@ -162,7 +167,7 @@ public:  // Destructor
     /// @brief Return the memory footprint of the Field
     size_t footprint() const;
 
-    bool dirty() const;
+    bool dirty() const { return attributes().dirty; }
 
     void set_dirty(bool = true) const;
 
@@ -211,9 +216,43 @@ public:  // Destructor
 private:  // methods
     void print(std::ostream& os, bool dump = false) const;
 
+    struct Attributes {
+        std::string name;
+        idx_t levels{0};
+        idx_t variables{0};
+        std::vector<idx_t> horizontal_dimension{0};
+        bool dirty{true};
+    };
+
+    bool attributes_valid() const {
+        return attributes_modifications_.load(std::memory_order_acquire) == metadata_.modifications();
+    }
+
+    const Attributes& attributes() const {
+        if (not attributes_valid()) {
+            update_attributes();
+        }
+        return attributes_;
+    }
+
+    void update_attributes() const;
+
+    // Write value to metadata and to its cached attribute, keeping a valid cache valid
+    template <typename Value>
+    void set_attribute(const std::string& key, const Value& value, Value Attributes::*attribute) const {
+        const bool valid = attributes_valid();
+        const_cast<util::Metadata&>(metadata_).set(key, value);
+        attributes_.*attribute = value;
+        if (valid) {
+            attributes_modifications_.store(metadata_.modifications(), std::memory_order_release);
+        }
+    }
+
 private:  // members
-    mutable std::string name_;
     util::Metadata metadata_;
+    mutable Attributes attributes_;
+    mutable std::atomic<size_t> attributes_modifications_{std::numeric_limits<size_t>::max()};
+    mutable std::mutex attributes_mutex_;
     array::Array* array_;
     FunctionSpace* functionspace_;
     std::vector<std::function<void()>> callback_on_destruction_;
@@ -0,0 +1,73 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#include "atlas/field/detail/MultiFieldImpl.h"
+
+#include "atlas/array/Array.h"
+#include "atlas/array/ArraySpec.h"
+#include "atlas/functionspace/FunctionSpace.h"
+#include "atlas/runtime/Exception.h"
+
+namespace atlas {
+namespace field {
+
+namespace {
+template <typename Value>
+Field wrap(const std::string& name, array::Array& storage, const array::ArrayShape& shape,
+           const array::ArrayStrides& strides, size_t offset) {
+    ATLAS_ASSERT(offset < storage.size());
+    return Field(name, storage.host_data<Value>() + offset, array::ArraySpec(shape, strides));
+}
+}  // namespace
+
+MultiFieldImpl::MultiFieldImpl(const std::string& name, array::DataType datatype, const array::ArraySpec& spec):
+    combined_(name, datatype, array::ArraySpec(spec)) {}
+
+Field MultiFieldImpl::add(const std::string& name, const array::ArrayShape& shape, const array::ArrayStrides& strides,
+                          size_t offset) {
+    ATLAS_ASSERT(combined_);
+    ATLAS_ASSERT(shape.size() == strides.size());
+    auto& storage = combined_.array();
+    auto kind     = combined_.datatype().kind();
+    Field field;
+    if (kind == array::DataType::kind<int>()) {
+        field = wrap<int>(name, storage, shape, strides, offset);
+    }
+    else if (kind == array::DataType::kind<long>()) {
+        field = wrap<long>(name, storage, shape, strides, offset);
+    }
+    else if (kind == array::DataType::kind<float>()) {
+        field = wrap<float>(name, storage, shape, strides, offset);
+    }
+    else if (kind == array::DataType::kind<double>()) {
+        field = wrap<double>(name, storage, shape, strides, offset);
+    }
+    else {
+        throw_Exception("datatype not supported", Here());
+    }
+    if (combined_.functionspace()) {
+        field.set_functionspace(combined_.functionspace());
+    }
+    return fieldset_.add(field);
+}
+
+void MultiFieldImpl::set_functionspace(const FunctionSpace& functionspace) {
+    combined_.set_functionspace(functionspace);
+    for (auto& field : fieldset_) {
+        field.set_functionspace(functionspace);
+    }
+}
+
+size_t MultiFieldImpl::footprint() const {
+    return sizeof(*this) + combined_.footprint();
+}
+
+}  // namespace field
+}  // namespace atlas
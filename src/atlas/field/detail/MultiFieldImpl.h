@@ -0,0 +1,85 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "atlas/array/ArrayShape.h"
+#include "atlas/array/ArrayStrides.h"
+#include "atlas/array/DataType.h"
+#include "atlas/array_fwd.h"
+#include "atlas/field/Field.h"
+#include "atlas/field/FieldSet.h"
+#include "atlas/library/config.h"
+#include "atlas/util/Metadata.h"
+#include "atlas/util/Object.h"
+
+namespace atlas {
+class FunctionSpace;
+}  // namespace atlas
+
+namespace atlas {
+namespace field {
+
+//----------------------------------------------------------------------------------------------------------------------
+
+/// @brief Storage of multiple variables in one contiguous array
+///
+/// The combined Field owns the memory. Each variable is a Field wrapping a strided view into this memory,
+/// so these Fields are only valid as long as the MultiFieldImpl is alive.
+class MultiFieldImpl : public util::Object {
+public:
+    MultiFieldImpl() = default;
+
+    /// @brief Allocate combined storage with given name, DataType and ArraySpec
+    MultiFieldImpl(const std::string& name, array::DataType, const array::ArraySpec&);
+
+    idx_t size() const { return fieldset_.size(); }
+    bool has(const std::string& name) const { return fieldset_.has(name); }
+    std::vector<std::string> field_names() const { return fieldset_.field_names(); }
+
+    const Field& field(const std::string& name) const { return fieldset_.field(name); }
+    Field& field(const std::string& name) { return fieldset_.field(name); }
+    const Field& field(idx_t idx) const { return fieldset_.field(idx); }
+    Field& field(idx_t idx) { return fieldset_.field(idx); }
+
+    const FieldSet& fieldset() const { return fieldset_; }
+    FieldSet& fieldset() { return fieldset_; }
+
+    /// @brief Field spanning the storage of all variables, with "variables" metadata set
+    const Field& combined() const { return combined_; }
+    Field& combined() { return combined_; }
+
+    const array::Array& array() const { return combined_.array(); }
+    array::Array& array() { return combined_.array(); }
+
+    const util::Metadata& metadata() const { return metadata_; }
+    util::Metadata& metadata() { return metadata_; }
+
+    /// @brief Add variable as a view into the combined storage, starting at given offset (in elements)
+    Field add(const std::string& name, const array::ArrayShape&, const array::ArrayStrides&, size_t offset);
+
+    /// @brief Associate combined Field and all variables with given FunctionSpace
+    void set_functionspace(const FunctionSpace&);
+
+    size_t footprint() const;
+
+private:
+    Field combined_;
+    FieldSet fieldset_;
+    util::Metadata metadata_;
+};
+
+//----------------------------------------------------------------------------------------------------------------------
+
+}  // namespace field
+}  // namespace atlas
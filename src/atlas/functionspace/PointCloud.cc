@@ -10,6 +10,7 @@
  */
 
 
+#include <array>
 #include <string>
 #include <vector>
 
@@ -26,6 +27,7 @@
 #include "atlas/util/CoordinateEnums.h"
 #include "atlas/util/Metadata.h"
 #include "atlas/util/Point.h"
+#include "atlas/util/SpaceFillingCurve.h"
 #include "atlas/util/Unique.h"
 
 #include "eckit/mpi/Comm.h"
@@ -41,18 +43,43 @@ namespace functionspace {
 
 namespace detail {
 
+namespace {
+
+/// @brief Copy of field with its first dimension permuted, so that copy[n] = field[order[n]]
+template <typename Value, int Rank>
+Field permute(const Field& field, const std::vector<idx_t>& order) {
+    static_assert(Rank == 1 || Rank == 2, "Only fields of rank 1 or 2 can be permuted");
+    Field permuted(field.name(), field.datatype(), field.shape());
+    const auto in = array::make_view<const Value, Rank>(field);
+    auto out      = array::make_view<Value, Rank>(permuted);
+    for (idx_t n = 0, size = static_cast<idx_t>(order.size()); n < size; ++n) {
+        if constexpr (Rank == 1) {
+            out(n) = in(order[n]);
+        }
+        else {
+            for (idx_t v = 0; v < in.shape(1); ++v) {
+                out(n, v) = in(order[n], v);
+            }
+        }
+    }
+    return permuted;
+}
+
+}  // namespace
+
 template <>
-PointCloud::PointCloud(const std::vector<PointXY>& points) {
+PointCloud::PointCloud(const std::vector<PointXY>& points, const eckit::Configuration& config) {
     lonlat_     = Field("lonlat", array::make_datatype<double>(), array::make_shape(points.size(), 2));
     auto lonlat = array::make_view<double, 2>(lonlat_);
     for (idx_t j = 0, size = points.size(); j < size; ++j) {
         lonlat(j, 0) = points[j].x();
         lonlat(j, 1) = points[j].y();
     }
+    reorder(config);
 }
 
 template <>
-PointCloud::PointCloud(const std::vector<PointXYZ>& points) {
+PointCloud::PointCloud(const std::vector<PointXYZ>& points, const eckit::Configuration& config) {
     lonlat_       = Field("lonlat", array::make_datatype<double>(), array::make_shape(points.size(), 2));
     vertical_     = Field("vertical", array::make_datatype<double>(), array::make_shape(points.size()));
     auto lonlat   = array::make_view<double, 2>(lonlat_);
@@ -62,11 +89,16 @@ PointCloud::PointCloud(const std::vector<PointXYZ>& points) {
         lonlat(j, 1) = points[j].y();
         vertical(j)  = points[j].z();
     }
+    reorder(config);
 }
 
-PointCloud::PointCloud(const Field& lonlat): lonlat_(lonlat) {}
+PointCloud::PointCloud(const Field& lonlat, const eckit::Configuration& config): lonlat_(lonlat) {
+    reorder(config);
+}
 
-PointCloud::PointCloud(const Field& lonlat, const Field& ghost): lonlat_(lonlat), ghost_(ghost) {
+PointCloud::PointCloud(const Field& lonlat, const Field& ghost, const eckit::Configuration& config):
+    lonlat_(lonlat), ghost_(ghost) {
+    reorder(config);
     setupHaloExchange();
 }
 
@@ -75,15 +107,50 @@ PointCloud::PointCloud(const FieldSet & flds): lonlat_(flds["lonlat"]),
     setupHaloExchange();
 }
 
-PointCloud::PointCloud(const Grid& grid) {
+PointCloud::PointCloud(const Grid& grid, const eckit::Configuration& config) {
     lonlat_     = Field("lonlat", array::make_datatype<double>(), array::make_shape(grid.size(), 2));
     auto lonlat = array::make_view<double, 2>(lonlat_);
+    grid.fill_lonlat(lonlat.data());
+    reorder(config);
+}
+
+void PointCloud::reorder(const eckit::Configuration& config) {
+    std::string ordering{"none"};
+    config.get("ordering", ordering);
+    if (not util::space_filling_curve_ordering(ordering)) {
+        return;
+    }
+
+    // Owned points come first, followed by ghost points, so that the owned points keep contiguous indices
+    const auto lonlat = array::make_view<const double, 2>(lonlat_);
+    std::vector<int> is_ghost(lonlat.shape(0), 0);
+    if (ghost_) {
+        const auto ghost = array::make_view<const int, 1>(ghost_);
+        for (idx_t n = 0; n < lonlat.shape(0); ++n) {
+            is_ghost[n] = ghost(n) ? 1 : 0;
+        }
+    }
+    std::array<std::vector<idx_t>, 2> indices;
+    std::array<std::vector<PointXY>, 2> points;
+    for (idx_t n = 0; n < lonlat.shape(0); ++n) {
+        const int g = is_ghost[n];
+        indices[g].emplace_back(n);
+        points[g].emplace_back(lonlat(n, XX), lonlat(n, YY));
+    }
+    order_.clear();
+    order_.reserve(lonlat.shape(0));
+    for (int g : {0, 1}) {
+        for (idx_t k : util::space_filling_curve_order(ordering, points[g])) {
+            order_.emplace_back(indices[g][k]);
+        }
+    }
 
-    idx_t j{0};
-    for (auto p : grid.lonlat()) {
-        lonlat(j, 0) = p.lon();
-        lonlat(j, 1) = p.lat();
-        ++j;
+    lonlat_ = permute<double, 2>(lonlat_, order_);
+    if (vertical_) {
+        vertical_ = permute<double, 1>(vertical_, order_);
+    }
+    if (ghost_) {
+        ghost_ = permute<int, 1>(ghost_, order_);
     }
 }
 
@@ -468,20 +535,24 @@ void PointCloud::adjointHaloExchange(const Field& field, bool) const {
 PointCloud::PointCloud(const FunctionSpace& functionspace):
     FunctionSpace(functionspace), functionspace_(dynamic_cast<const detail::PointCloud*>(get())) {}
 
-PointCloud::PointCloud(const Field& field):
-    FunctionSpace(new detail::PointCloud(field)), functionspace_(dynamic_cast<const detail::PointCloud*>(get())) {}
+PointCloud::PointCloud(const Field& field, const eckit::Configuration& config):
+    FunctionSpace(new detail::PointCloud(field, config)),
+    functionspace_(dynamic_cast<const detail::PointCloud*>(get())) {}
 
-PointCloud::PointCloud(const Field& field1, const Field& field2):
-    FunctionSpace(new detail::PointCloud(field1, field2)), functionspace_(dynamic_cast<const detail::PointCloud*>(get())) {}
+PointCloud::PointCloud(const Field& field1, const Field& field2, const eckit::Configuration& config):
+    FunctionSpace(new detail::PointCloud(field1, field2, config)),
+    functionspace_(dynamic_cast<const detail::PointCloud*>(get())) {}
 
 PointCloud::PointCloud(const FieldSet& fset):
     FunctionSpace(new detail::PointCloud(fset)), functionspace_(dynamic_cast<const detail::PointCloud*>(get())) {}
 
-PointCloud::PointCloud(const std::vector<PointXY>& points):
-    FunctionSpace(new detail::PointCloud(points)), functionspace_(dynamic_cast<const detail::PointCloud*>(get())) {}
+PointCloud::PointCloud(const std::vector<PointXY>& points, const eckit::Configuration& config):
+    FunctionSpace(new detail::PointCloud(points, config)),
+    functionspace_(dynamic_cast<const detail::PointCloud*>(get())) {}
 
-PointCloud::PointCloud(const std::vector<PointXYZ>& points):
-    FunctionSpace(new detail::PointCloud(points)), functionspace_(dynamic_cast<const detail::PointCloud*>(get())) {}
+PointCloud::PointCloud(const std::vector<PointXYZ>& points, const eckit::Configuration& config):
+    FunctionSpace(new detail::PointCloud(points, config)),
+    functionspace_(dynamic_cast<const detail::PointCloud*>(get())) {}
 
 PointCloud::PointCloud(const std::initializer_list<std::initializer_list<double>>& points):
     FunctionSpace((points.begin()->size() == 2
@@ -489,8 +560,9 @@ PointCloud::PointCloud(const std::initializer_list<std::initializer_list<double>
                        : new detail::PointCloud{std::vector<PointXYZ>(points.begin(), points.end())})),
     functionspace_(dynamic_cast<const detail::PointCloud*>(get())) {}
 
-PointCloud::PointCloud(const Grid& grid):
-    FunctionSpace(new detail::PointCloud(grid)), functionspace_(dynamic_cast<const detail::PointCloud*>(get())) {}
+PointCloud::PointCloud(const Grid& grid, const eckit::Configuration& config):
+    FunctionSpace(new detail::PointCloud(grid, config)),
+    functionspace_(dynamic_cast<const detail::PointCloud*>(get())) {}
 
 
 }  // namespace functionspace
@@ -13,6 +13,8 @@
 #pragma once
 
 #include <memory>
+#include <string>
+#include <vector>
 
 #include "atlas/array/ArrayView.h"
 #include "atlas/field/Field.h"
@@ -41,12 +43,15 @@ namespace detail {
 
 class PointCloud : public functionspace::FunctionSpaceImpl {
 public:
+    /// Constructors accepting a configuration support the option "ordering": "none" (default) keeps the points in
+    /// input order, while "hilbert" or "morton" order owned points along a space filling curve, followed by the ghost
+    /// points along the same curve. The coordinate and ghost fields are then copies; see order().
     template <typename Point>
-    PointCloud(const std::vector<Point>&);
-    PointCloud(const Field& lonlat);
-    PointCloud(const Field& lonlat, const Field& ghost);
+    PointCloud(const std::vector<Point>&, const eckit::Configuration& = util::NoConfig());
+    PointCloud(const Field& lonlat, const eckit::Configuration& = util::NoConfig());
+    PointCloud(const Field& lonlat, const Field& ghost, const eckit::Configuration& = util::NoConfig());
     PointCloud(const FieldSet&);  // assuming lonlat ghost ridx and partition present
-    PointCloud(const Grid&);
+    PointCloud(const Grid&, const eckit::Configuration& = util::NoConfig());
     ~PointCloud() override {}
     std::string type() const override { return "PointCloud"; }
     operator bool() const override { return true; }
@@ -58,6 +63,10 @@ public:
     Field remote_index() const override { return remote_index_; }
     virtual idx_t size() const override { return lonlat_.shape(0); }
 
+    /// @brief Position in the input of each point, i.e. point n was input point order()[n].
+    /// Empty when the points are in input order.
+    const std::vector<idx_t>& order() const { return order_; }
+
     using FunctionSpaceImpl::createField;
     Field createField(const eckit::Configuration&) const override;
     Field createField(const Field&, const eckit::Configuration&) const override;
@@ -148,6 +157,7 @@ private:
 
     void set_field_metadata(const eckit::Configuration& config, Field& field) const;
 
+    void reorder(const eckit::Configuration& config);
 
 private:
     Field lonlat_;
@@ -157,6 +167,7 @@ private:
     Field partition_;
     std::unique_ptr<parallel::HaloExchange> halo_exchange_;
     idx_t levels_{0};
+    std::vector<idx_t> order_;
 
     void setupHaloExchange();
 
@@ -171,19 +182,21 @@ private:
 class PointCloud : public FunctionSpace {
 public:
     PointCloud(const FunctionSpace&);
-    PointCloud(const Field& points);
-    PointCloud(const Field&, const Field&);
+    PointCloud(const Field& points, const eckit::Configuration& = util::NoConfig());
+    PointCloud(const Field&, const Field&, const eckit::Configuration& = util::NoConfig());
     PointCloud(const FieldSet& flds);
-    PointCloud(const std::vector<PointXY>&);
-    PointCloud(const std::vector<PointXYZ>&);
+    PointCloud(const std::vector<PointXY>&, const eckit::Configuration& = util::NoConfig());
+    PointCloud(const std::vector<PointXYZ>&, const eckit::Configuration& = util::NoConfig());
     PointCloud(const std::initializer_list<std::initializer_list<double>>&);
-    PointCloud(const Grid&);
+    PointCloud(const Grid&, const eckit::Configuration& = util::NoConfig());
 
     operator bool() const { return valid(); }
     bool valid() const { return functionspace_; }
 
     const Field& vertical() const { return functionspace_->vertical(); }
 
+    const std::vector<idx_t>& order() const { return functionspace_->order(); }
+
     detail::PointCloud::Iterate iterate() const { return functionspace_->iterate(); }
 
 
@@ -8,6 +8,11 @@
  * nor does it submit to any jurisdiction.
  */
 
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <vector>
+
 #include "eckit/os/BackTrace.h"
 #include "eckit/utils/MD5.h"
 
@@ -17,6 +22,7 @@
 #include "atlas/functionspace/Spectral.h"
 #include "atlas/mesh/Mesh.h"
 #include "atlas/option.h"
+#include "atlas/parallel/mpi/Statistics.h"
 #include "atlas/parallel/mpi/mpi.h"
 #include "atlas/runtime/Exception.h"
 #include "atlas/runtime/Log.h"
@@ -48,94 +54,266 @@ namespace atlas {
 namespace functionspace {
 namespace detail {
 
+namespace {
+
+std::string default_distribution() {
 #if ATLAS_HAVE_TRANS
+    return "ectrans";
+#else
+    return "serial";
+#endif
+}
+
+// Zonal wavenumbers are distributed over MPI tasks in a zig-zag pattern 0,1,...,P-1,P-1,...,1,0,0,1,...
+// This balances the number of spectral coefficients per task, which decreases linearly with m.
+int zonal_wavenumber_owner(int m, int nb_parts) {
+    const int cycle = m / nb_parts;
+    const int part  = m % nb_parts;
+    return (cycle % 2 == 0) ? part : nb_parts - 1 - part;
+}
+
+// Number of spectral coefficients (real and imaginary parts) of zonal wavenumber m
+idx_t nb_coefficients(int truncation, int m) {
+    return 2 * (truncation + 1 - m);
+}
+
+// Offset of zonal wavenumber m in the global ordering of spectral coefficients
+idx_t global_offset(int truncation, int m) {
+    return idx_t(m) * (2 * truncation + 3 - m);
+}
+
+}  // namespace
+
+/// Parallelisation of spectral coefficients, either
+///  - "ectrans": as computed by the IFS trans library
+///  - "serial" : all zonal wavenumbers on every MPI task (replicated)
+///  - "mpi"    : zonal wavenumbers distributed over MPI tasks, as used by the "local" transform
 class Spectral::Parallelisation {
 public:
-    Parallelisation(const std::shared_ptr<::Trans_t> other): trans_(other) {}
-
-    Parallelisation(int truncation) {
-        trans_ = std::shared_ptr<::Trans_t>(new ::Trans_t, [](::Trans_t* p) {
-            TRANS_CHECK(::trans_delete(p));
-            delete p;
-        });
-        TRANS_CHECK(::trans_new(trans_.get()));
-        TRANS_CHECK(::trans_set_trunc(trans_.get(), truncation));
-        TRANS_CHECK(::trans_use_mpi(mpi::size() > 1));
-        TRANS_CHECK(::trans_setup(trans_.get()));
+#if ATLAS_HAVE_TRANS
+    Parallelisation(const std::shared_ptr<::Trans_t> other): truncation_(other->nsmax), trans_(other) {}
+#endif
+
+    Parallelisation(int truncation, const std::string& distribution): truncation_(truncation) {
+#if ATLAS_HAVE_TRANS
+        if (distribution == "ectrans") {
+            trans_ = std::shared_ptr<::Trans_t>(new ::Trans_t, [](::Trans_t* p) {
+                TRANS_CHECK(::trans_delete(p));
+                delete p;
+            });
+            TRANS_CHECK(::trans_new(trans_.get()));
+            TRANS_CHECK(::trans_set_trunc(trans_.get(), truncation));
+            TRANS_CHECK(::trans_use_mpi(mpi::size() > 1));
+            TRANS_CHECK(::trans_setup(trans_.get()));
+            return;
+        }
+#endif
+        if (distribution != "serial" && distribution != "mpi") {
+            throw_Exception("Spectral distribution \"" + distribution + "\" is not supported", Here());
+        }
+        distributed_       = (distribution == "mpi");
+        const int nb_parts = distributed_ ? static_cast<int>(mpi::size()) : 1;
+        const int part     = distributed_ ? static_cast<int>(mpi::rank()) : 0;
+
+        owner_.resize(truncation_ + 1);
+        nasm0_.assign(truncation_ + 1, -1);
+        nspec2_ = 0;
+        for (int m = 0; m <= truncation_; ++m) {
+            owner_[m] = zonal_wavenumber_owner(m, nb_parts);
+            if (owner_[m] == part) {
+                nmyms_.emplace_back(m);
+                nasm0_[m] = nspec2_ + 1;  // Fortran index
+                nspec2_ += nb_coefficients(truncation_, m);
+            }
+        }
+        nvalue_.resize(nspec2_);
+        idx_t jc{0};
+        for (int m : nmyms_) {
+            for (int n = m; n <= truncation_; ++n) {
+                nvalue_[jc++] = n;
+                nvalue_[jc++] = n;
+            }
+        }
+        ATLAS_ASSERT(jc == nspec2_);
     }
 
-    int nb_spectral_coefficients_global() const { return trans_->nspec2g; }
-    int nb_spectral_coefficients() const { return trans_->nspec2; }
+    int nb_spectral_coefficients_global() const {
+#if ATLAS_HAVE_TRANS
+        if (trans_) {
+            return trans_->nspec2g;
+        }
+#endif
+        return (truncation_ + 1) * (truncation_ + 2);
+    }
 
-    int nump() const { return trans_->nump; }
+    int nb_spectral_coefficients() const {
+#if ATLAS_HAVE_TRANS
+        if (trans_) {
+            return trans_->nspec2;
+        }
+#endif
+        return nspec2_;
+    }
+
+    int nump() const {
+#if ATLAS_HAVE_TRANS
+        if (trans_) {
+            return trans_->nump;
+        }
+#endif
+        return static_cast<int>(nmyms_.size());
+    }
 
     array::LocalView<const int, 1> nvalue() const {
-        if (trans_->nvalue == nullptr) {
-            ::trans_inquire(trans_.get(), "nvalue");
+#if ATLAS_HAVE_TRANS
+        if (trans_) {
+            if (trans_->nvalue == nullptr) {
+                ::trans_inquire(trans_.get(), "nvalue");
+            }
+            return array::make_view<const int, 1>(trans_->nvalue, array::make_shape(trans_->nspec2));
         }
-        return array::make_view<const int, 1>(trans_->nvalue, array::make_shape(trans_->nspec2));
+#endif
+        return array::make_view<const int, 1>(nvalue_.data(), array::make_shape(nb_spectral_coefficients()));
     }
 
     array::LocalView<const int, 1> nmyms() const {
-        if (trans_->nmyms == nullptr) {
-            ::trans_inquire(trans_.get(), "nmyms");
+#if ATLAS_HAVE_TRANS
+        if (trans_) {
+            if (trans_->nmyms == nullptr) {
+                ::trans_inquire(trans_.get(), "nmyms");
+            }
+            return array::make_view<const int, 1>(trans_->nmyms, array::make_shape(nump()));
         }
-        return array::make_view<const int, 1>(trans_->nmyms, array::make_shape(nump()));
+#endif
+        return array::make_view<const int, 1>(nmyms_.data(), array::make_shape(nump()));
     }
 
     array::LocalView<const int, 1> nasm0() const {
-        if (trans_->nasm0 == nullptr) {
-            ::trans_inquire(trans_.get(), "nasm0");
+#if ATLAS_HAVE_TRANS
+        if (trans_) {
+            if (trans_->nasm0 == nullptr) {
+                ::trans_inquire(trans_.get(), "nasm0");
+            }
+            return array::make_view<const int, 1>(trans_->nasm0, array::make_shape(trans_->nsmax + 1));
+        }
+#endif
+        return array::make_view<const int, 1>(nasm0_.data(), array::make_shape(truncation_ + 1));
+    }
+
+    std::string distribution() const {
+#if ATLAS_HAVE_TRANS
+        if (trans_) {
+            return "ectrans";
         }
-        return array::make_view<const int, 1>(trans_->nasm0, array::make_shape(trans_->nsmax + 1));
+#endif
+        return distributed_ ? "mpi" : "serial";
     }
 
-    std::string distribution() const { return "ectrans"; }
+#if ATLAS_HAVE_TRANS
+    bool ifs() const { return bool(trans_); }
     operator ::Trans_t*() const { return trans_.get(); }
-    std::shared_ptr<::Trans_t> trans_;
-};
-#else
-class Spectral::Parallelisation {
-public:
-    Parallelisation(int truncation): truncation_(truncation) {
-        // Assume serial!!!
-        nmyms_.resize(truncation_ + 1);
-        nasm0_.resize(truncation_ + 1);
-        nvalue_.resize(nb_spectral_coefficients());
-        idx_t jc{0};
-        for (idx_t m = 0; m <= truncation_; ++m) {
-            nmyms_[m] = m;
-            nasm0_[m] = jc + 1;  // Fortran index
-            for (idx_t n = m; n <= truncation_; ++n) {
-                nvalue_[jc++] = n;
-                nvalue_[jc++] = n;
+#endif
+
+    // Gather nfld interleaved fields of spectral coefficients to the global ordering on task root
+    void gather(const double loc[], double glb[], idx_t nfld, idx_t root) const {
+        const idx_t rank = mpi::rank();
+        if (not distributed_ || mpi::size() == 1) {
+            if (rank == root) {
+                std::copy_n(loc, nspec2_ * nfld, glb);
+            }
+            return;
+        }
+        std::vector<int> counts;
+        std::vector<int> displs;
+        partition_counts(nfld, counts, displs);
+        std::vector<double> buffer(rank == root ? nb_spectral_coefficients_global() * nfld : 0);
+        ATLAS_TRACE_MPI(GATHER) {
+            mpi::comm().gatherv(loc, nspec2_ * nfld, buffer.data(), counts.data(), displs.data(), root);
+        }
+        if (rank == root) {
+            // Zonal wavenumbers of each task arrive in increasing order
+            for (int m = 0; m <= truncation_; ++m) {
+                const idx_t size = nb_coefficients(truncation_, m) * nfld;
+                std::copy_n(buffer.data() + displs[owner_[m]], size, glb + global_offset(truncation_, m) * nfld);
+                displs[owner_[m]] += size;
             }
         }
-        ATLAS_ASSERT(jc == nb_spectral_coefficients());
     }
-    int nb_spectral_coefficients_global() const { return (truncation_ + 1) * (truncation_ + 2); }
-    int nb_spectral_coefficients() const { return nb_spectral_coefficients_global(); }
-    int truncation_;
-    std::string distribution() const { return "serial"; }
-
-    int nump() const { return truncation_ + 1; }
 
-    array::LocalView<const int, 1> nmyms() const {
-        return array::make_view<int, 1>(nmyms_.data(), array::make_shape(nump()));
+    // Scatter nfld interleaved fields of spectral coefficients in the global ordering from task root
+    void scatter(const double glb[], double loc[], idx_t nfld, idx_t root) const {
+        const idx_t rank = mpi::rank();
+        if (not distributed_ || mpi::size() == 1) {
+            if (rank == root) {
+                std::copy_n(glb, nspec2_ * nfld, loc);
+            }
+            if (mpi::size() > 1) {
+                ATLAS_TRACE_MPI(BROADCAST) { mpi::comm().broadcast(loc, nspec2_ * nfld, root); }
+            }
+            return;
+        }
+        std::vector<int> counts;
+        std::vector<int> displs;
+        partition_counts(nfld, counts, displs);
+        std::vector<double> buffer(rank == root ? nb_spectral_coefficients_global() * nfld : 0);
+        if (rank == root) {
+            std::vector<int> offset(displs);
+            for (int m = 0; m <= truncation_; ++m) {
+                const idx_t size = nb_coefficients(truncation_, m) * nfld;
+                std::copy_n(glb + global_offset(truncation_, m) * nfld, size, buffer.data() + offset[owner_[m]]);
+                offset[owner_[m]] += size;
+            }
+        }
+        ATLAS_TRACE_MPI(SCATTER) {
+            mpi::comm().scatterv(buffer.data(), counts.data(), displs.data(), loc, nspec2_ * nfld, root);
+        }
     }
 
-    array::LocalView<const int, 1> nvalue() const {
-        return array::make_view<int, 1>(nvalue_.data(), array::make_shape(nb_spectral_coefficients()));
+    // Norms of nfld interleaved fields, weighted as in the IFS trans library, available on all tasks
+    void norm(const double rspec[], idx_t nfld, double norms[]) const {
+        std::fill_n(norms, nfld, 0.);
+        for (int m : nmyms_) {
+            const double weight = (m == 0 ? 1. : 2.);
+            const idx_t begin   = (nasm0_[m] - 1) * nfld;
+            const idx_t end     = begin + nb_coefficients(truncation_, m) * nfld;
+            for (idx_t jc = begin; jc < end; jc += nfld) {
+                for (idx_t jfld = 0; jfld < nfld; ++jfld) {
+                    norms[jfld] += weight * rspec[jc + jfld] * rspec[jc + jfld];
+                }
+            }
+        }
+        if (distributed_ && mpi::size() > 1) {
+            ATLAS_TRACE_MPI(ALLREDUCE) { mpi::comm().allReduceInPlace(norms, nfld, eckit::mpi::sum()); }
+        }
+        for (idx_t jfld = 0; jfld < nfld; ++jfld) {
+            norms[jfld] = std::sqrt(norms[jfld]);
+        }
     }
 
-    array::LocalView<const int, 1> nasm0() const {
-        return array::make_view<int, 1>(nasm0_.data(), array::make_shape(truncation_ + 1));
+private:
+    void partition_counts(idx_t nfld, std::vector<int>& counts, std::vector<int>& displs) const {
+        const int nb_parts = static_cast<int>(mpi::size());
+        counts.assign(nb_parts, 0);
+        displs.assign(nb_parts, 0);
+        for (int m = 0; m <= truncation_; ++m) {
+            counts[owner_[m]] += nb_coefficients(truncation_, m) * nfld;
+        }
+        for (int p = 1; p < nb_parts; ++p) {
+            displs[p] = displs[p - 1] + counts[p - 1];
+        }
     }
+
+    int truncation_;
+    bool distributed_{false};
+    idx_t nspec2_{0};
+    std::vector<int> owner_;
     std::vector<int> nmyms_;
     std::vector<int> nasm0_;
     std::vector<int> nvalue_;
-};
+#if ATLAS_HAVE_TRANS
+    std::shared_ptr<::Trans_t> trans_;
 #endif
+};
 
 void Spectral::set_field_metadata(const eckit::Configuration& config, Field& field) const {
     field.set_functionspace(this);
@@ -174,7 +352,9 @@ Spectral::Spectral(const eckit::Configuration& config): Spectral::Spectral(confi
 // ----------------------------------------------------------------------
 
 Spectral::Spectral(const int truncation, const eckit::Configuration& config):
-    nb_levels_(0), truncation_(truncation), parallelisation_(new Parallelisation(truncation_)) {
+    nb_levels_(0),
+    truncation_(truncation),
+    parallelisation_(new Parallelisation(truncation_, config.getString("distribution", default_distribution()))) {
     config.get("levels", nb_levels_);
 }
 
@@ -186,7 +366,7 @@ Spectral::Spectral(const trans::Trans& trans, const eckit::Configuration& config
             return new Parallelisation(trans_ifs->trans_);
         }
 #endif
-        return new Parallelisation(truncation_);
+        return new Parallelisation(truncation_, trans.spectral().distribution());
     }()) {
     config.get("levels", nb_levels_);
 }
@@ -264,7 +444,6 @@ void Spectral::gather(const FieldSet& local_fieldset, FieldSet& global_fieldset)
             throw_Exception(err.str(), Here());
         }
 
-#if ATLAS_HAVE_TRANS
         Field& glb = global_fieldset[f];
         idx_t root = 0;
         idx_t rank = mpi::rank();
@@ -273,31 +452,25 @@ void Spectral::gather(const FieldSet& local_fieldset, FieldSet& global_fieldset)
         if (rank == root) {
             ATLAS_ASSERT(glb.shape(0) == nb_spectral_coefficients_global());
         }
-        std::vector<int> nto(1, root + 1);
-        if (loc.rank() > 1) {
-            nto.resize(loc.stride(0));
-            for (size_t i = 0; i < nto.size(); ++i) {
-                nto[i] = root + 1;
-            }
-        }
+        const idx_t nfld = (loc.rank() > 1 ? loc.stride(0) : 1);
 
         if (not loc.contiguous()) {
-            throw_Exception("Cannot gather field " + loc.name() +
-                            " using IFS trans library as its data is not contiguous");
+            throw_Exception("Cannot gather field " + loc.name() + " as its data is not contiguous");
         }
 
-        struct ::GathSpec_t args = new_gathspec(*parallelisation_);
-        args.nfld                = nto.size();
-        args.rspecg              = glb.array().data<double>();
-        args.nto                 = nto.data();
-        args.rspec               = loc.array().data<double>();
-        TRANS_CHECK(::trans_gathspec(&args));
-#else
-
-        throw_Exception(
-            "Cannot gather spectral fields because Atlas has "
-            "not been compiled with TRANS support.");
+#if ATLAS_HAVE_TRANS
+        if (parallelisation_->ifs()) {
+            std::vector<int> nto(nfld, root + 1);
+            struct ::GathSpec_t args = new_gathspec(*parallelisation_);
+            args.nfld                = nto.size();
+            args.rspecg              = glb.array().data<double>();
+            args.nto                 = nto.data();
+            args.rspec               = loc.array().data<double>();
+            TRANS_CHECK(::trans_gathspec(&args));
+            continue;
+        }
 #endif
+        parallelisation_->gather(loc.array().data<double>(), glb.array().data<double>(), nfld, root);
     }
 }
 void Spectral::gather(const Field& local, Field& global) const {
@@ -321,7 +494,6 @@ void Spectral::scatter(const FieldSet& global_fieldset, FieldSet& local_fieldset
             throw_Exception(err.str(), Here());
         }
 
-#if ATLAS_HAVE_TRANS
         idx_t root = 0;
         idx_t rank = mpi::rank();
 
@@ -330,33 +502,30 @@ void Spectral::scatter(const FieldSet& global_fieldset, FieldSet& local_fieldset
         if (rank == root) {
             ATLAS_ASSERT(glb.shape(0) == nb_spectral_coefficients_global());
         }
-        std::vector<int> nfrom(1, root + 1);
-        if (loc.rank() > 1) {
-            nfrom.resize(loc.stride(0));
-            for (size_t i = 0; i < nfrom.size(); ++i) {
-                nfrom[i] = root + 1;
-            }
-        }
+        const idx_t nfld = (loc.rank() > 1 ? loc.stride(0) : 1);
 
         if (not loc.contiguous()) {
-            throw_Exception("Cannot scatter field " + glb.name() +
-                            " using IFS trans library as its data is not contiguous");
+            throw_Exception("Cannot scatter field " + glb.name() + " as its data is not contiguous");
         }
 
-        struct ::DistSpec_t args = new_distspec(*parallelisation_);
-        args.nfld                = int(nfrom.size());
-        args.rspecg              = glb.array().data<double>();
-        args.nfrom               = nfrom.data();
-        args.rspec               = loc.array().data<double>();
-        TRANS_CHECK(::trans_distspec(&args));
+#if ATLAS_HAVE_TRANS
+        if (parallelisation_->ifs()) {
+            std::vector<int> nfrom(nfld, root + 1);
+            struct ::DistSpec_t args = new_distspec(*parallelisation_);
+            args.nfld                = int(nfrom.size());
+            args.rspecg              = glb.array().data<double>();
+            args.nfrom               = nfrom.data();
+            args.rspec               = loc.array().data<double>();
+            TRANS_CHECK(::trans_distspec(&args));
+        }
+        else
+#endif
+        {
+            parallelisation_->scatter(glb.array().data<double>(), loc.array().data<double>(), nfld, root);
+        }
 
         glb.metadata().broadcast(loc.metadata(), root);
         loc.metadata().set("global", false);
-#else
-        throw_Exception(
-            "Cannot scatter spectral fields because Atlas has "
-            "not been compiled with TRANS support.");
-#endif
     }
 }
 void Spectral::scatter(const Field& global, Field& local) const {
@@ -378,38 +547,28 @@ std::string Spectral::checksum(const Field& field) const {
 }
 
 void Spectral::norm(const Field& field, double& norm, int rank) const {
-#if ATLAS_HAVE_TRANS
     ATLAS_ASSERT(std::max<int>(1, field.levels()) == 1,
                  "Only a single-level field can be used for computing single norm.");
-    struct ::SpecNorm_t args = new_specnorm(*parallelisation_);
-    args.nfld                = 1;
-    args.rspec               = field.array().data<double>();
-    args.rnorm               = &norm;
-    args.nmaster             = rank + 1;
-    TRANS_CHECK(::trans_specnorm(&args));
-#else
-    throw_Exception(
-        "Cannot compute spectral norms because Atlas has not "
-        "been compiled with TRANS support.");
-#endif
+    Spectral::norm(field, &norm, rank);
 }
 void Spectral::norm(const Field& field, double norm_per_level[], int rank) const {
-#if ATLAS_HAVE_TRANS
     if (not field.contiguous()) {
-        throw_Exception("Cannot compute spectral norm of field " + field.name() +
-                        " using IFS trans library as its data is not contiguous");
+        throw_Exception("Cannot compute spectral norm of field " + field.name() + " as its data is not contiguous");
+    }
+    const idx_t nfld = std::max<int>(1, field.levels());
+#if ATLAS_HAVE_TRANS
+    if (parallelisation_->ifs()) {
+        struct ::SpecNorm_t args = new_specnorm(*parallelisation_);
+        args.nfld                = nfld;
+        args.rspec               = field.array().data<double>();
+        args.rnorm               = norm_per_level;
+        args.nmaster             = rank + 1;
+        TRANS_CHECK(::trans_specnorm(&args));
+        return;
     }
-    struct ::SpecNorm_t args = new_specnorm(*parallelisation_);
-    args.nfld                = std::max<int>(1, field.levels());
-    args.rspec               = field.array().data<double>();
-    args.rnorm               = norm_per_level;
-    args.nmaster             = rank + 1;
-    TRANS_CHECK(::trans_specnorm(&args));
-#else
-    throw_Exception(
-        "Cannot compute spectral norms because Atlas has not "
-        "been compiled with TRANS support.");
 #endif
+    // Norms are computed on all tasks, not only on task "rank"
+    parallelisation_->norm(field.array().data<double>(), nfld, norm_per_level);
 }
 void Spectral::norm(const Field& field, std::vector<double>& norm_per_level, int rank) const {
     norm(field, norm_per_level.data(), rank);
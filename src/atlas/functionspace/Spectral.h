@@ -55,7 +55,12 @@ class Spectral : public functionspace::FunctionSpaceImpl {
       data( jc++, jfld ) = func_imag_part(m,n);
     }
   }
-  
+
+  The distribution of zonal wavenumbers over MPI tasks is selected with the "distribution" option:
+     "ectrans" : as computed by the IFS trans library (default if atlas is compiled with trans)
+     "serial"  : all zonal wavenumbers on every task (default otherwise)
+     "mpi"     : zonal wavenumbers distributed over all tasks, as used by the "local" transform
+
 */
 
 public:
@@ -46,6 +46,8 @@ public:
 
     idx_t halo() const { return functionspace_->halo(); }
 
+    const std::string& ordering() const { return functionspace_->ordering(); }
+
     const Vertical& vertical() const { return functionspace_->vertical(); }
 
     const StructuredGrid& grid() const { return functionspace_->grid(); }
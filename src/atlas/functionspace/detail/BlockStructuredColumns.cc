@@ -351,15 +351,52 @@ void BlockStructuredColumns::gather(const Field& local, Field& global) const {
 }
 
 // ----------------------------------------------------------------------------
-// Checksum Field
+// HaloExchange FieldSet
 // ----------------------------------------------------------------------------
+void BlockStructuredColumns::haloExchange(const FieldSet& fieldset, bool on_device) const {
+    ATLAS_ASSERT(not on_device, "BlockStructuredColumns::haloExchange is only supported on host");
+    FieldSet nonblocked_fieldset;
+    for (idx_t f = 0; f < fieldset.size(); ++f) {
+        const Field& loc = fieldset[f];
+        auto sloc        = structuredcolumns_->createField(loc, util::Config("global", false));
+        transpose_blocked_to_nonblocked(loc, sloc, *this);
+        nonblocked_fieldset.add(sloc);
+    }
+    structuredcolumns_->haloExchange(nonblocked_fieldset);
+    for (idx_t f = 0; f < fieldset.size(); ++f) {
+        Field loc = fieldset[f];
+        transpose_nonblocked_to_blocked(nonblocked_fieldset[f], loc, *this);
+        loc.set_dirty(false);
+    }
+}
+
+// ----------------------------------------------------------------------------
+// HaloExchange Field
+// ----------------------------------------------------------------------------
+void BlockStructuredColumns::haloExchange(const Field& field, bool on_device) const {
+    FieldSet fieldset;
+    fieldset.add(field);
+    haloExchange(fieldset, on_device);
+}
 
-std::string BlockStructuredColumns::checksum(const Field&) const {
-    ATLAS_NOTIMPLEMENTED;
+// ----------------------------------------------------------------------------
+// Checksum
+// ----------------------------------------------------------------------------
+std::string BlockStructuredColumns::checksum(const FieldSet& fieldset) const {
+    FieldSet nonblocked_fieldset;
+    for (idx_t f = 0; f < fieldset.size(); ++f) {
+        const Field& loc = fieldset[f];
+        auto sloc        = structuredcolumns_->createField(loc, util::Config("global", false));
+        transpose_blocked_to_nonblocked(loc, sloc, *this);
+        nonblocked_fieldset.add(sloc);
+    }
+    return structuredcolumns_->checksum(nonblocked_fieldset);
 }
 
-std::string BlockStructuredColumns::checksum(const FieldSet&) const {
-    ATLAS_NOTIMPLEMENTED;
+std::string BlockStructuredColumns::checksum(const Field& field) const {
+    FieldSet fieldset;
+    fieldset.add(field);
+    return checksum(fieldset);
 }
 
 
@@ -90,6 +90,9 @@ public:
     void gather(const FieldSet&, FieldSet&) const override;
     void gather(const Field&, Field&) const override;
 
+    void haloExchange(const FieldSet&, bool on_device = false) const override;
+    void haloExchange(const Field&, bool on_device = false) const override;
+
     idx_t size() const override { return structuredcolumns_->size(); }
     idx_t index(idx_t jblk, idx_t jrof) const {
         return jblk * nproma_ + jrof; // local index;
@@ -11,6 +11,7 @@
 
 #include <array>
 #include <functional>
+#include <string>
 #include <type_traits>
 
 #include "atlas/array/DataType.h"
@@ -109,6 +110,10 @@ public:
 
     idx_t halo() const { return halo_; }
 
+    /// @brief Local ordering of owned points: "none" for (j,i) order, or "hilbert"/"morton" along a
+    /// space filling curve (configuration option "ordering"). Halo points always follow owned points in (j,i) order.
+    const std::string& ordering() const { return ordering_; }
+
     std::string checksum(const FieldSet&) const;
     std::string checksum(const Field&) const;
 
@@ -213,6 +218,7 @@ private:  // data
     friend class StructuredColumnsGatherScatterCache;
     friend class StructuredColumnsChecksumCache;
     bool periodic_points_{false};
+    std::string ordering_{"none"};
 
     const StructuredGrid* grid_;
     mutable util::ObjectHandle<parallel::GatherScatter> gather_scatter_;
@@ -27,6 +27,7 @@
 #include "atlas/runtime/Exception.h"
 #include "atlas/runtime/Trace.h"
 #include "atlas/util/CoordinateEnums.h"
+#include "atlas/util/SpaceFillingCurve.h"
 
 namespace atlas {
 namespace functionspace {
@@ -76,6 +77,11 @@ public:
 
     const GridPoint& operator[](idx_t i) const { return gp_[i]; }
 
+    // Assign the ordering r = k to the point gp_[order[k]]
+    void reorder(const std::vector<idx_t>& order) {
+        atlas_omp_parallel_for(idx_t k = 0; k < static_cast<idx_t>(order.size()); ++k) { gp_[order[k]].r = k; }
+    }
+
     // unused:
     //using const_iterator = decltype( gp_ )::const_iterator;
     //const_iterator begin() const { return gp_.begin(); }
@@ -87,6 +93,8 @@ public:
 
 void StructuredColumns::setup(const grid::Distribution& distribution, const eckit::Configuration& config) {
     config.get("periodic_points", periodic_points_);
+    config.get("ordering", ordering_);
+    util::space_filling_curve_ordering(ordering_);
     if (not(*grid_)) {
         throw_Exception("Grid is not a grid::Structured type", Here());
     }
@@ -531,6 +539,17 @@ void StructuredColumns::setup(const grid::Distribution& distribution, const ecki
 
             ATLAS_ASSERT(gridpoints.size() == owned);
 
+            // Owned points are ordered along a space filling curve; halo points follow in (j,i) order
+            if (util::space_filling_curve_ordering(ordering_)) {
+                ATLAS_TRACE("Order gridpoints");
+                std::vector<PointXY> points(owned);
+                atlas_omp_parallel_for(idx_t n = 0; n < owned; ++n) {
+                    const GridPoint& gp = gridpoints[n];
+                    points[n]           = PointXY{grid_->x(gp.i, gp.j), grid_->y(gp.j)};
+                }
+                gridpoints.reorder(util::space_filling_curve_order(ordering_, points));
+            }
+
             gridpoints.resize(owned + extra_halo);
             idx_t r = owned;
             for (idx_t j = j_begin_halo_; j < j_begin_; ++j) {
@@ -18,12 +18,26 @@
 #include "atlas/grid/Grid.h"
 #include "atlas/grid/Iterator.h"
 #include "atlas/grid/Spacing.h"
+#include "atlas/parallel/omp/omp.h"
 #include "atlas/projection/Projection.h"
 #include "atlas/runtime/Exception.h"
 #include "atlas/util/Config.h"
 
 namespace atlas {
 
+namespace {
+template <typename Fill>
+void fill_parallel(idx_t size, double crd[], const Fill& fill) {
+    atlas_omp_parallel {
+        const idx_t num_threads = atlas_omp_get_num_threads();
+        const idx_t thread_num  = atlas_omp_get_thread_num();
+        const idx_t begin       = static_cast<idx_t>(thread_num * size_t(size) / num_threads);
+        const idx_t end         = static_cast<idx_t>((thread_num + 1) * size_t(size) / num_threads);
+        fill(begin, end, crd + 2 * size_t(begin));
+    }
+}
+}  // namespace
+
 Grid::IterateXY Grid::xy() const {
     return Grid::IterateXY(*get());
 }
@@ -65,6 +79,25 @@ idx_t Grid::size() const {
     return get()->size();
 }
 
+void Grid::fill_xy(idx_t begin, idx_t end, double xy[]) const {
+    get()->fill_xy(begin, end, xy);
+}
+
+void Grid::fill_lonlat(idx_t begin, idx_t end, double lonlat[]) const {
+    get()->fill_lonlat(begin, end, lonlat);
+}
+
+void Grid::fill_xy(double xy[]) const {
+    const auto* grid = get();
+    fill_parallel(grid->size(), xy, [grid](idx_t begin, idx_t end, double crd[]) { grid->fill_xy(begin, end, crd); });
+}
+
+void Grid::fill_lonlat(double lonlat[]) const {
+    const auto* grid = get();
+    fill_parallel(grid->size(), lonlat,
+                  [grid](idx_t begin, idx_t end, double crd[]) { grid->fill_lonlat(begin, end, crd); });
+}
+
 size_t Grid::footprint() const {
     return get()->footprint();
 }
@@ -88,6 +88,21 @@ public:
 
     idx_t size() const;
 
+    /// @brief Fill coordinates of grid points with index in [begin, end) as interleaved pairs
+    ///
+    /// This avoids the per-point virtual calls of the xy() and lonlat() iterators:
+    /// @code{.cpp}
+    ///     std::vector<double> lonlat(2 * (end - begin));
+    ///     grid.fill_lonlat(begin, end, lonlat.data());
+    /// @endcode
+    void fill_xy(idx_t begin, idx_t end, double xy[]) const;
+    void fill_lonlat(idx_t begin, idx_t end, double lonlat[]) const;
+
+    /// @brief Fill coordinates of all grid points as interleaved pairs, with OpenMP threads
+    /// each filling a contiguous chunk
+    void fill_xy(double xy[]) const;
+    void fill_lonlat(double lonlat[]) const;
+
     const Projection& projection() const;
     const Domain& domain() const;
     RectangularLonLatDomain lonlatBoundingBox() const;
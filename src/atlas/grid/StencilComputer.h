@@ -10,6 +10,8 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
 #include <cmath>
 #include <vector>
 
@@ -75,6 +77,25 @@ public:
 
         return j;
     }
+
+    /// Batched version of operator() for n points
+    void operator()(idx_t n, const double y[], idx_t j[]) const {
+        const double y0     = y_[halo_ + 0];
+        const double dy_inv = 1. / dy_;
+        const idx_t jmax    = halo_ + ny_ - 1;
+        for (idx_t p = 0; p < n; ++p) {
+            idx_t jp = static_cast<idx_t>(std::floor((y0 - y[p]) * dy_inv));
+            j[p]     = std::max<idx_t>(halo_, std::min<idx_t>(jp, jmax));
+        }
+        for (idx_t p = 0; p < n; ++p) {
+            while (y_[halo_ + j[p]] > y[p]) {
+                ++j[p];
+            }
+            do {
+                --j[p];
+            } while (y_[halo_ + j[p]] < y[p]);
+        }
+    }
 };
 
 //-----------------------------------------------------------------------------
@@ -96,6 +117,15 @@ public:
         idx_t i  = static_cast<idx_t>(std::floor((x - xref[jj]) / dx[jj]));
         return i;
     }
+
+    /// Batched version of operator() for n points, each with its own latitude index
+    void operator()(idx_t n, const double x[], const idx_t j[], idx_t i[]) const {
+        const double* xref_ = xref.data() + halo_;
+        const double* dx_   = dx.data() + halo_;
+        for (idx_t p = 0; p < n; ++p) {
+            i[p] = static_cast<idx_t>(std::floor((x[p] - xref_[j[p]]) / dx_[j[p]]));
+        }
+    }
 };
 
 
@@ -138,6 +168,9 @@ public:
 
     ComputeHorizontalStencil(const StructuredGrid& grid, idx_t stencil_width);
 
+    /// Number of points computed together by the batched operator()
+    static constexpr idx_t batch_size() { return 8; }
+
     template <typename stencil_t>
     void operator()(const double& x, const double& y, stencil_t& stencil) const {
         stencil.j_begin_ = compute_north_(y) - stencil_begin_;
@@ -145,6 +178,35 @@ public:
             stencil.i_begin_[jj] = compute_west_(x, stencil.j_begin_ + jj) - stencil_begin_;
         }
     }
+
+    /// @brief Compute the stencils of n points with coordinates given in separate arrays x and y
+    ///
+    /// Points are processed in batches of batch_size(), keeping intermediate indices in
+    /// contiguous arrays so that the inner loops over points can be vectorised.
+    /// Results are identical to calling operator() for every point.
+    template <typename stencil_t>
+    void operator()(idx_t n, const double x[], const double y[], stencil_t stencil[]) const {
+        std::array<idx_t, batch_size()> j_begin;
+        std::array<idx_t, batch_size()> j_row;
+        std::array<idx_t, batch_size()> i_begin;
+        for (idx_t p0 = 0; p0 < n; p0 += batch_size()) {
+            const idx_t nb = std::min(batch_size(), n - p0);
+            compute_north_(nb, y + p0, j_begin.data());
+            for (idx_t b = 0; b < nb; ++b) {
+                j_begin[b] -= stencil_begin_;
+                stencil[p0 + b].j_begin_ = j_begin[b];
+            }
+            for (idx_t jj = 0; jj < stencil_width_; ++jj) {
+                for (idx_t b = 0; b < nb; ++b) {
+                    j_row[b] = j_begin[b] + jj;
+                }
+                compute_west_(nb, x + p0, j_row.data(), i_begin.data());
+                for (idx_t b = 0; b < nb; ++b) {
+                    stencil[p0 + b].i_begin_[jj] = i_begin[b] - stencil_begin_;
+                }
+            }
+        }
+    }
 };
 
 
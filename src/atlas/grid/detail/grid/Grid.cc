@@ -117,6 +117,26 @@ Grid::~Grid() {
     }
 }
 
+void Grid::fill_xy(idx_t begin, idx_t end, double xy[]) const {
+    ATLAS_ASSERT(0 <= begin && begin <= end && end <= size());
+    if (begin == end) {
+        return;
+    }
+    auto it = xy_begin();
+    *it += begin;
+    PointXY p;
+    for (idx_t n = 0; n < end - begin; ++n) {
+        it->next(p);
+        xy[2 * n + 0] = p[0];
+        xy[2 * n + 1] = p[1];
+    }
+}
+
+void Grid::fill_lonlat(idx_t begin, idx_t end, double lonlat[]) const {
+    fill_xy(begin, end, lonlat);
+    projection_.xy2lonlat(end - begin, lonlat, lonlat + 1, lonlat, lonlat + 1, 2);
+}
+
 Grid::uid_t Grid::uid() const {
     if (uid_.empty()) {
         uid_ = hash();
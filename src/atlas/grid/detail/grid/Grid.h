@@ -124,6 +124,15 @@ public:  // methods
     virtual std::unique_ptr<IteratorLonLat> lonlat_begin() const = 0;
     virtual std::unique_ptr<IteratorLonLat> lonlat_end() const   = 0;
 
+    /// @brief Fill xy coordinates of grid points with index in [begin, end) as interleaved pairs,
+    /// i.e. xy[2*(n-begin)+XX] and xy[2*(n-begin)+YY] for point n.
+    /// The default implementation advances an iterator; derived grids compute the points directly.
+    virtual void fill_xy(idx_t begin, idx_t end, double xy[]) const;
+
+    /// @brief Fill lonlat coordinates of grid points with index in [begin, end) as interleaved pairs,
+    /// using fill_xy followed by one batched projection.
+    virtual void fill_lonlat(idx_t begin, idx_t end, double lonlat[]) const;
+
     void attachObserver(GridObserver&) const;
     void detachObserver(GridObserver&) const;
 
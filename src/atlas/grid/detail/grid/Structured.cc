@@ -641,6 +641,23 @@ void Structured::computeTruePeriodicity() {
     periodic_x_ = points_equal(Pxmin, Pxmax);
 }
 
+void Structured::fill_xy(idx_t begin, idx_t end, double xy[]) const {
+    ATLAS_ASSERT(0 <= begin && begin <= end && end <= size());
+    if (begin == end) {
+        return;
+    }
+    idx_t i, j;
+    index2ij(begin, i, j);
+    for (idx_t n = begin; n < end; ++j, i = 0) {
+        const idx_t i_end = std::min<idx_t>(nx_[j], i + (end - n));
+        double* p         = xy + 2 * (n - begin);
+        for (; i < i_end; ++i, ++n, p += 2) {
+            p[0] = x(i, j);
+            p[1] = y(j);
+        }
+    }
+}
+
 void Structured::print(std::ostream& os) const {
     os << "Structured(Name:" << name() << ")";
 }
@@ -12,6 +12,7 @@
 
 #include <array>
 #include <memory>
+#include <vector>
 
 #include "atlas/grid/Spacing.h"
 #include "atlas/grid/detail/grid/Grid.h"
@@ -49,14 +50,35 @@ private:
         idx_t ny_;
     };
     struct ComputePointLonLat {
+        // Points are projected one latitude row at a time, using the batched projection
         ComputePointLonLat(const Structured& grid): grid_(grid), ny_(grid_.ny()) {}
         void operator()(idx_t i, idx_t j, PointLonLat& point) {
             if (j < ny_) {  // likely
-                grid_.lonlat(i, j, point.data());
+                if (j != j_) {
+                    compute_row(j);
+                }
+                if (i < nx_) {  // likely
+                    point = PointLonLat{row_[2 * i], row_[2 * i + 1]};
+                }
+                else {
+                    grid_.lonlat(i, j, point.data());
+                }
             }
         }
+        void compute_row(idx_t j) {
+            j_  = j;
+            nx_ = grid_.nx(j);
+            row_.resize(2 * nx_);
+            for (idx_t i = 0; i < nx_; ++i) {
+                grid_.xy(i, j, row_.data() + 2 * i);
+            }
+            grid_.projection().xy2lonlat(nx_, row_.data(), row_.data() + 1, row_.data(), row_.data() + 1, 2);
+        }
         const Structured& grid_;
         idx_t ny_;
+        idx_t j_{-1};
+        idx_t nx_{0};
+        std::vector<double> row_;
     };
 
     template <typename Base, typename ComputePoint>
@@ -349,6 +371,8 @@ public:
         return std::make_unique<IteratorLonLat>(*this, false);
     }
 
+    virtual void fill_xy(idx_t begin, idx_t end, double xy[]) const override;
+
     gidx_t index(idx_t i, idx_t j) const { return jglooff_[j] + i; }
 
     void index2ij(gidx_t gidx, idx_t& i, idx_t& j) const {
@@ -10,6 +10,7 @@
 
 #include "atlas/grid/detail/grid/Unstructured.h"
 
+#include <cstdint>
 #include <initializer_list>
 #include <iomanip>
 #include <limits>
@@ -28,6 +29,7 @@
 #include "atlas/option.h"
 #include "atlas/runtime/Exception.h"
 #include "atlas/runtime/Log.h"
+#include "atlas/util/ContentHash.h"
 #include "atlas/util/CoordinateEnums.h"
 #include "atlas/util/NormaliseLongitude.h"
 
@@ -173,13 +175,12 @@ Grid::uid_t Unstructured::name() const {
 void Unstructured::hash(eckit::Hash& h) const {
     ATLAS_ASSERT(points_ != nullptr);
 
+    // Streaming all points through eckit::Hash is serial and slow for large grids, so only the size and a
+    // parallel content hash of the points are added.
     const std::vector<PointXY>& pts = *points_;
-    h.add(&pts[0], sizeof(PointXY) * pts.size());
-
-    for (idx_t i = 0, N = static_cast<idx_t>(pts.size()); i < N; i++) {
-        const PointXY& p = pts[i];
-        h << p.x() << p.y();
-    }
+    const std::uint64_t digest      = util::content_hash(pts.data(), sizeof(PointXY) * pts.size());
+    h.add(long(pts.size()));
+    h.add(&digest, sizeof(digest));
 
     projection().hash(h);
 }
@@ -188,6 +189,15 @@ RectangularLonLatDomain Unstructured::lonlatBoundingBox() const {
     return projection_ ? projection_.lonlatBoundingBox(domain_) : domain_;
 }
 
+void Unstructured::fill_xy(idx_t begin, idx_t end, double xy[]) const {
+    ATLAS_ASSERT(0 <= begin && begin <= end && end <= size());
+    const PointXY* points = points_->data();
+    for (idx_t n = begin; n < end; ++n, xy += 2) {
+        xy[0] = points[n][0];
+        xy[1] = points[n][1];
+    }
+}
+
 idx_t Unstructured::size() const {
     ATLAS_ASSERT(points_ != nullptr);
     return static_cast<idx_t>(points_->size());
@@ -187,6 +187,8 @@ public:  // methods
         return std::make_unique<IteratorLonLat>(*this, false);
     }
 
+    virtual void fill_xy(idx_t begin, idx_t end, double xy[]) const override;
+
     Config meshgenerator() const override;
     Config partitioner() const override;
 
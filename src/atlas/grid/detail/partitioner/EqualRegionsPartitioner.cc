@@ -12,12 +12,12 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstdint>
 #include <ctime>
 #include <functional>
 #include <iostream>
 #include <vector>
 
-#include "atlas/grid/Iterator.h"
 #include "atlas/grid/StructuredGrid.h"
 #include "atlas/parallel/mpi/Buffer.h"
 #include "atlas/parallel/mpi/mpi.h"
@@ -41,30 +41,6 @@ static bool valid_mpi_size(size_t size) {
     return size < size_t(std::numeric_limits<int>::max());
 }
 
-
-template <class Iterator, class Sentinel = Iterator>
-struct range_t {
-    Iterator b;
-    Sentinel e;
-    Iterator begin() const { return b; }
-    Sentinel end() const { return e; }
-    // unused:
-    // bool empty() const { return begin() == end(); }
-};
-
-template <class Iterator, class Sentinel>
-range_t<Iterator, Sentinel> range(Iterator b, Sentinel e) {
-    return {b, e};
-}
-
-template <typename Container, typename Int>
-range_t<typename Container::const_iterator, typename Container::const_iterator> subrange(
-    const Container& c, std::initializer_list<Int>&& _range) {
-    const Int rbegin = _range.begin()[0];
-    const Int rend   = _range.begin()[1];
-    return range(c.begin() + rbegin, c.begin() + rend);
-}
-
 }  // namespace
 
 double gamma(const double& x) {
@@ -525,6 +501,20 @@ bool compare_WE_NS(const EqualRegionsPartitioner::NodeInt& node1, const EqualReg
     return false;
 }
 
+// Radix sort keys equivalent to compare_NS_WE and compare_WE_NS: flipping the sign bit orders signed
+// coordinates as unsigned, and complementing reverses the order.
+std::uint64_t radix_key(int v) {
+    return static_cast<std::uint32_t>(v) ^ std::uint32_t(0x80000000);
+}
+
+std::uint64_t key_NS_WE(const EqualRegionsPartitioner::NodeInt& node) {
+    return ((~radix_key(node.y) & 0xffffffff) << 32) | radix_key(node.x);
+}
+
+std::uint64_t key_WE_NS(const EqualRegionsPartitioner::NodeInt& node) {
+    return (radix_key(node.x) << 32) | (~radix_key(node.y) & 0xffffffff);
+}
+
 void EqualRegionsPartitioner::partition(int nb_nodes, NodeInt nodes[], int part[]) const {
     ATLAS_TRACE("EqualRegionsPartitioner::partition");
 
@@ -563,7 +553,7 @@ void EqualRegionsPartitioner::partition(int nb_nodes, NodeInt nodes[], int part[
             count.push_back(chunk_size + (remainder-- > 0 ? 1 : 0));
             end += count.back();
         }
-        std::sort(nodes + begin, nodes + end, compare_WE_NS);
+        omp::radix_sort(nodes + begin, nodes + end, key_WE_NS);
     }
 
     /*
@@ -715,68 +705,26 @@ void EqualRegionsPartitioner::partition(const Grid& grid, int part[]) const {
                     atlas::vector<NodeInt> w_nodes(w_size);
                     int* w_nodes_buffer = reinterpret_cast<int*>(w_nodes.data());
 
-                    if (coordinates_ == Coordinates::XY) {
-                        ATLAS_TRACE_SCOPE("create one bit - Coordinates::XY") {
-                            if (true)  // optimized experimental when true (still need to
-                            // benchmark)
-                            {
-                                int i = w_begin;
-                                int j(0);
-                                for (const auto& point : subrange(grid.xy(), {w_begin, w_end})) {
-                                    w_nodes[j].x = microdeg(point[0]);
-                                    w_nodes[j].y = microdeg(point[1]);
-                                    w_nodes[j].n = i++;
-                                    ++j;
-                                }
+                    if (coordinates_ == Coordinates::XY || coordinates_ == Coordinates::LONLAT) {
+                        ATLAS_TRACE_SCOPE("create one bit") {
+                            std::vector<double> crd(2 * size_t(w_size));
+                            if (coordinates_ == Coordinates::XY) {
+                                grid.fill_xy(w_begin, w_end, crd.data());
                             }
                             else {
-                                idx_t i(0);
-                                idx_t j(0);
-                                for (const auto& point : grid.xy()) {
-                                    if (i >= w_begin && i < w_end) {
-                                        w_nodes[j].x = microdeg(point[0]);
-                                        w_nodes[j].y = microdeg(point[1]);
-                                        w_nodes[j].n = i;
-                                        ++j;
-                                    }
-                                    ++i;
-                                }
+                                grid.fill_lonlat(w_begin, w_end, crd.data());
                             }
-                        }
-                    }
-                    else if (coordinates_ == Coordinates::LONLAT) {
-                        ATLAS_TRACE_SCOPE("create one bit - Coordinates::LONLAT") {
-                            if (true)  // optimized experimental when true (still need to
-                            // benchmark)
-                            {
-                                int i = w_begin;
-                                int j(0);
-                                for (const auto& point : subrange(grid.lonlat(), {w_begin, w_end})) {
-                                    w_nodes[j].x = microdeg(point[0]);
-                                    w_nodes[j].y = microdeg(point[1]);
-                                    w_nodes[j].n = i++;
-                                    ++j;
-                                }
-                            }
-                            else {
-                                idx_t i(0);
-                                idx_t j(0);
-                                for (const auto& point : grid.xy()) {
-                                    if (i >= w_begin && i < w_end) {
-                                        w_nodes[j].x = microdeg(point[0]);
-                                        w_nodes[j].y = microdeg(point[1]);
-                                        w_nodes[j].n = i;
-                                        ++j;
-                                    }
-                                    ++i;
-                                }
+                            for (idx_t j = 0; j < w_size; ++j) {
+                                w_nodes[j].x = microdeg(crd[2 * j + 0]);
+                                w_nodes[j].y = microdeg(crd[2 * j + 1]);
+                                w_nodes[j].n = w_begin + j;
                             }
                         }
                     }
                     else {
                         ATLAS_THROW_EXCEPTION("Should not be here");
                     }
-                    ATLAS_TRACE_SCOPE("sort one bit") { omp::sort(w_nodes.begin(), w_nodes.end(), compare_NS_WE); }
+                    ATLAS_TRACE_SCOPE("sort one bit") { omp::radix_sort(w_nodes.begin(), w_nodes.end(), key_NS_WE); }
                     ATLAS_TRACE_SCOPE("send to rank0") {
                         ATLAS_ASSERT(valid_mpi_size(w_size * 3));
                         comm.send(w_nodes_buffer, w_size * 3, /* dest= */ 0, /* tag= */ 0);
@@ -870,7 +818,7 @@ void EqualRegionsPartitioner::partition(const Grid& grid, int part[]) const {
                     }
                     if (work_rank == mpi_rank) {
                         ATLAS_TRACE_SCOPE("sort bit of band on each MPI rank") {
-                            omp::sort(nodes.data() + w_begin, nodes.data() + w_end, compare_WE_NS);
+                            omp::radix_sort(nodes.data() + w_begin, nodes.data() + w_end, key_WE_NS);
                         }
                         if (mpi_rank != w0_work_rank) {
                             ATLAS_TRACE_SCOPE("send bit of band to band leader " + std::to_string(w0_work_rank)) {
@@ -10,6 +10,7 @@
 
 #include "atlas/grid/detail/partitioner/MatchingMeshPartitionerLonLatPolygon.h"
 
+#include <algorithm>
 #include <iomanip>
 #include <sstream>
 #include <vector>
@@ -76,14 +77,18 @@ void MatchingMeshPartitionerLonLatPolygon::partition(const Grid& grid, int parti
             const idx_t begin = static_cast<idx_t>(thread_num * size_t(grid.size()) / num_threads);
             const idx_t end =
                 static_cast<idx_t>((thread_num + 1) * size_t(grid.size()) / num_threads);
-            size_t i = begin;
-            auto it = grid.lonlat().begin() + i;
-            for(; i < end; ++i, ++it) {
-                PointLonLat P = *it;
-                if (partitioning[i] < 0) {
-                    projection.lonlat2xy(P);
-                    P.normalise(west);
-                    partitioning[i] = poly.contains(P) ? mpi_rank : -1;
+            constexpr idx_t block_size = 1024;
+            std::vector<double> lonlat(2 * block_size);
+            for (idx_t block_begin = begin; block_begin < end; block_begin += block_size) {
+                const idx_t block_end = std::min(block_begin + block_size, end);
+                grid.fill_lonlat(block_begin, block_end, lonlat.data());
+                for (idx_t i = block_begin; i < block_end; ++i) {
+                    if (partitioning[i] < 0) {
+                        PointLonLat P(lonlat[2 * (i - block_begin) + LON], lonlat[2 * (i - block_begin) + LAT]);
+                        projection.lonlat2xy(P);
+                        P.normalise(west);
+                        partitioning[i] = poly.contains(P) ? mpi_rank : -1;
+                    }
                 }
             }
         }
@@ -10,6 +10,7 @@
 
 #include "atlas/grid/detail/partitioner/MatchingMeshPartitionerSphericalPolygon.h"
 
+#include <algorithm>
 #include <vector>
 
 #include "eckit/log/ProgressTimer.h"
@@ -65,11 +66,16 @@ void MatchingMeshPartitionerSphericalPolygon::partition(const Grid& grid, int pa
 
     {
         eckit::ProgressTimer timer("Partitioning", grid.size(), "point", double(10), atlas::Log::trace());
-        size_t i = 0;
-
-        for (const PointLonLat& P : grid.lonlat()) {
-            ++timer;
-            partitioning[i++] = at_the_pole(P) || poly.contains(P) ? mpi_rank : -1;
+        constexpr idx_t block_size = 1024;
+        std::vector<double> lonlat(2 * block_size);
+        for (idx_t block_begin = 0; block_begin < grid.size(); block_begin += block_size) {
+            const idx_t block_end = std::min(block_begin + block_size, grid.size());
+            grid.fill_lonlat(block_begin, block_end, lonlat.data());
+            for (idx_t i = block_begin; i < block_end; ++i) {
+                ++timer;
+                const PointLonLat P(lonlat[2 * (i - block_begin) + LON], lonlat[2 * (i - block_begin) + LAT]);
+                partitioning[i] = at_the_pole(P) || poly.contains(P) ? mpi_rank : -1;
+            }
         }
     }
 
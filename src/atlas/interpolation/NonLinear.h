@@ -67,6 +67,15 @@ struct NonLinear : DOXYGEN_HIDE(public util::ObjectHandle<nonlinear::NonLinear>)
      * @return if W was modified
      */
     bool execute(Matrix& W, const Field& f) const;
+
+    /**
+     * @brief Apply interpolation matrix with non-linear corrections computed on the fly, for all levels at once
+     * @param [in] W interpolation matrix, not modified
+     * @param [in] src source field
+     * @param [out] tgt target field
+     * @return if the fused application is supported (otherwise tgt is untouched)
+     */
+    bool apply(const Matrix& W, const Field& src, Field& tgt) const;
 };
 
 
@@ -105,6 +105,9 @@ void Method::interpolate_field_rank1(const Field& src, Field& tgt, const Matrix&
     auto tgt_v   = array::make_view<Value, 1>(tgt);
 
     if (nonLinear_(src)) {
+        if (nonLinear_.apply(W, src, tgt)) {
+            return;
+        }
         Matrix W_nl(W);  // copy (a big penalty -- copy-on-write would definitely be better)
         nonLinear_->execute(W_nl, src);
         sparse_matrix_multiply(W_nl, src_v, tgt_v, backend);
@@ -122,6 +125,11 @@ void Method::interpolate_field_rank2(const Field& src, Field& tgt, const Matrix&
     auto tgt_v = array::make_view<Value, 2>(tgt);
 
     if (nonLinear_(src)) {
+        // Fused kernel applying non-linear corrections level by level on the fly, without modifying W
+        if (nonLinear_.apply(W, src, tgt)) {
+            return;
+        }
+
         // We cannot apply the same matrix to full columns as e.g. missing values could be present in only certain parts.
 
         // Allocate temporary rank-1 fields corresponding to one horizontal level
@@ -161,72 +169,20 @@ void Method::interpolate_field_rank3(const Field& src, Field& tgt, const Matrix&
     auto src_v = array::make_view<Value, 3>(src);
     auto tgt_v = array::make_view<Value, 3>(tgt);
     if (not W.empty() && nonLinear_(src)) {
+        if (nonLinear_.apply(W, src, tgt)) {
+            return;
+        }
         ATLAS_ASSERT(false, "nonLinear interpolation not supported for rank-3 fields.");
     }
     sparse_matrix_multiply(W, src_v, tgt_v, sparse::backend::openmp());
 }
 
-template <typename Value>
-void Method::adjoint_interpolate_field_rank1(Field& src, const Field& tgt, const Matrix& W) const {
-    array::ArrayT<Value> tmp(src.shape());
-
-    auto tmp_v = array::make_view<Value, 1>(tmp);
-    auto src_v = array::make_view<Value, 1>(src);
-    auto tgt_v = array::make_view<Value, 1>(tgt);
-
-    tmp_v.assign(0.);
-
-    if (std::is_same<Value, float>::value) {
-        sparse_matrix_multiply(W, tgt_v, tmp_v, sparse::backend::openmp());
-    }
-    else {
-        sparse_matrix_multiply(W, tgt_v, tmp_v, sparse::Backend{linalg_backend_});
-    }
-
-
-    for (idx_t t = 0; t < tmp.shape(0); ++t) {
-        src_v(t) += tmp_v(t);
-    }
-}
-
-template <typename Value>
-void Method::adjoint_interpolate_field_rank2(Field& src, const Field& tgt, const Matrix& W) const {
-    array::ArrayT<Value> tmp(src.shape());
-
-    auto tmp_v = array::make_view<Value, 2>(tmp);
-    auto src_v = array::make_view<Value, 2>(src);
-    auto tgt_v = array::make_view<Value, 2>(tgt);
-
-    tmp_v.assign(0.);
-
-    sparse_matrix_multiply(W, tgt_v, tmp_v, sparse::backend::openmp());
-
-    for (idx_t t = 0; t < tmp.shape(0); ++t) {
-        for (idx_t k = 0; k < tmp.shape(1); ++k) {
-            src_v(t, k) += tmp_v(t, k);
-        }
-    }
-}
-
-template <typename Value>
-void Method::adjoint_interpolate_field_rank3(Field& src, const Field& tgt, const Matrix& W) const {
-    array::ArrayT<Value> tmp(src.shape());
-
-    auto tmp_v = array::make_view<Value, 3>(tmp);
-    auto src_v = array::make_view<Value, 3>(src);
-    auto tgt_v = array::make_view<Value, 3>(tgt);
-
-    tmp_v.assign(0.);
-
-    sparse_matrix_multiply(W, tgt_v, tmp_v, sparse::backend::openmp());
-
-    for (idx_t t = 0; t < tmp.shape(0); ++t) {
-        for (idx_t j = 0; j < tmp.shape(1); ++j) {
-            for (idx_t k = 0; k < tmp.shape(2); ++k) {
-                src_v(t, j, k) += tmp_v(t, j, k);
-            }
-        }
-    }
+template <typename Value, int Rank>
+void Method::adjoint_interpolate_field_rank(Field& src, const Field& tgt, const Matrix& W) const {
+    // src += W^T * tgt, directly from the forward matrix: no transposed matrix, no temporary array
+    auto src_v = array::make_view<Value, Rank>(src);
+    auto tgt_v = array::make_view<const Value, Rank>(tgt);
+    linalg::sparse_matrix_multiply_add_transpose(W, adjoint_colouring_, tgt_v, src_v);
 }
 
 void Method::check_compatibility(const Field& src, const Field& tgt, const Matrix& W) const {
@@ -270,16 +226,16 @@ void Method::adjoint_interpolate_field(Field& src, const Field& tgt, const Matri
     if (tgt.shape(0) == 0) {
         return;
     }
-    check_compatibility(tgt, src, W);
+    check_compatibility(src, tgt, W);
 
     if (src.rank() == 1) {
-        adjoint_interpolate_field_rank1<Value>(src, tgt, W);
+        adjoint_interpolate_field_rank<Value, 1>(src, tgt, W);
     }
     else if (src.rank() == 2) {
-        adjoint_interpolate_field_rank2<Value>(src, tgt, W);
+        adjoint_interpolate_field_rank<Value, 2>(src, tgt, W);
     }
     else if (src.rank() == 3) {
-        adjoint_interpolate_field_rank3<Value>(src, tgt, W);
+        adjoint_interpolate_field_rank<Value, 3>(src, tgt, W);
     }
     else {
         ATLAS_NOTIMPLEMENTED;
@@ -301,13 +257,9 @@ void Method::setup(const FunctionSpace& source, const FunctionSpace& target) {
     ATLAS_TRACE("atlas::interpolation::method::Method::setup(FunctionSpace, FunctionSpace)");
     this->do_setup(source, target);
 
-    if (adjoint_) {
-        Matrix tmp(*matrix_);
-
-        // if interpolation is matrix free then matrix->nonZeros() will be zero.
-        if (tmp.nonZeros() > 0) {
-            matrix_transpose_ = tmp.transpose();
-        }
+    if (adjoint_ && matrix_) {
+        // if interpolation is matrix free then matrix->nonZeros() will be zero, and the colouring remains empty.
+        adjoint_colouring_ = linalg::SparseMatrixRowColouring(*matrix_);
     }
 }
 
@@ -438,15 +390,15 @@ void Method::do_execute_adjoint(Field& src, const Field& tgt, Metadata&) const {
         throw_NotImplemented("Adjoint Interpolation does not work for fields that have missing data. ", Here());
     }
 
-    if (matrix_transpose_.empty()) {
+    if (adjoint_colouring_.empty()) {
         throw_AssertionFailed("Need to set 'adjoint coefficients' to true in config for adjoint interpolation to work");
     }
 
     if (src.datatype().kind() == array::DataType::KIND_REAL64) {
-        adjoint_interpolate_field<double>(src, tgt, matrix_transpose_);
+        adjoint_interpolate_field<double>(src, tgt, *matrix_);
     }
     else if (src.datatype().kind() == array::DataType::KIND_REAL32) {
-        adjoint_interpolate_field<float>(src, tgt, matrix_transpose_);
+        adjoint_interpolate_field<float>(src, tgt, *matrix_);
     }
     else {
         ATLAS_NOTIMPLEMENTED;
@@ -16,6 +16,7 @@
 
 #include "atlas/interpolation/Cache.h"
 #include "atlas/interpolation/NonLinear.h"
+#include "atlas/linalg/sparse/SparseMatrixMultiplyTranspose.h"
 #include "atlas/util/Metadata.h"
 #include "atlas/util/Object.h"
 #include "eckit/config/Configuration.h"
@@ -143,14 +144,8 @@ private:
     template <typename Value>
     void adjoint_interpolate_field(Field& src, const Field& tgt, const Matrix&) const;
 
-    template <typename Value>
-    void adjoint_interpolate_field_rank1(Field& src, const Field& tgt, const Matrix&) const;
-
-    template <typename Value>
-    void adjoint_interpolate_field_rank2(Field& src, const Field& tgt, const Matrix&) const;
-
-    template <typename Value>
-    void adjoint_interpolate_field_rank3(Field& src, const Field& tgt, const Matrix&) const;
+    template <typename Value, int Rank>
+    void adjoint_interpolate_field_rank(Field& src, const Field& tgt, const Matrix&) const;
 
     void check_compatibility(const Field& src, const Field& tgt, const Matrix& W) const;
 
@@ -161,7 +156,7 @@ private:
     NonLinear nonLinear_;
     std::string linalg_backend_;
     bool adjoint_{false};
-    Matrix matrix_transpose_;
+    linalg::SparseMatrixRowColouring adjoint_colouring_;  // replaces storage of transposed matrix
 
 protected:
     bool allow_halo_exchange_{true};
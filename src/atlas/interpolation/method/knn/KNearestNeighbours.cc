@@ -10,10 +10,8 @@
 
 #include "atlas/interpolation/method/knn/KNearestNeighbours.h"
 
-#include <limits>
-
-#include "eckit/log/Plural.h"
-#include "eckit/types/FloatCompare.h"
+#include <algorithm>
+#include <vector>
 
 #include "atlas/array.h"
 #include "atlas/functionspace/NodeColumns.h"
@@ -87,31 +85,26 @@ void KNearestNeighbours::do_setup(const FunctionSpace& source, const FunctionSpa
     {
         Trace timer(Here(), "atlas::interpolation::method::KNearestNeighbour::do_setup()");
 
-        std::vector<double> weights;
-
         Log::debug() << "Computing interpolation weights for " << out_npts << " points." << std::endl;
-        for (size_t ip = 0; ip < out_npts; ++ip) {
-            if (ip && (ip % 1000 == 0)) {
-                timer.pause();
-                auto elapsed = timer.elapsed();
-                timer.resume();
-                auto rate = eckit::types::is_approximately_equal(elapsed, 0.) ? std::numeric_limits<double>::infinity()
-                                                                              : (ip / elapsed);
-                Log::debug() << eckit::BigNum(ip) << " (at " << size_t(rate) << " points/s)... after " << elapsed << " s" << std::endl;
-            }
 
-            // find the closest input points to the output point
-            auto nn = pTree_.closestPoints(PointLonLat{lonlat(ip, size_t(LON)), lonlat(ip, size_t(LAT))}, k_);
+        // find the closest input points to all output points at once
+        std::vector<PointLonLat> points(out_npts);
+        for (size_t ip = 0; ip < out_npts; ++ip) {
+            points[ip] = PointLonLat{lonlat(ip, size_t(LON)), lonlat(ip, size_t(LAT))};
+        }
+        const size_t npts = std::min<size_t>(k_, pTree_.size());
+        ATLAS_ASSERT(npts);
+        util::IndexKDTree::PayloadList payloads;
+        std::vector<double> distances;
+        pTree_.closestPoints(points, npts, payloads, distances);
 
+        std::vector<double> weights(npts);
+        for (size_t ip = 0; ip < out_npts; ++ip) {
             // calculate weights (individual and total, to normalise) using distance
             // squared
-            const size_t npts = nn.size();
-            ATLAS_ASSERT(npts);
-            weights.resize(npts, 0);
-
             double sum = 0;
             for (size_t j = 0; j < npts; ++j) {
-                const double d  = nn[j].distance();
+                const double d  = distances[ip * npts + j];
                 const double d2 = d * d;
 
                 weights[j] = 1. / (1. + d2);
@@ -121,7 +114,7 @@ void KNearestNeighbours::do_setup(const FunctionSpace& source, const FunctionSpa
 
             // insert weights into the matrix
             for (size_t j = 0; j < npts; ++j) {
-                size_t jp = nn[j].payload();
+                size_t jp = payloads[ip * npts + j];
                 ATLAS_ASSERT(jp < inp_npts,
                              "point found which is not covered within the halo of the source function space");
                 weights_triplets.emplace_back(ip, jp, weights[j] / sum);
@@ -8,6 +8,8 @@
  * nor does it submit to any jurisdiction. and Interpolation
  */
 
+#include <string>
+
 #include "eckit/config/Resource.h"
 #include "eckit/log/TraceTimer.h"
 
@@ -21,12 +23,26 @@
 #include "atlas/mesh/Nodes.h"
 #include "atlas/mesh/actions/BuildXYZField.h"
 #include "atlas/runtime/Trace.h"
+#include "atlas/util/Config.h"
 #include "atlas/util/CoordinateEnums.h"
 
 namespace atlas {
 namespace interpolation {
 namespace method {
 
+namespace {
+
+util::IndexKDTree create_tree(const Method::Config& config) {
+    // The "flat" kd-tree is built and searched with multiple threads
+    std::string type = "flat";
+    config.get("kdtree", type);
+    return util::IndexKDTree(util::Config("type", type));
+}
+
+}  // namespace
+
+KNearestNeighboursBase::KNearestNeighboursBase(const Config& config): Method(config), pTree_(create_tree(config)) {}
+
 void KNearestNeighboursBase::buildPointSearchTree(Mesh& meshSource, const mesh::Halo& _halo) {
     ATLAS_TRACE();
     eckit::TraceTimer<Atlas> tim("KNearestNeighboursBase::buildPointSearchTree()");
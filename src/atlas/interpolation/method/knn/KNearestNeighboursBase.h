@@ -23,7 +23,7 @@ namespace method {
 
 class KNearestNeighboursBase : public Method {
 public:
-    KNearestNeighboursBase(const Config& config): Method(config) {}
+    KNearestNeighboursBase(const Config& config);
     virtual ~KNearestNeighboursBase() override {}
 
 protected:
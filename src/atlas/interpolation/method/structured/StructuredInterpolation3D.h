@@ -13,6 +13,7 @@
 #include "atlas/interpolation/method/Method.h"
 
 #include <memory>
+#include <vector>
 
 #include "atlas/field/Field.h"
 #include "atlas/field/FieldSet.h"
@@ -27,6 +28,11 @@ namespace method {
  * @class StructuredInterpolation3D
  *
  * Three-dimensional interpolation making use of Structure of grid.
+ *
+ * Unless "matrix_free" is true, the stencils and weights of all target points are computed once
+ * during setup and stored, so that every execute only applies them to the given fields.
+ * This pays off when many fields are interpolated to the same target points, e.g. departure
+ * points in semi-Lagrangian advection. With "matrix_free" they are recomputed on every execute.
  */
 
 template <typename Kernel>
@@ -41,6 +47,8 @@ public:
 protected:
     void setup(const FunctionSpace& source);
 
+    void setup_stencils_and_weights();
+
     virtual const FunctionSpace& source() const override { return source_; }
 
     virtual const FunctionSpace& target() const override { return target_; }
@@ -79,6 +87,10 @@ protected:
     bool limiter_;
 
     std::unique_ptr<Kernel> kernel_;
+
+    // Computed in setup for every target point (and level) unless matrix_free
+    std::vector<typename Kernel::Stencil> stencils_;
+    std::vector<typename Kernel::Weights> weights_;
 };
 
 
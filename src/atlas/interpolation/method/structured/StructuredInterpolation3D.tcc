@@ -51,10 +51,6 @@ StructuredInterpolation3D<Kernel>::StructuredInterpolation3D( const Method::Conf
     limiter_{false} {
     config.get( "matrix_free", matrix_free_ );
     config.get( "limiter", limiter_ );
-
-    if ( not matrix_free_ ) {
-        throw_NotImplemented( "Matrix-free StructuredInterpolation3D not implemented", Here() );
-    }
 }
 
 
@@ -132,6 +128,80 @@ void StructuredInterpolation3D<Kernel>::print( std::ostream& ) const {
 template <typename Kernel>
 void StructuredInterpolation3D<Kernel>::setup( const FunctionSpace& source ) {
     kernel_.reset( new Kernel( source, util::Config( "limiter", limiter_ ) ) );
+
+    if ( not matrix_free_ ) {
+        setup_stencils_and_weights();
+    }
+}
+
+
+template <typename Kernel>
+void StructuredInterpolation3D<Kernel>::setup_stencils_and_weights() {
+    ATLAS_TRACE( "StructuredInterpolation<" + Kernel::className() + ">::setup_stencils_and_weights()" );
+
+    const Kernel& kernel = *kernel_;
+
+    auto compute = [&]( idx_t p, double x, double y, double z ) {
+        kernel.compute_stencil( x, y, z, stencils_[p] );
+        kernel.compute_weights( x, y, z, stencils_[p], weights_[p] );
+    };
+
+    if ( target_lonlat_ ) {
+        const idx_t out_npts = target_lonlat_.shape( 0 );
+
+        const auto ghost    = array::make_view<int, 1>( target_ghost_ );
+        const auto lonlat   = array::make_view<double, 2>( target_lonlat_ );
+        const auto vertical = array::make_view<double, 1>( target_vertical_ );
+
+        stencils_.resize( out_npts );
+        weights_.resize( out_npts );
+
+        const double convert_units = convert_units_multiplier( target_lonlat_ );
+        atlas_omp_parallel_for( idx_t n = 0; n < out_npts; ++n ) {
+            if ( not ghost( n ) ) {
+                compute( n, lonlat( n, LON ) * convert_units, lonlat( n, LAT ) * convert_units, vertical( n ) );
+            }
+        }
+    }
+    else if ( target_3d_ ) {
+        const idx_t out_npts = target_3d_.shape( 0 );
+        const idx_t out_nlev = target_3d_.shape( 1 );
+
+        const auto coords = array::make_view<const double, 3>( target_3d_ );
+
+        stencils_.resize( out_npts * out_nlev );
+        weights_.resize( out_npts * out_nlev );
+
+        const double convert_units = convert_units_multiplier( target_3d_ );
+        atlas_omp_parallel_for( idx_t n = 0; n < out_npts; ++n ) {
+            for ( idx_t k = 0; k < out_nlev; ++k ) {
+                compute( n * out_nlev + k, coords( n, k, LON ) * convert_units, coords( n, k, LAT ) * convert_units,
+                         coords( n, k, ZZ ) );
+            }
+        }
+    }
+    else if ( not target_xyz_.empty() ) {
+        const idx_t out_npts = target_xyz_[0].shape( 0 );
+        const idx_t out_nlev = target_xyz_[0].shape( 1 );
+
+        const auto xcoords = array::make_view<double, 2>( target_xyz_[LON] );
+        const auto ycoords = array::make_view<double, 2>( target_xyz_[LAT] );
+        const auto zcoords = array::make_view<double, 2>( target_xyz_[ZZ] );
+
+        stencils_.resize( out_npts * out_nlev );
+        weights_.resize( out_npts * out_nlev );
+
+        const double convert_units = convert_units_multiplier( target_xyz_[LON] );
+        atlas_omp_parallel_for( idx_t n = 0; n < out_npts; ++n ) {
+            for ( idx_t k = 0; k < out_nlev; ++k ) {
+                compute( n * out_nlev + k, xcoords( n, k ) * convert_units, ycoords( n, k ) * convert_units,
+                         zcoords( n, k ) );
+            }
+        }
+    }
+    else {
+        ATLAS_NOTIMPLEMENTED;
+    }
 }
 
 
@@ -143,12 +213,7 @@ void StructuredInterpolation3D<Kernel>::do_execute( const Field& src_field, Fiel
 
 
 template <typename Kernel>
-void StructuredInterpolation3D<Kernel>::do_execute( const FieldSet& src_fields, FieldSet& tgt_fields, Metadata& metadata ) const {
-    if ( not matrix_free_ ) {
-        Method::do_execute( src_fields, tgt_fields, metadata );
-        return;
-    }
-
+void StructuredInterpolation3D<Kernel>::do_execute( const FieldSet& src_fields, FieldSet& tgt_fields, Metadata& ) const {
     const idx_t N = src_fields.size();
     ATLAS_ASSERT( N == tgt_fields.size() );
 
@@ -229,6 +294,18 @@ void StructuredInterpolation3D<Kernel>::execute_impl( const Kernel& kernel, cons
             tgt_view.emplace_back( array::make_view<Value, TargetRank>( tgt_fields[i] ) );
         }
 
+        if ( not matrix_free_ ) {
+            ATLAS_ASSERT( idx_t( stencils_.size() ) == out_npts );
+            atlas_omp_parallel_for( idx_t n = 0; n < out_npts; ++n ) {
+                if ( not ghost( n ) ) {
+                    for ( idx_t i = 0; i < N; ++i ) {
+                        kernel.interpolate( stencils_[n], weights_[n], src_view[i], tgt_view[i], n );
+                    }
+                }
+            }
+            return;
+        }
+
         const double convert_units = convert_units_multiplier( target_lonlat_ );
         atlas_omp_parallel {
             typename Kernel::Stencil stencil;
@@ -270,6 +347,19 @@ void StructuredInterpolation3D<Kernel>::execute_impl( const Kernel& kernel, cons
             }
         }
 
+        if ( not matrix_free_ ) {
+            ATLAS_ASSERT( idx_t( stencils_.size() ) == out_npts * out_nlev );
+            atlas_omp_parallel_for( idx_t n = 0; n < out_npts; ++n ) {
+                for ( idx_t k = 0; k < out_nlev; ++k ) {
+                    const idx_t p = n * out_nlev + k;
+                    for ( idx_t i = 0; i < N; ++i ) {
+                        kernel.interpolate( stencils_[p], weights_[p], src_view[i], tgt_view[i], n, k );
+                    }
+                }
+            }
+            return;
+        }
+
         const double convert_units = convert_units_multiplier( target_3d_ );
 
         atlas_omp_parallel {
@@ -315,6 +405,19 @@ void StructuredInterpolation3D<Kernel>::execute_impl( const Kernel& kernel, cons
             }
         }
 
+        if ( not matrix_free_ ) {
+            ATLAS_ASSERT( idx_t( stencils_.size() ) == out_npts * out_nlev );
+            atlas_omp_parallel_for( idx_t n = 0; n < out_npts; ++n ) {
+                for ( idx_t k = 0; k < out_nlev; ++k ) {
+                    const idx_t p = n * out_nlev + k;
+                    for ( idx_t i = 0; i < N; ++i ) {
+                        kernel.interpolate( stencils_[p], weights_[p], src_view[i], tgt_view[i], n, k );
+                    }
+                }
+            }
+            return;
+        }
+
         const double convert_units = convert_units_multiplier( target_xyz_[LON] );
 
         atlas_omp_parallel {
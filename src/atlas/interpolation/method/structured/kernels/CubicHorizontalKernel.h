@@ -10,6 +10,8 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
 #include <cmath>
 #include <limits>
 
@@ -101,6 +103,30 @@ public:
 
     }
 
+    /// @brief Compute the stencils of npts points at once, see grid::ComputeHorizontalStencil
+    ///
+    /// As in compute_stencil, x[p] is shifted by 360 degrees when needed to keep the stencil within the halo.
+    template <typename stencil_t>
+    void compute_stencils(const idx_t npts, double x[], const double y[], stencil_t stencils[]) const {
+        compute_horizontal_stencil_(npts, x, y, stencils);
+        for (idx_t p = 0; p < npts; ++p) {
+            if (not stencil_within_halo(stencils[p])) {
+                compute_stencil(x[p], y[p], stencils[p]);
+            }
+        }
+    }
+
+    template <typename stencil_t>
+    bool stencil_within_halo(const stencil_t& stencil) const {
+        for (idx_t j = 0; j < stencil_width(); ++j) {
+            if (stencil.i(0, j) < src_.i_begin_halo(stencil.j(j)) ||
+                stencil.i(stencil_width() - 1, j) >= src_.i_end_halo(stencil.j(j))) {
+                return false;
+            }
+        }
+        return true;
+    }
+
     template <typename weights_t>
     void compute_weights(double x, const double y, weights_t& weights) const {
         Stencil stencil;
@@ -153,6 +179,67 @@ public:
         weights_j[3] = 1. - weights_j[0] - weights_j[1] - weights_j[2];
     }
 
+    /// @brief Compute the weights of npts points at once, for stencils computed with compute_stencils
+    ///
+    /// Per batch of points, the coordinates of the stencil points are first gathered in arrays indexed
+    /// [row][point], so that the weights are then evaluated in vectorisable loops over points.
+    template <typename stencil_t, typename weights_t>
+    void compute_weights(const idx_t npts, const double x[], const double y[], const stencil_t stencils[],
+                         weights_t weights[]) const {
+        constexpr idx_t batch = grid::ComputeHorizontalStencil::batch_size();
+        std::array<std::array<double, batch>, 4> x1, x2, yvec;
+        PointXY P1, P2;
+        for (idx_t p0 = 0; p0 < npts; p0 += batch) {
+            const idx_t nb = std::min(batch, npts - p0);
+            for (idx_t b = 0; b < nb; ++b) {
+                const auto& stencil = stencils[p0 + b];
+                for (idx_t j = 0; j < stencil_width(); ++j) {
+                    src_.compute_xy(stencil.i(1, j), stencil.j(j), P1);
+                    src_.compute_xy(stencil.i(2, j), stencil.j(j), P2);
+                    x1[j][b]   = P1.x();
+                    x2[j][b]   = P2.x();
+                    yvec[j][b] = P1.y();
+                }
+            }
+            for (idx_t j = 0; j < stencil_width(); ++j) {
+                for (idx_t b = 0; b < nb; ++b) {
+                    auto& weights_i                  = weights[p0 + b].weights_i[j];
+                    const double alpha               = (x2[j][b] - x[p0 + b]) / (x2[j][b] - x1[j][b]);
+                    const double alpha_sqr           = alpha * alpha;
+                    const double two_minus_alpha     = 2. - alpha;
+                    const double one_minus_alpha_sqr = 1. - alpha_sqr;
+                    weights_i[0]                     = -alpha * one_minus_alpha_sqr / 6.;
+                    weights_i[1]                     = 0.5 * alpha * (1. + alpha) * two_minus_alpha;
+                    weights_i[2]                     = 0.5 * one_minus_alpha_sqr * two_minus_alpha;
+                    weights_i[3]                     = 1. - weights_i[0] - weights_i[1] - weights_i[2];
+                }
+            }
+            // Compute weights in y-direction
+            for (idx_t b = 0; b < nb; ++b) {
+                const double dl12 = yvec[0][b] - yvec[1][b];
+                const double dl13 = yvec[0][b] - yvec[2][b];
+                const double dl14 = yvec[0][b] - yvec[3][b];
+                const double dl23 = yvec[1][b] - yvec[2][b];
+                const double dl24 = yvec[1][b] - yvec[3][b];
+                const double dl34 = yvec[2][b] - yvec[3][b];
+                const double dcl1 = dl12 * dl13 * dl14;
+                const double dcl2 = -dl12 * dl23 * dl24;
+                const double dcl3 = dl13 * dl23 * dl34;
+
+                const double dl1 = y[p0 + b] - yvec[0][b];
+                const double dl2 = y[p0 + b] - yvec[1][b];
+                const double dl3 = y[p0 + b] - yvec[2][b];
+                const double dl4 = y[p0 + b] - yvec[3][b];
+
+                auto& weights_j = weights[p0 + b].weights_j;
+                weights_j[0]    = (dl2 * dl3 * dl4) / dcl1;
+                weights_j[1]    = (dl1 * dl3 * dl4) / dcl2;
+                weights_j[2]    = (dl1 * dl2 * dl4) / dcl3;
+                weights_j[3]    = 1. - weights_j[0] - weights_j[1] - weights_j[2];
+            }
+        }
+    }
+
     template <typename stencil_t, typename weights_t, typename array_t>
     typename array_t::value_type interpolate(const stencil_t& stencil, const weights_t& weights,
                                              const array_t& input) const {
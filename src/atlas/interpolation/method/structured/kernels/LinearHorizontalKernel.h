@@ -10,6 +10,8 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
 #include <cmath>
 #include <limits>
 
@@ -93,6 +95,30 @@ public:
     }
 
 
+    /// @brief Compute the stencils of npts points at once, see grid::ComputeHorizontalStencil
+    ///
+    /// As in compute_stencil, x[p] is shifted by 360 degrees when needed to keep the stencil within the halo.
+    template <typename stencil_t>
+    void compute_stencils(const idx_t npts, double x[], const double y[], stencil_t stencils[]) const {
+        compute_horizontal_stencil_(npts, x, y, stencils);
+        for (idx_t p = 0; p < npts; ++p) {
+            if (not stencil_within_halo(stencils[p])) {
+                compute_stencil(x[p], y[p], stencils[p]);
+            }
+        }
+    }
+
+    template <typename stencil_t>
+    bool stencil_within_halo(const stencil_t& stencil) const {
+        for (idx_t j = 0; j < stencil_width(); ++j) {
+            if (stencil.i(0, j) < src_.i_begin_halo(stencil.j(j)) ||
+                stencil.i(stencil_width() - 1, j) >= src_.i_end_halo(stencil.j(j))) {
+                return false;
+            }
+        }
+        return true;
+    }
+
     template <typename weights_t>
     void compute_weights(double x, double y, weights_t& weights) const {
         Stencil stencil;
@@ -124,6 +150,46 @@ public:
         }
     }
 
+    /// @brief Compute the weights of npts points at once, for stencils computed with compute_stencils
+    ///
+    /// Per batch of points, the coordinates of the stencil points are first gathered in arrays indexed
+    /// [row][point], so that the weights are then evaluated in vectorisable loops over points.
+    template <typename stencil_t, typename weights_t>
+    void compute_weights(const idx_t npts, const double x[], const double y[], const stencil_t stencils[],
+                         weights_t weights[]) const {
+        constexpr idx_t batch = grid::ComputeHorizontalStencil::batch_size();
+        std::array<std::array<double, batch>, 2> x1, x2, yvec;
+        PointXY P1, P2;
+        for (idx_t p0 = 0; p0 < npts; p0 += batch) {
+            const idx_t nb = std::min(batch, npts - p0);
+            for (idx_t b = 0; b < nb; ++b) {
+                const auto& stencil = stencils[p0 + b];
+                for (idx_t j = 0; j < stencil_width(); ++j) {
+                    src_.compute_xy(stencil.i(0, j), stencil.j(j), P1);
+                    src_.compute_xy(stencil.i(1, j), stencil.j(j), P2);
+                    x1[j][b]   = P1.x();
+                    x2[j][b]   = P2.x();
+                    yvec[j][b] = P1.y();
+                }
+            }
+            for (idx_t j = 0; j < stencil_width(); ++j) {
+                for (idx_t b = 0; b < nb; ++b) {
+                    auto& weights_i    = weights[p0 + b].weights_i[j];
+                    const double alpha = (x2[j][b] - x[p0 + b]) / (x2[j][b] - x1[j][b]);
+                    weights_i[0]       = alpha;
+                    weights_i[1]       = 1. - alpha;
+                }
+            }
+            // Compute weights in y-direction
+            for (idx_t b = 0; b < nb; ++b) {
+                auto& weights_j    = weights[p0 + b].weights_j;
+                const double alpha = (yvec[1][b] - y[p0 + b]) / (yvec[1][b] - yvec[0][b]);
+                weights_j[0]       = alpha;
+                weights_j[1]       = 1. - alpha;
+            }
+        }
+    }
+
     template <typename stencil_t, typename weights_t, typename array_t>
     typename array_t::value_type interpolate(const stencil_t& stencil, const weights_t& weights,
                                              const array_t& input) const {
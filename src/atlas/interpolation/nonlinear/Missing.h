@@ -12,10 +12,14 @@
 
 #pragma once
 
+#include <vector>
+
 #include "eckit/types/FloatCompare.h"
 
+#include "atlas/array/LocalView.h"
 #include "atlas/field/MissingValue.h"
 #include "atlas/interpolation/nonlinear/NonLinear.h"
+#include "atlas/parallel/omp/omp.h"
 
 
 namespace atlas {
@@ -26,6 +30,126 @@ namespace nonlinear {
 struct Missing : NonLinear {
 private:
     bool applicable(const Field& f) const override { return field::MissingValue(f); }
+
+protected:
+    enum class Policy
+    {
+        IfAllMissing,
+        IfAnyMissing,
+        IfHeaviestMissing
+    };
+
+    /// View of a rank-1, -2 or -3 field as (point, level) with all non-horizontal dimensions merged
+    template <typename Value>
+    static array::LocalView<Value, 2> make_view_columns(const Field& field) {
+        ATLAS_ASSERT(field.datatype().kind() == array::DataType::kind<typename std::remove_const<Value>::type>());
+        Value* data = static_cast<Value*>(const_cast<Field&>(field).storage());
+        idx_t shape[2];
+        idx_t strides[2];
+        shape[0]   = field.shape(0);
+        strides[0] = field.stride(0);
+        if (field.rank() == 1) {
+            shape[1]   = 1;
+            strides[1] = 1;
+        }
+        else if (field.rank() == 2) {
+            shape[1]   = field.shape(1);
+            strides[1] = field.stride(1);
+        }
+        else if (field.rank() == 3) {
+            ATLAS_ASSERT(field.stride(1) == field.shape(2) * field.stride(2));
+            shape[1]   = field.shape(1) * field.shape(2);
+            strides[1] = field.stride(2);
+        }
+        else {
+            ATLAS_NOTIMPLEMENTED;
+        }
+        return array::LocalView<Value, 2>(data, shape, strides);
+    }
+
+    /**
+     * @brief Fused application of W with missing values rules, evaluated independently for each level.
+     * Weights of missing values are skipped and the remaining weights renormalised on the fly, so W is not modified
+     * and does not need to be copied. The rules are identical to the execute() variants which modify W.
+     */
+    template <typename T>
+    static void apply_missing(const Matrix& W, const Field& field_src, Field& field_tgt, Policy policy) {
+        field::MissingValue mv(field_src);
+        auto& missingValue = mv.ref();
+
+        ATLAS_ASSERT(field_src.rank() == field_tgt.rank());
+        auto src = make_view_columns<const T>(field_src);
+        auto tgt = make_view_columns<T>(field_tgt);
+
+        const idx_t Nk = src.shape(1);
+        ATLAS_ASSERT(tgt.shape(1) == Nk);
+        ATLAS_ASSERT(idx_t(W.cols()) <= src.shape(0));
+        ATLAS_ASSERT(idx_t(W.rows()) <= tgt.shape(0));
+
+        const auto outer  = W.outer();
+        const auto index  = W.inner();
+        const auto weight = W.data();
+        const idx_t rows  = static_cast<idx_t>(W.rows());
+
+        atlas_omp_parallel {
+            std::vector<Scalar> acc(Nk);
+            std::vector<Scalar> sum(Nk);
+            std::vector<idx_t> N_missing(Nk);
+            std::vector<idx_t> i_missing(Nk);
+
+            atlas_omp_for(idx_t r = 0; r < rows; ++r) {
+                const auto begin      = outer[r];
+                const auto end        = outer[r + 1];
+                const idx_t N_entries = static_cast<idx_t>(end - begin);
+
+                for (idx_t k = 0; k < Nk; ++k) {
+                    acc[k]       = 0.;
+                    sum[k]       = 0.;
+                    N_missing[k] = 0;
+                }
+
+                // first entry with maximum weight is the same for all levels
+                auto heaviest = begin;
+                for (auto c = begin; c < end; ++c) {
+                    if (weight[heaviest] < weight[c]) {
+                        heaviest = c;
+                    }
+                }
+
+                for (auto c = begin; c < end; ++c) {
+                    const idx_t n  = index[c];
+                    const Scalar w = weight[c];
+                    for (idx_t k = 0; k < Nk; ++k) {
+                        const T value = src(n, k);
+                        if (missingValue(value)) {
+                            ++N_missing[k];
+                            i_missing[k] = n;
+                        }
+                        else {
+                            acc[k] += w * value;
+                            sum[k] += w;
+                        }
+                    }
+                }
+
+                for (idx_t k = 0; k < Nk; ++k) {
+                    if (N_missing[k] == 0) {
+                        tgt(r, k) = static_cast<T>(acc[k]);
+                        continue;
+                    }
+                    bool force_missing = true;
+                    if (policy == Policy::IfAllMissing) {
+                        force_missing = N_missing[k] == N_entries || eckit::types::is_approximately_equal(sum[k], 0.);
+                    }
+                    else if (policy == Policy::IfHeaviestMissing) {
+                        force_missing = N_missing[k] == N_entries || missingValue(src(index[heaviest], k)) ||
+                                        eckit::types::is_approximately_equal(sum[k], 0.);
+                    }
+                    tgt(r, k) = force_missing ? src(i_missing[k], k) : static_cast<T>(acc[k] / sum[k]);
+                }
+            }
+        }
+    }
 };
 
 
@@ -100,6 +224,11 @@ struct MissingIfAllMissing : Missing {
         return modif;
     }
 
+    bool apply(const Matrix& W, const Field& src, Field& tgt) const override {
+        apply_missing<T>(W, src, tgt, Policy::IfAllMissing);
+        return true;
+    }
+
     static std::string static_type() { return "missing-if-all-missing"; }
 };
 
@@ -161,6 +290,11 @@ struct MissingIfAnyMissing : Missing {
         return modif;
     }
 
+    bool apply(const Matrix& W, const Field& src, Field& tgt) const override {
+        apply_missing<T>(W, src, tgt, Policy::IfAnyMissing);
+        return true;
+    }
+
     static std::string static_type() { return "missing-if-any-missing"; }
 };
 
@@ -242,6 +376,11 @@ struct MissingIfHeaviestMissing : Missing {
         return modif;
     }
 
+    bool apply(const Matrix& W, const Field& src, Field& tgt) const override {
+        apply_missing<T>(W, src, tgt, Policy::IfHeaviestMissing);
+        return true;
+    }
+
     static std::string static_type() { return "missing-if-heaviest-missing"; }
 };
 
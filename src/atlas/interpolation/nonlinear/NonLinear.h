@@ -66,6 +66,15 @@ public:
      */
     virtual bool execute(Matrix& W, const Field& f) const = 0;
 
+    /**
+     * @brief Apply interpolation matrix with non-linear corrections computed on the fly, for all levels at once
+     * @param [in] W interpolation matrix, not modified
+     * @param [in] src source field with missing values information
+     * @param [out] tgt target field
+     * @return if this NonLinear supports the fused application (otherwise use execute on a copy of W)
+     */
+    virtual bool apply(const Matrix& /*W*/, const Field& /*src*/, Field& /*tgt*/) const { return false; }
+
 protected:
     template <typename Value, int Rank>
     static array::ArrayView<typename std::add_const<Value>::type, Rank> make_view_field_values(const Field& field) {
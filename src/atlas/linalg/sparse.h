@@ -11,6 +11,7 @@
 
 #include "sparse/Backend.h"
 #include "sparse/SparseMatrixMultiply.h"
+#include "sparse/SparseMatrixMultiplyTranspose.h"
 
 namespace atlas {
 namespace linalg {}  // namespace linalg
@@ -0,0 +1,177 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#include "atlas/linalg/sparse/SparseMatrixMultiplyTranspose.h"
+
+#include <algorithm>
+#include <cstdint>
+
+#include "atlas/parallel/omp/omp.h"
+#include "atlas/runtime/Exception.h"
+#include "atlas/runtime/Trace.h"
+
+namespace atlas {
+namespace linalg {
+
+//----------------------------------------------------------------------------------------------------------------------
+
+SparseMatrixRowColouring::SparseMatrixRowColouring(const eckit::linalg::SparseMatrix& W) {
+    ATLAS_TRACE("SparseMatrixRowColouring");
+    const auto outer = W.outer();
+    const auto index = W.inner();
+    const idx_t rows = static_cast<idx_t>(W.rows());
+    const idx_t cols = static_cast<idx_t>(W.cols());
+
+    if (W.nonZeros() == 0) {
+        return;
+    }
+
+    // Greedy colouring, 64 colours per sweep, tracked with one bitmask per column.
+    // Rows that do not fit in the current sweep are deferred to the next sweep,
+    // which starts with fresh masks and 64 new colours.
+    std::vector<std::uint64_t> used(cols);
+    std::vector<idx_t> colour(rows);
+    std::vector<idx_t> remaining(rows);
+    for (idx_t r = 0; r < rows; ++r) {
+        remaining[r] = r;
+    }
+
+    idx_t first_colour = 0;
+    idx_t max_colour   = -1;
+    while (not remaining.empty()) {
+        std::fill(used.begin(), used.end(), 0);
+        std::vector<idx_t> deferred;
+        for (idx_t r : remaining) {
+            std::uint64_t forbidden = 0;
+            for (auto c = outer[r]; c < outer[r + 1]; ++c) {
+                forbidden |= used[index[c]];
+            }
+            if (~forbidden == 0) {
+                deferred.emplace_back(r);
+                continue;
+            }
+            int bit = 0;
+            while (forbidden & (std::uint64_t(1) << bit)) {
+                ++bit;
+            }
+            for (auto c = outer[r]; c < outer[r + 1]; ++c) {
+                used[index[c]] |= (std::uint64_t(1) << bit);
+            }
+            colour[r]  = first_colour + bit;
+            max_colour = std::max(max_colour, colour[r]);
+        }
+        remaining.swap(deferred);
+        first_colour += 64;
+    }
+
+    // Counting sort of rows by colour
+    const idx_t ncolours = max_colour + 1;
+    offsets_.assign(ncolours + 1, 0);
+    for (idx_t r = 0; r < rows; ++r) {
+        ++offsets_[colour[r] + 1];
+    }
+    for (idx_t c = 0; c < ncolours; ++c) {
+        offsets_[c + 1] += offsets_[c];
+    }
+    rows_.resize(rows);
+    std::vector<idx_t> pos(offsets_.begin(), offsets_.end() - 1);
+    for (idx_t r = 0; r < rows; ++r) {
+        rows_[pos[colour[r]]++] = r;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+namespace sparse {
+
+template <typename SourceValue, typename TargetValue>
+void SparseMatrixMultiplyAddTranspose<1, SourceValue, TargetValue>::apply(const eckit::linalg::SparseMatrix& W,
+                                                                      const SparseMatrixRowColouring& colouring,
+                                                                      const View<SourceValue, 1>& src,
+                                                                      View<TargetValue, 1>& tgt) {
+    using Value       = TargetValue;
+    const auto outer  = W.outer();
+    const auto index  = W.inner();
+    const auto weight = W.data();
+    const idx_t* rows = colouring.rows();
+
+    ATLAS_ASSERT(src.shape(0) >= W.rows());
+    ATLAS_ASSERT(tgt.shape(0) >= W.cols());
+
+    for (idx_t colour = 0; colour < colouring.colours(); ++colour) {
+        const idx_t begin = colouring.begin(colour);
+        const idx_t end   = colouring.end(colour);
+        atlas_omp_parallel_for(idx_t jr = begin; jr < end; ++jr) {
+            const idx_t r   = rows[jr];
+            const Value x_r = src[r];
+            for (auto c = outer[r]; c < outer[r + 1]; ++c) {
+                tgt[index[c]] += static_cast<Value>(weight[c]) * x_r;
+            }
+        }
+    }
+}
+
+template <typename SourceValue, typename TargetValue>
+void SparseMatrixMultiplyAddTranspose<2, SourceValue, TargetValue>::apply(const eckit::linalg::SparseMatrix& W,
+                                                                      const SparseMatrixRowColouring& colouring,
+                                                                      const View<SourceValue, 2>& src,
+                                                                      View<TargetValue, 2>& tgt) {
+    using Value       = TargetValue;
+    const auto outer  = W.outer();
+    const auto index  = W.inner();
+    const auto weight = W.data();
+    const idx_t* rows = colouring.rows();
+    const idx_t Nk    = src.shape(1);
+
+    ATLAS_ASSERT(src.shape(0) >= W.rows());
+    ATLAS_ASSERT(tgt.shape(0) >= W.cols());
+    ATLAS_ASSERT(tgt.shape(1) == Nk);
+
+    for (idx_t colour = 0; colour < colouring.colours(); ++colour) {
+        const idx_t begin = colouring.begin(colour);
+        const idx_t end   = colouring.end(colour);
+        atlas_omp_parallel_for(idx_t jr = begin; jr < end; ++jr) {
+            const idx_t r = rows[jr];
+            for (auto c = outer[r]; c < outer[r + 1]; ++c) {
+                const idx_t n = index[c];
+                const Value w = static_cast<Value>(weight[c]);
+                for (idx_t k = 0; k < Nk; ++k) {
+                    tgt(n, k) += w * src(r, k);
+                }
+            }
+        }
+    }
+}
+
+template <typename SourceValue, typename TargetValue>
+void SparseMatrixMultiplyAddTranspose<3, SourceValue, TargetValue>::apply(const eckit::linalg::SparseMatrix& W,
+                                                                      const SparseMatrixRowColouring& colouring,
+                                                                      const View<SourceValue, 3>& src,
+                                                                      View<TargetValue, 3>& tgt) {
+    // Views created through linalg::make_view are contiguous, so the trailing dimensions can be merged
+    auto src_v = View<SourceValue, 2>(src.data(), array::make_shape(src.shape(0), src.shape(1) * src.shape(2)));
+    auto tgt_v = View<TargetValue, 2>(tgt.data(), array::make_shape(tgt.shape(0), tgt.shape(1) * tgt.shape(2)));
+    SparseMatrixMultiplyAddTranspose<2, SourceValue, TargetValue>::apply(W, colouring, src_v, tgt_v);
+}
+
+#define EXPLICIT_TEMPLATE_INSTANTIATION(TYPE)                                \
+    template struct SparseMatrixMultiplyAddTranspose<1, TYPE const, TYPE>; \
+    template struct SparseMatrixMultiplyAddTranspose<2, TYPE const, TYPE>; \
+    template struct SparseMatrixMultiplyAddTranspose<3, TYPE const, TYPE>;
+
+EXPLICIT_TEMPLATE_INSTANTIATION(double);
+EXPLICIT_TEMPLATE_INSTANTIATION(float);
+
+}  // namespace sparse
+
+//----------------------------------------------------------------------------------------------------------------------
+
+}  // namespace linalg
+}  // namespace atlas
@@ -0,0 +1,101 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#pragma once
+
+#include <vector>
+
+#include "eckit/linalg/SparseMatrix.h"
+
+#include "atlas/library/config.h"
+#include "atlas/linalg/Introspection.h"
+#include "atlas/linalg/View.h"
+
+namespace atlas {
+namespace linalg {
+
+/// @brief Partitioning of the rows of a sparse matrix in groups ("colours") such that
+///        no two rows of the same colour reference the same column.
+///
+/// The scatter-add  y += W^T x  can then be computed directly from the CSR storage of W,
+/// threading over the rows within one colour without write conflicts on y.
+/// The colouring only depends on the sparsity pattern, and costs one index per row,
+/// which is much less than storing the transposed matrix.
+class SparseMatrixRowColouring {
+public:
+    SparseMatrixRowColouring() = default;
+    explicit SparseMatrixRowColouring(const eckit::linalg::SparseMatrix&);
+
+    idx_t colours() const { return offsets_.empty() ? 0 : static_cast<idx_t>(offsets_.size() - 1); }
+
+    /// Range [begin(colour),end(colour)) in rows() for given colour
+    idx_t begin(idx_t colour) const { return offsets_[colour]; }
+    idx_t end(idx_t colour) const { return offsets_[colour + 1]; }
+
+    /// Row indices of W, sorted by colour
+    const idx_t* rows() const { return rows_.data(); }
+
+    bool empty() const { return rows_.empty(); }
+
+    size_t footprint() const { return sizeof(idx_t) * (offsets_.capacity() + rows_.capacity()); }
+
+private:
+    std::vector<idx_t> offsets_;
+    std::vector<idx_t> rows_;
+};
+
+/// @brief Compute  tgt += W^T * src  without forming W^T
+///
+/// src has the shape of the rows of W (first dimension), tgt has the shape of its columns.
+/// Only Indexing::layout_left is supported, i.e. the first index is the point index.
+template <typename Matrix, typename SourceView, typename TargetView>
+void sparse_matrix_multiply_add_transpose(const Matrix& W, const SparseMatrixRowColouring& colouring,
+                                          const SourceView& src, TargetView& tgt);
+
+namespace sparse {
+
+template <int Rank, typename SourceValue, typename TargetValue>
+struct SparseMatrixMultiplyAddTranspose;
+
+template <typename SourceValue, typename TargetValue>
+struct SparseMatrixMultiplyAddTranspose<1, SourceValue, TargetValue> {
+    static void apply(const eckit::linalg::SparseMatrix&, const SparseMatrixRowColouring&, const View<SourceValue, 1>&,
+                      View<TargetValue, 1>&);
+};
+
+template <typename SourceValue, typename TargetValue>
+struct SparseMatrixMultiplyAddTranspose<2, SourceValue, TargetValue> {
+    static void apply(const eckit::linalg::SparseMatrix&, const SparseMatrixRowColouring&, const View<SourceValue, 2>&,
+                      View<TargetValue, 2>&);
+};
+
+template <typename SourceValue, typename TargetValue>
+struct SparseMatrixMultiplyAddTranspose<3, SourceValue, TargetValue> {
+    static void apply(const eckit::linalg::SparseMatrix&, const SparseMatrixRowColouring&, const View<SourceValue, 3>&,
+                      View<TargetValue, 3>&);
+};
+
+}  // namespace sparse
+
+template <typename Matrix, typename SourceView, typename TargetView>
+void sparse_matrix_multiply_add_transpose(const Matrix& W, const SparseMatrixRowColouring& colouring,
+                                          const SourceView& src, TargetView& tgt) {
+    using SourceValue      = const typename std::remove_const<introspection::value_type<SourceView>>::type;
+    using TargetValue      = typename std::remove_const<introspection::value_type<TargetView>>::type;
+    constexpr int src_rank = introspection::rank<SourceView>();
+    constexpr int tgt_rank = introspection::rank<TargetView>();
+    static_assert(src_rank == tgt_rank, "src and tgt need same rank");
+    auto src_v = make_view(src);
+    auto tgt_v = make_view(tgt);
+    sparse::SparseMatrixMultiplyAddTranspose<src_rank, SourceValue, TargetValue>::apply(W, colouring, src_v, tgt_v);
+}
+
+}  // namespace linalg
+}  // namespace atlas
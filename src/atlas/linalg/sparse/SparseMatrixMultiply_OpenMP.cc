@@ -10,6 +10,7 @@
 
 #include "atlas/linalg/sparse/SparseMatrixMultiply_OpenMP.h"
 
+#include "atlas/array/ContiguousView.h"
 #include "atlas/parallel/omp/omp.h"
 #include "atlas/runtime/Exception.h"
 
@@ -40,19 +41,20 @@ void SparseMatrixMultiply<backend::openmp, Indexing::layout_left, 1, SourceValue
 }
 
 
-template <typename SourceValue, typename TargetValue>
-void SparseMatrixMultiply<backend::openmp, Indexing::layout_left, 2, SourceValue, TargetValue>::apply(
-    const SparseMatrix& W, const View<SourceValue, 2>& src, View<TargetValue, 2>& tgt, const Configuration&) {
-    using Value       = TargetValue;
+namespace {
+
+// Kernels are templated on the view type, so that views with unit innermost stride known at compile time
+// (array::ContiguousView) vectorise the innermost loop
+
+template <typename SourceView, typename TargetView>
+void spmm_layout_left_2(const SparseMatrix& W, const SourceView& src, TargetView& tgt) {
+    using Value       = typename TargetView::value_type;
     const auto outer  = W.outer();
     const auto index  = W.inner();
     const auto weight = W.data();
     const idx_t rows  = static_cast<idx_t>(W.rows());
     const idx_t Nk    = src.shape(1);
 
-    ATLAS_ASSERT(src.shape(0) >= W.cols());
-    ATLAS_ASSERT(tgt.shape(0) >= W.rows());
-
     atlas_omp_parallel_for(idx_t r = 0; r < rows; ++r) {
         for (idx_t k = 0; k < Nk; ++k) {
             tgt(r, k) = 0.;
@@ -67,18 +69,9 @@ void SparseMatrixMultiply<backend::openmp, Indexing::layout_left, 2, SourceValue
     }
 }
 
-template <typename SourceValue, typename TargetValue>
-void SparseMatrixMultiply<backend::openmp, Indexing::layout_left, 3, SourceValue, TargetValue>::apply(
-    const SparseMatrix& W, const View<SourceValue, 3>& src, View<TargetValue, 3>& tgt, const Configuration& config) {
-    if (src.contiguous() && tgt.contiguous()) {
-        // We can take a more optimized route by reducing rank
-        auto src_v = View<SourceValue, 2>(src.data(), array::make_shape(src.shape(0), src.stride(0)));
-        auto tgt_v = View<TargetValue, 2>(tgt.data(), array::make_shape(tgt.shape(0), tgt.stride(0)));
-        SparseMatrixMultiply<backend::openmp, Indexing::layout_left, 2, SourceValue, TargetValue>::apply(W, src_v,
-                                                                                                         tgt_v, config);
-        return;
-    }
-    using Value       = TargetValue;
+template <typename SourceView, typename TargetView>
+void spmm_layout_left_3(const SparseMatrix& W, const SourceView& src, TargetView& tgt) {
+    using Value       = typename TargetView::value_type;
     const auto outer  = W.outer();
     const auto index  = W.inner();
     const auto weight = W.data();
@@ -104,6 +97,41 @@ void SparseMatrixMultiply<backend::openmp, Indexing::layout_left, 3, SourceValue
     }
 }
 
+}  // namespace
+
+template <typename SourceValue, typename TargetValue>
+void SparseMatrixMultiply<backend::openmp, Indexing::layout_left, 2, SourceValue, TargetValue>::apply(
+    const SparseMatrix& W, const View<SourceValue, 2>& src, View<TargetValue, 2>& tgt, const Configuration&) {
+    ATLAS_ASSERT(src.shape(0) >= W.cols());
+    ATLAS_ASSERT(tgt.shape(0) >= W.rows());
+
+    if (array::is_contiguous_innermost(src) && array::is_contiguous_innermost(tgt)) {
+        auto tgt_c = array::make_contiguous_view(tgt);
+        spmm_layout_left_2(W, array::make_contiguous_view(src), tgt_c);
+        return;
+    }
+    spmm_layout_left_2(W, src, tgt);
+}
+
+template <typename SourceValue, typename TargetValue>
+void SparseMatrixMultiply<backend::openmp, Indexing::layout_left, 3, SourceValue, TargetValue>::apply(
+    const SparseMatrix& W, const View<SourceValue, 3>& src, View<TargetValue, 3>& tgt, const Configuration& config) {
+    if (src.contiguous() && tgt.contiguous()) {
+        // We can take a more optimized route by reducing rank
+        auto src_v = View<SourceValue, 2>(src.data(), array::make_shape(src.shape(0), src.stride(0)));
+        auto tgt_v = View<TargetValue, 2>(tgt.data(), array::make_shape(tgt.shape(0), tgt.stride(0)));
+        SparseMatrixMultiply<backend::openmp, Indexing::layout_left, 2, SourceValue, TargetValue>::apply(W, src_v,
+                                                                                                         tgt_v, config);
+        return;
+    }
+    if (array::is_contiguous_innermost(src) && array::is_contiguous_innermost(tgt)) {
+        auto tgt_c = array::make_contiguous_view(tgt);
+        spmm_layout_left_3(W, array::make_contiguous_view(src), tgt_c);
+        return;
+    }
+    spmm_layout_left_3(W, src, tgt);
+}
+
 template <typename SourceValue, typename TargetValue>
 void SparseMatrixMultiply<backend::openmp, Indexing::layout_right, 1, SourceValue, TargetValue>::apply(
     const SparseMatrix& W, const View<SourceValue, 1>& src, View<TargetValue, 1>& tgt, const Configuration& config) {
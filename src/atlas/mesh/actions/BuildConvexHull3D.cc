@@ -49,6 +49,8 @@ const Point_3 origin = Point_3(CGAL::ORIGIN);
 #include "atlas/mesh/Mesh.h"
 #include "atlas/mesh/Nodes.h"
 #include "atlas/mesh/actions/BuildConvexHull3D.h"
+#include "atlas/mesh/detail/SphericalDelaunay.h"
+#include "atlas/runtime/Exception.h"
 #include "atlas/runtime/Log.h"
 #include "atlas/runtime/Trace.h"
 #include "atlas/util/CoordinateEnums.h"
@@ -67,6 +69,12 @@ namespace actions {
 BuildConvexHull3D::BuildConvexHull3D(const eckit::Parametrisation& config) {
     config.get("remove_duplicate_points", remove_duplicate_points_ = true);
     config.get("reshuffle", reshuffle_ = true);
+    method_ = ATLAS_HAVE_TESSELATION ? "cgal" : "native";
+    config.get("method", method_);
+    if (method_ != "cgal" && method_ != "native") {
+        throw_Exception("BuildConvexHull3D: unknown method \"" + method_ + "\", expected \"cgal\" or \"native\"",
+                        Here());
+    }
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -187,6 +195,44 @@ static void cgal_polyhedron_to_atlas_mesh(Mesh& mesh, Polyhedron_3& poly, PointS
 
 //----------------------------------------------------------------------------------------------------------------------
 
+static void native_convex_hull_to_atlas_mesh(Mesh& mesh, PointSet& points) {
+    ATLAS_TRACE();
+
+    std::vector<size_t> unique_nodes;
+    points.list_unique_points(unique_nodes);
+
+    auto xyz = array::make_view<double, 2>(mesh.nodes().field("xyz"));
+    std::vector<PointXYZ> pts;
+    pts.reserve(unique_nodes.size());
+    for (size_t jnode : unique_nodes) {
+        pts.emplace_back(PointXYZ{xyz(jnode, XX), xyz(jnode, YY), xyz(jnode, ZZ)});
+    }
+
+    std::vector<idx_t> triangles = mesh::detail::spherical_delaunay(pts);
+
+    ATLAS_ASSERT(mesh.cells().size() == 0);
+
+    const idx_t nb_triags = static_cast<idx_t>(triangles.size() / 3);
+    mesh.cells().add(new mesh::temporary::Triangle(), nb_triags);
+    mesh::HybridElements::Connectivity& triag_nodes = mesh.cells().node_connectivity();
+    auto triag_gidx                                 = array::make_view<gidx_t, 1>(mesh.cells().global_index());
+    auto triag_part                                 = array::make_view<int, 1>(mesh.cells().partition());
+
+    Log::debug() << "Inserting triags (" << eckit::BigNum(nb_triags) << ")" << std::endl;
+
+    for (idx_t tidx = 0; tidx < nb_triags; ++tidx) {
+        idx_t idx[3];
+        for (idx_t j = 0; j < 3; ++j) {
+            idx[j] = static_cast<idx_t>(unique_nodes[triangles[3 * tidx + j]]);
+        }
+        triag_nodes.set(tidx, idx);
+        triag_gidx(tidx) = tidx + 1;
+        triag_part(tidx) = 0;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
 void BuildConvexHull3D::operator()(Mesh& mesh) const {
     // don't tesselate meshes already with triags or quads
     if (mesh.cells().size()) {
@@ -199,6 +245,11 @@ void BuildConvexHull3D::operator()(Mesh& mesh) const {
 
     PointSet points(mesh);
 
+    if (method_ == "native") {
+        native_convex_hull_to_atlas_mesh(mesh, points);
+        return;
+    }
+
     std::vector<Point3> ipts;
 
     points.list_unique_points(ipts);
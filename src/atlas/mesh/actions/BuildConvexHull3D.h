@@ -10,6 +10,8 @@
 
 #pragma once
 
+#include <string>
+
 #include "eckit/config/Parametrisation.h"
 
 #include "atlas/util/Config.h"
@@ -22,6 +24,10 @@ namespace mesh {
 namespace actions {
 
 /// Creates a 3D convex-hull on the mesh points
+///
+/// Configuration:
+/// - method: "cgal" (default if atlas is built with CGAL) or "native", which triangulates
+///   the stereographic projection of the points in the plane and runs in parallel with OpenMP
 class BuildConvexHull3D {
 public:
     BuildConvexHull3D(const eckit::Parametrisation& = util::NoConfig());
@@ -29,6 +35,7 @@ public:
 private:
     bool remove_duplicate_points_;
     bool reshuffle_;
+    std::string method_;
 };
 
 }  // namespace actions
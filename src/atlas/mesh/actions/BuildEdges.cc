@@ -34,6 +34,8 @@
 #include "atlas/mesh/Nodes.h"
 #include "atlas/mesh/detail/AccumulateFacets.h"
 #include "atlas/parallel/mpi/mpi.h"
+#include "atlas/parallel/omp/omp.h"
+#include "atlas/parallel/omp/sort.h"
 #include "atlas/runtime/Exception.h"
 #include "atlas/runtime/Log.h"
 #include "atlas/util/CoordinateEnums.h"
@@ -61,7 +63,7 @@ struct Sort {
     }
     gidx_t g;
     idx_t i;
-    bool operator<(const Sort& other) const { return (g < other.g); }
+    bool operator<(const Sort& other) const { return (g < other.g) || (g == other.g && i < other.i); }
 };
 }  // anonymous namespace
 
@@ -87,16 +89,16 @@ void build_element_to_edge_connectivity(Mesh& mesh) {
     auto is_pole_edge = [&](idx_t e) { return Topology::check(edge_flags(e), Topology::POLE); };
 
     // Sort edges for bit-reproducibility
-    std::vector<Sort> edge_sort;
-    edge_sort.reserve(nb_edges);
+    std::vector<Sort> edge_sort(nb_edges);
     {
         UniqueLonLat compute_uid(mesh);
 
-        for (idx_t jedge = 0; jedge < nb_edges; ++jedge) {
-            edge_sort.emplace_back(Sort(compute_uid(edge_node_connectivity.row(jedge)), jedge));
+        atlas_omp_parallel_for (idx_t jedge = 0; jedge < nb_edges; ++jedge) {
+            edge_sort[jedge] = Sort(compute_uid(edge_node_connectivity.row(jedge)), jedge);
         }
 
-        std::sort(edge_sort.data(), edge_sort.data() + nb_edges);
+        // edges are in ascending order of idx, so that a stable sort on gid matches operator<
+        omp::radix_sort(edge_sort.begin(), edge_sort.end(), [](const Sort& s) { return s.g; });
     }
 
     // Fill in cell_edge_connectivity
@@ -178,10 +180,11 @@ void build_node_to_edge_connectivity(Mesh& mesh) {
 
     UniqueLonLat compute_uid(mesh);
     std::vector<Sort> edge_sort(nb_edges);
-    for (idx_t jedge = 0; jedge < nb_edges; ++jedge) {
+    atlas_omp_parallel_for (idx_t jedge = 0; jedge < nb_edges; ++jedge) {
         edge_sort[jedge] = Sort(compute_uid(edge_node_connectivity.row(jedge)), jedge);
     }
-    std::stable_sort(edge_sort.data(), edge_sort.data() + nb_edges);
+    // edges are in ascending order of idx, so that a stable sort on gid matches operator<
+    omp::radix_sort(edge_sort.begin(), edge_sort.end(), [](const Sort& s) { return s.g; });
 
     for (idx_t jedge = 0; jedge < nb_edges; ++jedge) {
         idx_t iedge = edge_sort[jedge].i;
@@ -954,7 +954,7 @@ public:
                 elem_uid[jelem * 2 + 0] = -compute_uid(elem_nodes->row(jelem));
                 elem_uid[jelem * 2 + 1] = cell_gidx(jelem);
             }
-            omp::sort(elem_uid.begin(), elem_uid.end());
+            omp::radix_sort(elem_uid.begin(), elem_uid.end());
         }
         auto element_already_exists = [&elem_uid, &new_elem_uid](uid_t uid) -> bool {
             std::vector<uid_t>::iterator it = std::lower_bound(elem_uid.begin(), elem_uid.end(), uid);
@@ -9,9 +9,16 @@
  */
 
 #include "atlas/mesh/detail/AccumulateFacets.h"
+
+#include <algorithm>
+#include <limits>
+
+#include "atlas/array/Range.h"
 #include "atlas/mesh/Elements.h"
 #include "atlas/mesh/HybridElements.h"
 #include "atlas/mesh/Nodes.h"
+#include "atlas/parallel/omp/omp.h"
+#include "atlas/parallel/omp/sort.h"
 #include "atlas/runtime/Exception.h"
 #include "atlas/runtime/Trace.h"
 
@@ -19,10 +26,61 @@ namespace atlas {
 namespace mesh {
 namespace detail {
 
-void accumulate_facets(const mesh::HybridElements& cells, const mesh::Nodes& nodes,
-                       std::vector<idx_t>& facet_nodes_data,  // shape(nb_facets,nb_nodes_per_facet)
-                       std::vector<idx_t>& connectivity_facet_to_elem, idx_t& nb_facets, idx_t& nb_inner_facets,
-                       idx_t& missing_value) {
+namespace {
+
+// Local node numbering of the facets of a 2D element
+const std::vector<std::vector<int>>& facet_numbering(const mesh::Elements& elements) {
+    static const std::vector<std::vector<int>> pentagon{{0, 1}, {1, 2}, {2, 3}, {3, 4}, {4, 0}};
+    static const std::vector<std::vector<int>> quadrilateral{{0, 1}, {1, 2}, {2, 3}, {3, 0}};
+    static const std::vector<std::vector<int>> triangle{{0, 1}, {1, 2}, {2, 0}};
+    if (elements.name() == "Pentagon") {
+        return pentagon;
+    }
+    if (elements.name() == "Quadrilateral") {
+        return quadrilateral;
+    }
+    if (elements.name() == "Triangle") {
+        return triangle;
+    }
+    throw_Exception(elements.name() + " is not \"Pentagon\", \"Quadrilateral\", or \"Triangle\"", Here());
+}
+
+// Ranges of elements per halo level and per element type, for elements ordered by halo
+std::vector<std::vector<array::Range>> ranges_by_halo(const mesh::HybridElements& cells, int& maxhalo) {
+    static int MAXHALO = 50;
+    std::vector<std::vector<array::Range>> ranges(MAXHALO, std::vector<array::Range>(cells.nb_types()));
+
+    maxhalo = 0;
+    for (idx_t t = 0; t < cells.nb_types(); ++t) {
+        const mesh::Elements& elements = cells.elements(t);
+        auto elem_halo                 = elements.view<int, 1>(elements.halo());
+        idx_t nb_elems                 = elements.size();
+
+        int halo{0};
+        int begin{0};
+        int end{0};
+        for (idx_t e = 0; e < nb_elems; ++e) {
+            ATLAS_ASSERT(elem_halo(e) >= halo);
+            if (elem_halo(e) > halo) {
+                end             = e;
+                ranges[halo][t] = array::Range{begin, end};
+                begin           = end;
+                ++halo;
+            }
+        }
+        end             = nb_elems;
+        ranges[halo][t] = array::Range{begin, end};
+        maxhalo         = std::max(halo, maxhalo);
+    }
+    return ranges;
+}
+
+}  // namespace
+
+void accumulate_facets_node_to_facet(const mesh::HybridElements& cells, const mesh::Nodes& nodes,
+                                     std::vector<idx_t>& facet_nodes_data,  // shape(nb_facets,nb_nodes_per_facet)
+                                     std::vector<idx_t>& connectivity_facet_to_elem, idx_t& nb_facets,
+                                     idx_t& nb_inner_facets, idx_t& missing_value) {
     ATLAS_TRACE();
     missing_value = -1;
     std::vector<std::vector<idx_t>> node_to_facet(nodes.size());
@@ -50,47 +108,8 @@ void accumulate_facets(const mesh::HybridElements& cells, const mesh::Nodes& nod
         idx_t nb_elems          = elements.size();
         idx_t nb_nodes_in_facet = 2;
 
-        std::vector<std::vector<int>> facet_node_numbering;
-        idx_t nb_facets_in_elem;
-        if (elements.name() == "Pentagon") {
-            nb_facets_in_elem = 5;
-            facet_node_numbering.resize(nb_facets_in_elem, std::vector<int>(nb_nodes_in_facet));
-            facet_node_numbering[0][0] = 0;
-            facet_node_numbering[0][1] = 1;
-            facet_node_numbering[1][0] = 1;
-            facet_node_numbering[1][1] = 2;
-            facet_node_numbering[2][0] = 2;
-            facet_node_numbering[2][1] = 3;
-            facet_node_numbering[3][0] = 3;
-            facet_node_numbering[3][1] = 4;
-            facet_node_numbering[4][0] = 4;
-            facet_node_numbering[4][1] = 0;
-        }
-        else if (elements.name() == "Quadrilateral") {
-            nb_facets_in_elem = 4;
-            facet_node_numbering.resize(nb_facets_in_elem, std::vector<int>(nb_nodes_in_facet));
-            facet_node_numbering[0][0] = 0;
-            facet_node_numbering[0][1] = 1;
-            facet_node_numbering[1][0] = 1;
-            facet_node_numbering[1][1] = 2;
-            facet_node_numbering[2][0] = 2;
-            facet_node_numbering[2][1] = 3;
-            facet_node_numbering[3][0] = 3;
-            facet_node_numbering[3][1] = 0;
-        }
-        else if (elements.name() == "Triangle") {
-            nb_facets_in_elem = 3;
-            facet_node_numbering.resize(nb_facets_in_elem, std::vector<int>(nb_nodes_in_facet));
-            facet_node_numbering[0][0] = 0;
-            facet_node_numbering[0][1] = 1;
-            facet_node_numbering[1][0] = 1;
-            facet_node_numbering[1][1] = 2;
-            facet_node_numbering[2][0] = 2;
-            facet_node_numbering[2][1] = 0;
-        }
-        else {
-            throw_Exception(elements.name() + " is not \"Pentagon\", \"Quadrilateral\", or \"Triangle\"", Here());
-        }
+        const auto& facet_node_numbering = facet_numbering(elements);
+        const idx_t nb_facets_in_elem    = static_cast<idx_t>(facet_node_numbering.size());
 
         std::vector<idx_t> facet_nodes(nb_nodes_in_facet);
 
@@ -168,47 +187,8 @@ void accumulate_facets_in_range(std::vector<array::Range>& range, const mesh::Hy
 
         idx_t nb_nodes_in_facet = 2;
 
-        std::vector<std::vector<int>> facet_node_numbering;
-        idx_t nb_facets_in_elem;
-        if (elements.name() == "Pentagon") {
-            nb_facets_in_elem = 5;
-            facet_node_numbering.resize(nb_facets_in_elem, std::vector<int>(nb_nodes_in_facet));
-            facet_node_numbering[0][0] = 0;
-            facet_node_numbering[0][1] = 1;
-            facet_node_numbering[1][0] = 1;
-            facet_node_numbering[1][1] = 2;
-            facet_node_numbering[2][0] = 2;
-            facet_node_numbering[2][1] = 3;
-            facet_node_numbering[3][0] = 3;
-            facet_node_numbering[3][1] = 4;
-            facet_node_numbering[4][0] = 4;
-            facet_node_numbering[4][1] = 0;
-        }
-        else if (elements.name() == "Quadrilateral") {
-            nb_facets_in_elem = 4;
-            facet_node_numbering.resize(nb_facets_in_elem, std::vector<int>(nb_nodes_in_facet));
-            facet_node_numbering[0][0] = 0;
-            facet_node_numbering[0][1] = 1;
-            facet_node_numbering[1][0] = 1;
-            facet_node_numbering[1][1] = 2;
-            facet_node_numbering[2][0] = 2;
-            facet_node_numbering[2][1] = 3;
-            facet_node_numbering[3][0] = 3;
-            facet_node_numbering[3][1] = 0;
-        }
-        else if (elements.name() == "Triangle") {
-            nb_facets_in_elem = 3;
-            facet_node_numbering.resize(nb_facets_in_elem, std::vector<int>(nb_nodes_in_facet));
-            facet_node_numbering[0][0] = 0;
-            facet_node_numbering[0][1] = 1;
-            facet_node_numbering[1][0] = 1;
-            facet_node_numbering[1][1] = 2;
-            facet_node_numbering[2][0] = 2;
-            facet_node_numbering[2][1] = 0;
-        }
-        else {
-            throw_Exception(elements.name() + " is not \"Pentagon\", \"Quadrilateral\", or \"Triangle\"", Here());
-        }
+        const auto& facet_node_numbering = facet_numbering(elements);
+        const idx_t nb_facets_in_elem    = static_cast<idx_t>(facet_node_numbering.size());
 
         std::vector<idx_t> facet_nodes(nb_nodes_in_facet);
 
@@ -265,38 +245,15 @@ void accumulate_facets_in_range(std::vector<array::Range>& range, const mesh::Hy
     }
 }
 
-void accumulate_facets_ordered_by_halo(const mesh::HybridElements& cells, const mesh::Nodes& nodes,
-                                       std::vector<idx_t>& facet_nodes_data,  // shape(nb_facets,nb_nodes_per_facet)
-                                       std::vector<idx_t>& connectivity_facet_to_elem, idx_t& nb_facets,
-                                       idx_t& nb_inner_facets, idx_t& missing_value, std::vector<idx_t>& halo_offsets) {
+void accumulate_facets_ordered_by_halo_node_to_facet(const mesh::HybridElements& cells, const mesh::Nodes& nodes,
+                                                     std::vector<idx_t>& facet_nodes_data,
+                                                     std::vector<idx_t>& connectivity_facet_to_elem, idx_t& nb_facets,
+                                                     idx_t& nb_inner_facets, idx_t& missing_value,
+                                                     std::vector<idx_t>& halo_offsets) {
     ATLAS_TRACE();
 
-    static int MAXHALO = 50;
-    std::vector<std::vector<array::Range>> ranges(MAXHALO, std::vector<array::Range>(cells.nb_types()));
-
-    int maxhalo{0};
-    for (idx_t t = 0; t < cells.nb_types(); ++t) {
-        const mesh::Elements& elements = cells.elements(t);
-        auto elem_halo                 = elements.view<int, 1>(elements.halo());
-        idx_t nb_elems                 = elements.size();
-
-        int halo{0};
-        int begin{0};
-        int end{0};
-        for (idx_t e = 0; e < nb_elems; ++e) {
-            ATLAS_ASSERT(elem_halo(e) >= halo);
-            if (elem_halo(e) > halo) {
-                end             = e;
-                ranges[halo][t] = array::Range{begin, end};
-                begin           = end;
-                ++halo;
-            }
-        }
-        end             = nb_elems;
-        ranges[halo][t] = array::Range{begin, end};
-        maxhalo         = std::max(halo, maxhalo);
-    }
-
+    int maxhalo;
+    auto ranges = ranges_by_halo(cells, maxhalo);
 
     missing_value = -1;
     std::vector<std::vector<idx_t>> node_to_facet(nodes.size());
@@ -316,6 +273,175 @@ void accumulate_facets_ordered_by_halo(const mesh::HybridElements& cells, const
 }
 
 
+namespace {
+
+// Facet of an element, identified by its nodes in ascending order, and by its position in traversal order
+struct FacetKey {
+    idx_t n0;
+    idx_t n1;
+    idx_t occurrence;
+    bool operator<(const FacetKey& other) const {
+        if (n0 != other.n0) {
+            return n0 < other.n0;
+        }
+        if (n1 != other.n1) {
+            return n1 < other.n1;
+        }
+        return occurrence < other.occurrence;
+    }
+    bool same_facet(const FacetKey& other) const { return n0 == other.n0 && n1 == other.n1; }
+};
+
+// Sort-based facet accumulation.
+// The facets of all elements are listed in traversal order (stage, element type, element, facet),
+// with stages e.g. halo levels, and sorted in parallel by their canonical node pair. Occurrences of the same facet
+// are then adjacent: the first one defines the facet, and the last other one (if any) is the neighbouring element.
+// Facets are numbered by their first occurrence, which reproduces the order of the node-to-facet search.
+// Returns false, without output, if degenerate facets (with repeated nodes) are encountered.
+bool accumulate_facets_sorted(const mesh::HybridElements& cells,
+                              const std::vector<std::vector<array::Range>>& stages,  // shape(nb_stages,nb_types)
+                              std::vector<idx_t>& facet_nodes_data, std::vector<idx_t>& connectivity_facet_to_elem,
+                              idx_t& nb_facets, idx_t& nb_inner_facets, idx_t missing_value,
+                              std::vector<idx_t>& stage_offsets) {
+    ATLAS_TRACE();
+    constexpr idx_t skipped   = std::numeric_limits<idx_t>::max();
+    constexpr idx_t not_first = std::numeric_limits<idx_t>::min();
+
+    const idx_t nb_stages = static_cast<idx_t>(stages.size());
+    const idx_t nb_types  = cells.nb_types();
+
+    std::vector<idx_t> occurrence_begin(nb_stages * nb_types + 1, 0);
+    for (idx_t s = 0; s < nb_stages; ++s) {
+        for (idx_t t = 0; t < nb_types; ++t) {
+            const idx_t nb_elems = stages[s][t].end() - stages[s][t].start();
+            const idx_t nb_facets_in_elem = static_cast<idx_t>(facet_numbering(cells.elements(t)).size());
+            occurrence_begin[s * nb_types + t + 1] = occurrence_begin[s * nb_types + t] + nb_elems * nb_facets_in_elem;
+        }
+    }
+    const idx_t nb_occurrences = occurrence_begin.back();
+
+    std::vector<FacetKey> keys(nb_occurrences);
+    std::vector<idx_t> occurrence_elem(nb_occurrences);
+    std::vector<idx_t> occurrence_nodes(2 * nb_occurrences);
+
+    idx_t nb_degenerate = 0;
+    for (idx_t s = 0; s < nb_stages; ++s) {
+        for (idx_t t = 0; t < nb_types; ++t) {
+            const mesh::Elements& elements            = cells.elements(t);
+            const mesh::BlockConnectivity& elem_nodes = elements.node_connectivity();
+            auto elem_flags                           = elements.view<int, 1>(elements.flags());
+            const auto& facet_node_numbering          = facet_numbering(elements);
+            const idx_t nb_facets_in_elem             = static_cast<idx_t>(facet_node_numbering.size());
+            const idx_t e_start                       = stages[s][t].start();
+            const idx_t e_end                         = stages[s][t].end();
+            const idx_t o_start                       = occurrence_begin[s * nb_types + t];
+            const idx_t elem_begin                    = elements.begin();
+
+            atlas_omp_pragma(omp parallel for schedule(static) reduction(+ : nb_degenerate))
+            for (idx_t e = e_start; e < e_end; ++e) {
+                using Topology   = atlas::mesh::Nodes::Topology;
+                const bool patch = Topology::check(elem_flags(e), Topology::PATCH);
+                for (idx_t f = 0; f < nb_facets_in_elem; ++f) {
+                    const idx_t o = o_start + (e - e_start) * nb_facets_in_elem + f;
+                    if (patch) {
+                        keys[o] = FacetKey{skipped, skipped, o};
+                        continue;
+                    }
+                    const idx_t n0          = elem_nodes(e, facet_node_numbering[f][0]);
+                    const idx_t n1          = elem_nodes(e, facet_node_numbering[f][1]);
+                    keys[o]                 = FacetKey{std::min(n0, n1), std::max(n0, n1), o};
+                    occurrence_elem[o]      = elem_begin + e;
+                    occurrence_nodes[2 * o] = n0;
+                    occurrence_nodes[2 * o + 1] = n1;
+                    if (n0 == n1) {
+                        ++nb_degenerate;
+                    }
+                }
+            }
+        }
+    }
+    if (nb_degenerate > 0) {
+        return false;
+    }
+
+    // Occurrences are in ascending order, so that stable sorts on n1 and then n0 order keys as FacetKey::operator<
+    omp::radix_sort(keys.begin(), keys.end(), [](const FacetKey& k) { return k.n1; });
+    omp::radix_sort(keys.begin(), keys.end(), [](const FacetKey& k) { return k.n0; });
+
+    // For the first occurrence of each facet, store the neighbouring element
+    std::vector<idx_t> facet_partner(nb_occurrences, not_first);
+    idx_t nb_inner = 0;
+    atlas_omp_pragma(omp parallel for schedule(static) reduction(+ : nb_inner))
+    for (idx_t i = 0; i < nb_occurrences; ++i) {
+        if (keys[i].n0 == skipped || (i > 0 && keys[i].same_facet(keys[i - 1]))) {
+            continue;
+        }
+        idx_t last = i;
+        while (last + 1 < nb_occurrences && keys[last + 1].same_facet(keys[i])) {
+            ++last;
+        }
+        facet_partner[keys[i].occurrence] =
+            (last > i) ? occurrence_elem[keys[last].occurrence] : missing_value;
+        nb_inner += last - i;
+    }
+
+    // Number facets by first occurrence
+    facet_nodes_data.reserve(facet_nodes_data.size() + nb_occurrences);
+    connectivity_facet_to_elem.reserve(connectivity_facet_to_elem.size() + nb_occurrences);
+    nb_facets       = 0;
+    nb_inner_facets = nb_inner;
+    stage_offsets   = std::vector<idx_t>{0};
+    for (idx_t s = 0; s < nb_stages; ++s) {
+        for (idx_t o = occurrence_begin[s * nb_types]; o < occurrence_begin[(s + 1) * nb_types]; ++o) {
+            if (facet_partner[o] != not_first) {
+                facet_nodes_data.emplace_back(occurrence_nodes[2 * o]);
+                facet_nodes_data.emplace_back(occurrence_nodes[2 * o + 1]);
+                connectivity_facet_to_elem.emplace_back(occurrence_elem[o]);
+                connectivity_facet_to_elem.emplace_back(facet_partner[o]);
+                ++nb_facets;
+            }
+        }
+        stage_offsets.emplace_back(nb_facets);
+    }
+    return true;
+}
+
+}  // namespace
+
+void accumulate_facets(const mesh::HybridElements& cells, const mesh::Nodes& nodes,
+                       std::vector<idx_t>& facet_nodes_data,  // shape(nb_facets,nb_nodes_per_facet)
+                       std::vector<idx_t>& connectivity_facet_to_elem, idx_t& nb_facets, idx_t& nb_inner_facets,
+                       idx_t& missing_value) {
+    ATLAS_TRACE();
+    missing_value = -1;
+    std::vector<std::vector<array::Range>> stages(1, std::vector<array::Range>(cells.nb_types()));
+    for (idx_t t = 0; t < cells.nb_types(); ++t) {
+        stages[0][t] = array::Range{0, cells.elements(t).size()};
+    }
+    std::vector<idx_t> stage_offsets;
+    if (not accumulate_facets_sorted(cells, stages, facet_nodes_data, connectivity_facet_to_elem, nb_facets,
+                                     nb_inner_facets, missing_value, stage_offsets)) {
+        accumulate_facets_node_to_facet(cells, nodes, facet_nodes_data, connectivity_facet_to_elem, nb_facets,
+                                        nb_inner_facets, missing_value);
+    }
+}
+
+void accumulate_facets_ordered_by_halo(const mesh::HybridElements& cells, const mesh::Nodes& nodes,
+                                       std::vector<idx_t>& facet_nodes_data,  // shape(nb_facets,nb_nodes_per_facet)
+                                       std::vector<idx_t>& connectivity_facet_to_elem, idx_t& nb_facets,
+                                       idx_t& nb_inner_facets, idx_t& missing_value, std::vector<idx_t>& halo_offsets) {
+    ATLAS_TRACE();
+    missing_value = -1;
+    int maxhalo;
+    auto ranges = ranges_by_halo(cells, maxhalo);
+    ranges.resize(maxhalo + 1);
+    if (not accumulate_facets_sorted(cells, ranges, facet_nodes_data, connectivity_facet_to_elem, nb_facets,
+                                     nb_inner_facets, missing_value, halo_offsets)) {
+        accumulate_facets_ordered_by_halo_node_to_facet(cells, nodes, facet_nodes_data, connectivity_facet_to_elem,
+                                                        nb_facets, nb_inner_facets, missing_value, halo_offsets);
+    }
+}
+
 }  // namespace detail
 }  // namespace mesh
 }  // namespace atlas
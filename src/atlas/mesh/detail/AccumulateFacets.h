@@ -41,6 +41,20 @@ void accumulate_facets_ordered_by_halo(const mesh::HybridElements& cells, const
                                        std::vector<idx_t>& connectivity_facet_to_elem, idx_t& nb_facets,
                                        idx_t& nb_inner_facets, idx_t& missing_value, std::vector<idx_t>& halo_offsets);
 
+// Reference implementations, searching facets through a node-to-facet lookup, one element at a time.
+// accumulate_facets and accumulate_facets_ordered_by_halo sort facets in parallel instead, with identical output,
+// and fall back to these for degenerate facets.
+void accumulate_facets_node_to_facet(const mesh::HybridElements& cells, const mesh::Nodes& nodes,
+                                     std::vector<idx_t>& facet_nodes_data,  // shape(nb_facets,nb_nodes_per_facet)
+                                     std::vector<idx_t>& connectivity_facet_to_elem, idx_t& nb_facets,
+                                     idx_t& nb_inner_facets, idx_t& missing_value);
+
+void accumulate_facets_ordered_by_halo_node_to_facet(const mesh::HybridElements& cells, const mesh::Nodes& nodes,
+                                                     std::vector<idx_t>& facet_nodes_data,
+                                                     std::vector<idx_t>& connectivity_facet_to_elem, idx_t& nb_facets,
+                                                     idx_t& nb_inner_facets, idx_t& missing_value,
+                                                     std::vector<idx_t>& halo_offsets);
+
 }  // namespace detail
 }  // namespace mesh
 }  // namespace atlas
@@ -0,0 +1,490 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#include "atlas/mesh/detail/SphericalDelaunay.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <string>
+
+#include "atlas/parallel/omp/omp.h"
+#include "atlas/parallel/omp/sort.h"
+#include "atlas/runtime/Exception.h"
+#include "atlas/runtime/Trace.h"
+
+namespace atlas {
+namespace mesh {
+namespace detail {
+
+namespace {
+
+// True if p, q, r turn counter-clockwise
+inline bool orient(double px, double py, double qx, double qy, double rx, double ry) {
+    return (qy - py) * (rx - qx) - (qx - px) * (ry - qy) < 0.;
+}
+
+// True if p lies inside the circumcircle of the clockwise triangle a, b, c
+inline bool in_circle(double ax, double ay, double bx, double by, double cx, double cy, double px, double py) {
+    const double dx = ax - px;
+    const double dy = ay - py;
+    const double ex = bx - px;
+    const double ey = by - py;
+    const double fx = cx - px;
+    const double fy = cy - py;
+    const double ap = dx * dx + dy * dy;
+    const double bp = ex * ex + ey * ey;
+    const double cp = fx * fx + fy * fy;
+    return dx * (ey * cp - bp * fy) - dy * (ex * cp - bp * fx) + ap * (ex * fy - ey * fx) < 0.;
+}
+
+// Circumcentre of triangle a, b, c relative to a
+inline void circumcentre_offset(double ax, double ay, double bx, double by, double cx, double cy, double& x,
+                                double& y) {
+    const double dx = bx - ax;
+    const double dy = by - ay;
+    const double ex = cx - ax;
+    const double ey = cy - ay;
+    const double bl = dx * dx + dy * dy;
+    const double cl = ex * ex + ey * ey;
+    const double d  = 0.5 / (dx * ey - dy * ex);
+    x               = (ey * bl - dy * cl) * d;
+    y               = (dx * cl - ex * bl) * d;
+}
+
+inline double circumradius2(double ax, double ay, double bx, double by, double cx, double cy) {
+    double x, y;
+    circumcentre_offset(ax, ay, bx, by, cx, cy, x, y);
+    const double r2 = x * x + y * y;
+    return std::isfinite(r2) ? r2 : std::numeric_limits<double>::max();
+}
+
+// Monotonic function of the angle of (dx,dy), in [0,1]
+inline double pseudo_angle(double dx, double dy) {
+    const double p = dx / (std::abs(dx) + std::abs(dy));
+    return (dy > 0. ? 3. - p : 1. + p) / 4.;
+}
+
+// Sweep-hull Delaunay triangulation:
+// Points are inserted in order of distance from a seed triangle, each one connected to the visible part of the
+// convex hull of the points inserted so far. Triangles are stored as triplets of half-edges, and made Delaunay
+// by edge flips after each insertion.
+class SweepHull {
+public:
+    SweepHull(const std::vector<double>& x, const std::vector<double>& y);
+
+    std::vector<idx_t> triangles;
+    std::vector<idx_t> hull;
+
+private:
+    idx_t add_triangle(idx_t i0, idx_t i1, idx_t i2, idx_t a, idx_t b, idx_t c);
+    void link(idx_t a, idx_t b);
+    idx_t legalize(idx_t a);
+    idx_t hash_key(double x, double y) const;
+
+    const std::vector<double>& x_;
+    const std::vector<double>& y_;
+    std::vector<idx_t> halfedges_;
+    std::vector<idx_t> hull_prev_;
+    std::vector<idx_t> hull_next_;
+    std::vector<idx_t> hull_tri_;
+    std::vector<idx_t> hull_hash_;
+    std::vector<idx_t> edge_stack_;
+    idx_t hull_start_;
+    idx_t hash_size_;
+    idx_t size_{0};
+    double cx_;
+    double cy_;
+};
+
+SweepHull::SweepHull(const std::vector<double>& x, const std::vector<double>& y): x_(x), y_(y) {
+    ATLAS_TRACE("SweepHull");
+    ATLAS_ASSERT(x.size() == y.size());
+    const idx_t n = static_cast<idx_t>(x.size());
+    if (n < 3) {
+        throw_Exception("At least 3 points are required for a triangulation, got " + std::to_string(n), Here());
+    }
+
+    double min_x = std::numeric_limits<double>::max();
+    double min_y = std::numeric_limits<double>::max();
+    double max_x = std::numeric_limits<double>::lowest();
+    double max_y = std::numeric_limits<double>::lowest();
+    for (idx_t i = 0; i < n; ++i) {
+        min_x = std::min(min_x, x[i]);
+        min_y = std::min(min_y, y[i]);
+        max_x = std::max(max_x, x[i]);
+        max_y = std::max(max_y, y[i]);
+    }
+    const double mid_x = 0.5 * (min_x + max_x);
+    const double mid_y = 0.5 * (min_y + max_y);
+
+    // Seed triangle: point closest to the centre, its nearest neighbour, and the point forming the smallest circle
+    auto dist2 = [&](idx_t i, double px, double py) {
+        const double dx = x[i] - px;
+        const double dy = y[i] - py;
+        return dx * dx + dy * dy;
+    };
+    idx_t i0 = 0;
+    idx_t i1 = -1;
+    idx_t i2 = -1;
+    double min_dist = std::numeric_limits<double>::max();
+    for (idx_t i = 0; i < n; ++i) {
+        const double d = dist2(i, mid_x, mid_y);
+        if (d < min_dist) {
+            i0       = i;
+            min_dist = d;
+        }
+    }
+    min_dist = std::numeric_limits<double>::max();
+    for (idx_t i = 0; i < n; ++i) {
+        const double d = dist2(i, x[i0], y[i0]);
+        if (i != i0 && d < min_dist && d > 0.) {
+            i1       = i;
+            min_dist = d;
+        }
+    }
+    ATLAS_ASSERT(i1 >= 0);
+    double min_radius = std::numeric_limits<double>::max();
+    for (idx_t i = 0; i < n; ++i) {
+        if (i == i0 || i == i1) {
+            continue;
+        }
+        const double r = circumradius2(x[i0], y[i0], x[i1], y[i1], x[i], y[i]);
+        if (r < min_radius) {
+            i2         = i;
+            min_radius = r;
+        }
+    }
+    if (i2 < 0) {
+        throw_Exception("Cannot triangulate collinear points", Here());
+    }
+    if (orient(x[i0], y[i0], x[i1], y[i1], x[i2], y[i2])) {
+        std::swap(i1, i2);
+    }
+    circumcentre_offset(x[i0], y[i0], x[i1], y[i1], x[i2], y[i2], cx_, cy_);
+    cx_ += x[i0];
+    cy_ += y[i0];
+
+    // Insertion order: by distance from the circumcentre of the seed triangle
+    std::vector<double> dists(n);
+    std::vector<idx_t> ids(n);
+    atlas_omp_parallel_for (idx_t i = 0; i < n; ++i) {
+        dists[i] = dist2(i, cx_, cy_);
+        ids[i]   = i;
+    }
+    omp::sort(ids.begin(), ids.end(),
+              [&](idx_t a, idx_t b) { return dists[a] < dists[b] || (dists[a] == dists[b] && a < b); });
+
+    const idx_t max_triangles = std::max<idx_t>(2 * n - 5, 1);
+    triangles.resize(3 * max_triangles);
+    halfedges_.resize(3 * max_triangles);
+    hull_prev_.resize(n);
+    hull_next_.resize(n);
+    hull_tri_.resize(n);
+    hash_size_ = static_cast<idx_t>(std::ceil(std::sqrt(double(n))));
+    hull_hash_.assign(hash_size_, -1);
+
+    hull_start_   = i0;
+    idx_t nb_hull = 3;
+    hull_next_[i0] = hull_prev_[i2] = i1;
+    hull_next_[i1] = hull_prev_[i0] = i2;
+    hull_next_[i2] = hull_prev_[i1] = i0;
+    hull_tri_[i0] = 0;
+    hull_tri_[i1] = 1;
+    hull_tri_[i2] = 2;
+    hull_hash_[hash_key(x[i0], y[i0])] = i0;
+    hull_hash_[hash_key(x[i1], y[i1])] = i1;
+    hull_hash_[hash_key(x[i2], y[i2])] = i2;
+    add_triangle(i0, i1, i2, -1, -1, -1);
+
+    constexpr double eps = std::numeric_limits<double>::epsilon();
+    double xp = 0.;
+    double yp = 0.;
+    for (idx_t k = 0; k < n; ++k) {
+        const idx_t i  = ids[k];
+        const double px = x[i];
+        const double py = y[i];
+
+        // skip near-duplicate points
+        if (k > 0 && std::abs(px - xp) <= eps && std::abs(py - yp) <= eps) {
+            continue;
+        }
+        xp = px;
+        yp = py;
+        if (i == i0 || i == i1 || i == i2) {
+            continue;
+        }
+
+        // find a visible edge on the convex hull, starting from the hull point with nearest angle
+        idx_t start = 0;
+        for (idx_t j = 0, key = hash_key(px, py); j < hash_size_; ++j) {
+            start = hull_hash_[(key + j) % hash_size_];
+            if (start != -1 && start != hull_next_[start]) {
+                break;
+            }
+        }
+        start   = hull_prev_[start];
+        idx_t e = start;
+        idx_t q = hull_next_[e];
+        while (not orient(px, py, x[e], y[e], x[q], y[q])) {
+            e = q;
+            if (e == start) {
+                e = -1;
+                break;
+            }
+            q = hull_next_[e];
+        }
+        if (e == -1) {
+            continue;  // point lies on the hull, which can only happen for near-duplicates
+        }
+
+        // add the first triangle from the point
+        idx_t t    = add_triangle(e, i, hull_next_[e], -1, -1, hull_tri_[e]);
+        hull_tri_[i] = legalize(t + 2);
+        hull_tri_[e] = t;
+        ++nb_hull;
+
+        // walk forward through the hull, adding more triangles and flipping recursively
+        idx_t next = hull_next_[e];
+        q          = hull_next_[next];
+        while (orient(px, py, x[next], y[next], x[q], y[q])) {
+            t               = add_triangle(next, i, q, hull_tri_[i], -1, hull_tri_[next]);
+            hull_tri_[i]    = legalize(t + 2);
+            hull_next_[next] = next;  // mark as removed
+            --nb_hull;
+            next = q;
+            q    = hull_next_[next];
+        }
+
+        // walk backward from the other side, adding more triangles and flipping
+        if (e == start) {
+            q = hull_prev_[e];
+            while (orient(px, py, x[q], y[q], x[e], y[e])) {
+                t = add_triangle(q, i, e, -1, hull_tri_[e], hull_tri_[q]);
+                legalize(t + 2);
+                hull_tri_[q]  = t;
+                hull_next_[e] = e;  // mark as removed
+                --nb_hull;
+                e = q;
+                q = hull_prev_[e];
+            }
+        }
+
+        // update the hull indices
+        hull_start_ = hull_prev_[i] = e;
+        hull_next_[e] = hull_prev_[next] = i;
+        hull_next_[i]                    = next;
+
+        hull_hash_[hash_key(px, py)]     = i;
+        hull_hash_[hash_key(x[e], y[e])] = e;
+    }
+
+    triangles.resize(size_);
+
+    hull.resize(nb_hull);
+    for (idx_t j = 0, e = hull_start_; j < nb_hull; ++j, e = hull_next_[e]) {
+        hull[j] = e;
+    }
+}
+
+idx_t SweepHull::hash_key(double x, double y) const {
+    return static_cast<idx_t>(std::floor(pseudo_angle(x - cx_, y - cy_) * hash_size_)) % hash_size_;
+}
+
+void SweepHull::link(idx_t a, idx_t b) {
+    halfedges_[a] = b;
+    if (b != -1) {
+        halfedges_[b] = a;
+    }
+}
+
+idx_t SweepHull::add_triangle(idx_t i0, idx_t i1, idx_t i2, idx_t a, idx_t b, idx_t c) {
+    const idx_t t    = size_;
+    triangles[t]     = i0;
+    triangles[t + 1] = i1;
+    triangles[t + 2] = i2;
+    link(t, a);
+    link(t + 1, b);
+    link(t + 2, c);
+    size_ += 3;
+    return t;
+}
+
+idx_t SweepHull::legalize(idx_t a) {
+    idx_t ar = 0;
+    edge_stack_.clear();
+    while (true) {
+        const idx_t b  = halfedges_[a];
+        const idx_t a0 = a - a % 3;
+        ar             = a0 + (a + 2) % 3;
+
+        if (b == -1) {  // convex hull edge
+            if (edge_stack_.empty()) {
+                break;
+            }
+            a = edge_stack_.back();
+            edge_stack_.pop_back();
+            continue;
+        }
+
+        const idx_t b0 = b - b % 3;
+        const idx_t al = a0 + (a + 1) % 3;
+        const idx_t bl = b0 + (b + 2) % 3;
+
+        const idx_t p0 = triangles[ar];
+        const idx_t pr = triangles[a];
+        const idx_t pl = triangles[al];
+        const idx_t p1 = triangles[bl];
+
+        if (in_circle(x_[p0], y_[p0], x_[pr], y_[pr], x_[pl], y_[pl], x_[p1], y_[p1])) {
+            triangles[a] = p1;
+            triangles[b] = p0;
+
+            const idx_t hbl = halfedges_[bl];
+
+            // edge swapped on the other side of the hull (rare): fix the half-edge reference
+            if (hbl == -1) {
+                idx_t e = hull_start_;
+                do {
+                    if (hull_tri_[e] == bl) {
+                        hull_tri_[e] = a;
+                        break;
+                    }
+                    e = hull_prev_[e];
+                } while (e != hull_start_);
+            }
+            link(a, hbl);
+            link(b, halfedges_[ar]);
+            link(ar, bl);
+
+            edge_stack_.emplace_back(b0 + (b + 1) % 3);
+        }
+        else {
+            if (edge_stack_.empty()) {
+                break;
+            }
+            a = edge_stack_.back();
+            edge_stack_.pop_back();
+        }
+    }
+    return ar;
+}
+
+}  // namespace
+
+//----------------------------------------------------------------------------------------------------------------------
+
+std::vector<idx_t> planar_delaunay(const std::vector<double>& x, const std::vector<double>& y,
+                                   std::vector<idx_t>& hull) {
+    SweepHull sweephull(x, y);
+    hull = std::move(sweephull.hull);
+    return std::move(sweephull.triangles);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+std::vector<idx_t> spherical_delaunay(const std::vector<PointXYZ>& points) {
+    ATLAS_TRACE();
+    using Vector = std::array<double, 3>;
+
+    const idx_t n = static_cast<idx_t>(points.size());
+    if (n < 4) {
+        throw_Exception("At least 4 points are required for a spherical triangulation, got " + std::to_string(n),
+                        Here());
+    }
+
+    auto normalised = [](const PointXYZ& p) -> Vector {
+        const double r = std::sqrt(p.x() * p.x() + p.y() * p.y() + p.z() * p.z());
+        return {p.x() / r, p.y() / r, p.z() / r};
+    };
+    auto cross = [](const Vector& a, const Vector& b) -> Vector {
+        return {a[1] * b[2] - a[2] * b[1], a[2] * b[0] - a[0] * b[2], a[0] * b[1] - a[1] * b[0]};
+    };
+    auto dot = [](const Vector& a, const Vector& b) { return a[0] * b[0] + a[1] * b[1] + a[2] * b[2]; };
+
+    // Orthonormal basis (e1,e2,pole), with the first point as projection pole
+    const Vector pole = normalised(points[0]);
+    Vector axis{0., 0., 0.};
+    axis[std::abs(pole[0]) < std::abs(pole[1]) ? (std::abs(pole[0]) < std::abs(pole[2]) ? 0 : 2)
+                                               : (std::abs(pole[1]) < std::abs(pole[2]) ? 1 : 2)] = 1.;
+    Vector e1          = cross(pole, axis);
+    const double e1len = std::sqrt(dot(e1, e1));
+    e1                 = {e1[0] / e1len, e1[1] / e1len, e1[2] / e1len};
+    const Vector e2    = cross(pole, e1);
+
+    // Stereographic projection of all other points from the pole
+    std::vector<double> x(n - 1);
+    std::vector<double> y(n - 1);
+    idx_t nb_at_pole = 0;
+    atlas_omp_pragma(omp parallel for schedule(static) reduction(+ : nb_at_pole))
+    for (idx_t i = 1; i < n; ++i) {
+        const Vector p = normalised(points[i]);
+        const double d = 1. - dot(p, pole);
+        if (d <= 0.) {
+            ++nb_at_pole;
+            continue;
+        }
+        x[i - 1] = dot(p, e1) / d;
+        y[i - 1] = dot(p, e2) / d;
+    }
+    if (nb_at_pole) {
+        throw_Exception("Points are not unique: " + std::to_string(nb_at_pole) + " points coincide with the first one",
+                        Here());
+    }
+
+    // Triangles not touching the pole are Delaunay in the projection plane,
+    // triangles touching the pole connect it to the convex hull in the projection plane
+    std::vector<idx_t> hull;
+    std::vector<idx_t> planar = planar_delaunay(x, y, hull);
+    const idx_t nb_planar     = static_cast<idx_t>(planar.size()) / 3;
+    const idx_t nb_hull       = static_cast<idx_t>(hull.size());
+    const idx_t nb_triangles  = nb_planar + nb_hull;
+
+    // A triangulation of the sphere has 2*n-4 triangles, unless points were skipped as near-duplicates
+    if (nb_triangles != 2 * n - 4) {
+        throw_Exception("Spherical triangulation failed: " + std::to_string(nb_triangles) + " triangles for " +
+                            std::to_string(n) + " points. Are the points unique?",
+                        Here());
+    }
+
+    std::vector<idx_t> triangles(3 * nb_triangles);
+    atlas_omp_parallel_for (idx_t t = 0; t < nb_planar; ++t) {
+        for (idx_t j = 0; j < 3; ++j) {
+            triangles[3 * t + j] = planar[3 * t + j] + 1;
+        }
+    }
+    for (idx_t j = 0; j < nb_hull; ++j) {
+        const idx_t t        = nb_planar + j;
+        triangles[3 * t + 0] = 0;
+        triangles[3 * t + 1] = hull[j] + 1;
+        triangles[3 * t + 2] = hull[(j + 1) % nb_hull] + 1;
+    }
+
+    // Ensure outward pointing normals
+    atlas_omp_parallel_for (idx_t t = 0; t < nb_triangles; ++t) {
+        idx_t* tri     = triangles.data() + 3 * t;
+        const Vector a = normalised(points[tri[0]]);
+        const Vector b = normalised(points[tri[1]]);
+        const Vector c = normalised(points[tri[2]]);
+        const Vector normal =
+            cross({b[0] - a[0], b[1] - a[1], b[2] - a[2]}, {c[0] - a[0], c[1] - a[1], c[2] - a[2]});
+        if (dot(normal, a) < 0.) {
+            std::swap(tri[1], tri[2]);
+        }
+    }
+    return triangles;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+}  // namespace detail
+}  // namespace mesh
+}  // namespace atlas
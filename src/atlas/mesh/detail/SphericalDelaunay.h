@@ -0,0 +1,42 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#pragma once
+
+#include <vector>
+
+#include "atlas/library/config.h"
+#include "atlas/util/Point.h"
+
+namespace atlas {
+namespace mesh {
+namespace detail {
+
+/// @brief Triangulation of unique points on the sphere, equivalent to their 3D convex hull
+///
+/// The points are projected stereographically from one of them, and triangulated in the plane with a
+/// sweep-hull Delaunay algorithm. The triangles connecting the projection pole with the convex hull
+/// of the planar triangulation close the sphere.
+///
+/// @param points  unique points; they are normalised onto the unit sphere
+/// @return triangle node indices, shape(nb_triangles,3), counter-clockwise seen from outside the sphere
+std::vector<idx_t> spherical_delaunay(const std::vector<PointXYZ>& points);
+
+/// @brief Delaunay triangulation of unique points in the plane
+///
+/// @param x, y    coordinates of the points
+/// @param[out] hull  convex hull node indices, in the same orientation as the triangles
+/// @return triangle node indices, shape(nb_triangles,3), all with the same orientation
+std::vector<idx_t> planar_delaunay(const std::vector<double>& x, const std::vector<double>& y,
+                                   std::vector<idx_t>& hull);
+
+}  // namespace detail
+}  // namespace mesh
+}  // namespace atlas
@@ -28,6 +28,7 @@
 #include "atlas/meshgenerator/detail/MeshGeneratorFactory.h"
 #include "atlas/projection/Projection.h"
 #include "atlas/runtime/Log.h"
+#include "atlas/util/Config.h"
 #include "atlas/util/CoordinateEnums.h"
 #include "atlas/parallel/mpi/mpi.h"
 #include "atlas/mesh/ElementType.h"
@@ -45,14 +46,14 @@ DelaunayMeshGenerator::DelaunayMeshGenerator(const eckit::Parametrisation& p) {
     p.get("part",part_=mpi::rank());
     p.get("reshuffle",reshuffle_=true);
     p.get("remove_duplicate_points",remove_duplicate_points_=true);
+    p.get("method",method_);
 }
 
 DelaunayMeshGenerator::~DelaunayMeshGenerator() = default;
 
 void DelaunayMeshGenerator::hash(eckit::Hash& h) const {
     h.add("Delaunay");
-
-    // no other settings
+    h.add(method_);
 }
 
 void DelaunayMeshGenerator::generate(const Grid& grid, const grid::Distribution& dist, Mesh& mesh) const {
@@ -91,7 +92,7 @@ void DelaunayMeshGenerator::generate(const Grid& grid, const grid::Distribution&
         }
         mesh::actions::BuildXYZField()(mesh);
         mesh::actions::ExtendNodesGlobal()(grid,mesh);  ///< does nothing if global domain
-        mesh::actions::BuildConvexHull3D()(mesh);
+        mesh::actions::BuildConvexHull3D(util::Config("method", method_))(mesh);
         
         auto cells_gidx = array::make_view<gidx_t,1>( mesh.cells().global_index() );
         for (idx_t jelem=0; jelem<mesh.cells().size(); ++jelem) {
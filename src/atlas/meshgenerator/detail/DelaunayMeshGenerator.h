@@ -10,6 +10,9 @@
 
 #pragma once
 
+#include <string>
+
+#include "atlas/library/config.h"
 #include "atlas/meshgenerator/MeshGenerator.h"
 #include "atlas/meshgenerator/detail/MeshGeneratorImpl.h"
 
@@ -42,6 +45,7 @@ private:  // methods
     int part_;
     bool remove_duplicate_points_;
     bool reshuffle_;
+    std::string method_{ATLAS_HAVE_TESSELATION ? "cgal" : "native"};  ///< see mesh::actions::BuildConvexHull3D
 };
 
 //----------------------------------------------------------------------------------------------------------------------
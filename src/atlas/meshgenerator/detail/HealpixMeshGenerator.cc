@@ -547,7 +547,6 @@ void HealpixMeshGenerator::generate_mesh(const StructuredGrid& grid, const grid:
     ATLAS_ASSERT(HealpixGrid(grid));
 
     const int mypart                = options.get<size_t>("part");
-    const int nparts                = options.get<size_t>("nb_parts");
     const bool three_dimensional    = options.get<bool>("3d");
     const std::string pole_elements = options.get<std::string>("pole_elements");
     const int nb_pole_nodes         = (pole_elements == "pentagons") ? 4 : (three_dimensional ? 1 : 8);
@@ -560,18 +559,29 @@ void HealpixMeshGenerator::generate_mesh(const StructuredGrid& grid, const grid:
     nb_points_     = 12 * ns * ns + (nb_pole_nodes == 8 ? 8 : 0);
     nb_nodes_      = nvertices;
 
-    int inode;
     auto nb_lat_nodes = [ny, nb_pole_nodes, &grid](int latid) {
         return ((latid == 0) or (latid == ny - 1) ? nb_pole_nodes : grid.nx()[latid - 1]);
     };
 
-    int ii, ix, iy, ii_ghost, ii_glb;
-    int iy_min, iy_max;   // a belt (iy_min:iy_max) surrounding the nodes on this processor
-    int nnodes_nonghost;  // non-ghost node: belongs to this part
+    // First node index of each latitude: the nodes of latitude iy have indices ring_begin[iy] ... ring_begin[iy+1]-1.
+    // The periodic (east) node of latitude iy has index nb_nodes_ + iy.
+    std::vector<gidx_t> ring_begin(ny + 1, 0);
+    for (int iy = 0; iy < ny; ++iy) {
+        ring_begin[iy + 1] = ring_begin[iy] + nb_lat_nodes(iy);
+    }
+    ATLAS_ASSERT(ring_begin[ny] == nb_nodes_);
 
-    // vector of local indices: necessary for remote indices of ghost nodes
-    std::vector<int> local_idx(nvertices, -1);
-    std::vector<int> current_idx(nparts, 0);  // index counter for each proc
+    // (ix,iy) location of a node index as returned by idx_xy_to_x, up_idx, down_idx, right_idx, pentagon_right_idx
+    auto node_location = [&](gidx_t idx, int& ix, int& iy) {
+        if (idx >= nb_nodes_) {
+            iy = static_cast<int>(idx - nb_nodes_);
+            ix = nb_lat_nodes(iy);
+        }
+        else {
+            iy = static_cast<int>(std::upper_bound(ring_begin.begin(), ring_begin.end(), idx) - ring_begin.begin()) - 1;
+            ix = static_cast<int>(idx - ring_begin[iy]);
+        }
+    };
 
     // ANSATZ: requirement on the partitioner
     auto compute_part = [&](int iy, gidx_t ii_glb) -> int {
@@ -581,9 +591,9 @@ void HealpixMeshGenerator::generate_mesh(const StructuredGrid& grid, const grid:
     };
 
 #if DEBUG_OUTPUT_DETAIL
-    for (iy = 0; iy < ny; iy++) {
+    for (int iy = 0; iy < ny; iy++) {
         int nx = nb_lat_nodes(iy);
-        for (ix = 0; ix < nx; ix++) {
+        for (int ix = 0; ix < nx; ix++) {
             Log::info() << "iy, ix, glb_idx, up_idx, down_idx, right_idx, pent_right_idx : " << iy << ", " << ix << ", "
                         << idx_xy_to_x(ix, iy, ns) + 1 << ", " << up_idx(ix, iy, ns) + 1 << ", "
                         << down_idx(ix, iy, ns) + 1 << ", " << right_idx(ix, iy, ns) + 1 << ", "
@@ -593,202 +603,162 @@ void HealpixMeshGenerator::generate_mesh(const StructuredGrid& grid, const grid:
     }
 #endif
 
-    // loop over all points to determine local indices and surrounding rectangle
-    ii_glb          = 0;  // global index starting from 0
-    iy_min          = ny + 1;
-    iy_max          = 0;
-    nnodes_nonghost = 0;
-    for (iy = 0; iy < ny; iy++) {
-        int nx = nb_lat_nodes(iy);
-        for (ix = 0; ix < nx; ix++) {
-            int proc_id       = compute_part(iy, ii_glb);
-            local_idx[ii_glb] = current_idx[proc_id]++;
-            if (proc_id == mypart) {
-                ++nnodes_nonghost;
-                iy_min = std::min(iy_min, iy);
-                iy_max = std::max(iy_max, iy);
-            }
-            ++ii_glb;
-        }
-    }
-
-#if DEBUG_OUTPUT_DETAIL
-    inode = 0;
-    Log::info() << "local_idx : " << std::endl;
-    for (size_t ilat = 0; ilat < ny; ilat++) {
-        for (size_t ilon = 0; ilon < nb_lat_nodes(ilat); ilon++) {
-            Log::info() << std::setw(4) << local_idx[inode];
-            inode++;
-        }
-        Log::info() << std::endl;
-    }
-    inode = 0;
-    Log::info() << "global_idx : " << std::endl;
-    for (size_t ilat = 0; ilat < ny; ilat++) {
-        for (size_t ilon = 0; ilon < nb_lat_nodes(ilat); ilon++) {
-            Log::info() << std::setw(4) << inode;
-            inode++;
-        }
-        Log::info() << std::endl;
-    }
-#endif
-
-    // dimensions of surrounding belt (SB)
-    int nnodes_SB = 0;
-    if (iy_min <= 2) {
-        iy_min = 0;
-    }
-    else {
-        --iy_min;
-    }
-    if (iy_max >= ny - 3) {
-        iy_max = ny - 1;
-    }
-    else {
-        ++iy_max;
-    }
-    for (int iy = iy_min; iy <= iy_max; iy++) {
-        // (east) periodic point adds +1 here
-        nnodes_SB += nb_lat_nodes(iy) + 1;
-    }
-
-#if DEBUG_OUTPUT
-    Log::info() << "[" << mypart << "] : nnodes_SB = " << nnodes_SB << "\n";
-#endif
-
-    // partitions and local indices in SB
-    std::vector<int> parts_SB(nnodes_SB, -1);
-    std::vector<int> local_idx_SB(nnodes_SB, -1);
-    std::vector<bool> is_ghost_SB(nnodes_SB, true);
-
-    // starting from index 0, first global node-index for this partition
-    int parts_sidx = idx_xy_to_x(0, iy_min, ns);
-
-    ii       = 0;                                  // index inside SB
-    ii_ghost = nnodes_SB - (iy_max - iy_min + 1);  // first local ghost idx
-    for (iy = iy_min; iy <= iy_max; iy++) {
-        int nx = nb_lat_nodes(iy) + 1;
-        for (ix = 0; ix < nx; ix++) {
-            if (ix != nx - 1) {
-                ii_glb           = ii + parts_sidx;
-                parts_SB[ii]     = compute_part(iy, ii_glb);
-                local_idx_SB[ii] = ii;
-                is_ghost_SB[ii]  = !(parts_SB[ii] == mypart);
-                ++ii;
+    // Find the nodes owned by this part, in order of latitude and then longitude.
+    // For partitioners whose partition index does not decrease from west to east along a latitude, the owned nodes
+    // of each latitude form one contiguous range, found by bisection, so that only the local part of the grid is
+    // visited. For other partitioners every node is checked.
+    std::vector<gidx_t> owned;
+    {
+        ATLAS_TRACE("owned nodes");
+        static const std::vector<std::string> monotonic_types{"serial", "bands", "regular_bands", "equal_bands",
+                                                              "equal_regions"};
+        const bool monotonic =
+            std::find(monotonic_types.begin(), monotonic_types.end(), distribution.type()) != monotonic_types.end();
+
+        for (int iy = 0; iy < ny; ++iy) {
+            const int nx = nb_lat_nodes(iy);
+            auto part_of = [&](int ix) { return compute_part(iy, ring_begin[iy] + ix); };
+            if (monotonic) {
+                // first ix with part >= mypart, and first ix with part > mypart
+                auto bisect = [&](bool inclusive) {
+                    int lo = 0;
+                    int hi = nx;
+                    while (lo < hi) {
+                        int mid = lo + (hi - lo) / 2;
+                        int p   = part_of(mid);
+                        if (p < mypart || (inclusive && p == mypart)) {
+                            lo = mid + 1;
+                        }
+                        else {
+                            hi = mid;
+                        }
+                    }
+                    return lo;
+                };
+                const int ix_begin = bisect(false);
+                const int ix_end   = bisect(true);
+                for (int ix = ix_begin; ix < ix_end; ++ix) {
+                    owned.emplace_back(ring_begin[iy] + ix);
+                }
             }
             else {
-                parts_SB[ii_ghost]     = compute_part(iy, ii_glb);
-                local_idx_SB[ii_ghost] = ii_ghost;
-                is_ghost_SB[ii_ghost]  = true;
-                ++ii_ghost;
+                for (int ix = 0; ix < nx; ++ix) {
+                    if (part_of(ix) == mypart) {
+                        owned.emplace_back(ring_begin[iy] + ix);
+                    }
+                }
             }
         }
     }
 
-#if DEBUG_OUTPUT_DETAIL
-    Log::info() << "[" << mypart << "] : "
-                << "parts_SB = ";
-    for (ii = 0; ii < nnodes_SB; ii++) {
-        Log::info() << parts_SB[ii] << ",";
-    }
-    Log::info() << std::endl;
-    Log::info() << "[" << mypart << "] : "
-                << "local_idx_SB = ";
-    for (ii = 0; ii < nnodes_SB; ii++) {
-        Log::info() << local_idx_SB[ii] << ",";
-    }
-    Log::info() << std::endl;
-    Log::info() << "[" << mypart << "] : "
-                << "is_ghost_SB = ";
-    for (ii = 0; ii < nnodes_SB; ii++) {
-        Log::info() << is_ghost_SB[ii] << ",";
-    }
-    Log::info() << std::endl;
-#endif
-
-    // vectors marking nodes that are necessary for this proc's cells
-    std::vector<bool> is_node_SB(nnodes_SB, false);
-
-    // determine number of cells and number of nodes
-    int nnodes = 0;
+    // Define the cells owned by this part and collect their vertices
+    std::vector<gidx_t> cell_vertices;  // 4 or 5 node indices per cell
+    std::vector<int> cell_nb_vertices;
+    std::vector<gidx_t> cell_glb_idx;
     int nquads = 0;
     int npents = 0;
-    ii         = 0;
-
-    int glb2loc_ghost_offset = -nnodes_SB + iy_max + nb_nodes_ + 1;
-    auto get_local_id        = [this, &parts_sidx, &glb2loc_ghost_offset](gidx_t gidx) {
-        return gidx - (gidx < nb_nodes_ ? parts_sidx : glb2loc_ghost_offset);
-    };
-
-    for (iy = iy_min; iy <= iy_max; iy++) {
-        int nx = nb_lat_nodes(iy);
-        for (ix = 0; ix < nx; ix++) {
-            if (not is_ghost_SB[ii]) {
-                const bool at_pole      = (iy == 0 or iy == ny - 1);
-                bool not_duplicate_cell = (at_pole ? (ix % 2) : 1);
-                if (at_pole and nb_pole_nodes < 8) {
-                    // nodes at the poles do not own any pentagons
-                    // if nb_pole_node=1, the node at the poles does not own any quads
-                    not_duplicate_cell = false;
-                }
-                if (not at_pole or not_duplicate_cell) {
-                    if (not is_node_SB[ii]) {
-                        ++nnodes;
-                        is_node_SB[ii] = true;
-                    }
-                    bool is_pentagon = (pole_elements == "pentagons" and (iy == 1 or iy == ny - 2));
-                    if (is_pentagon) {
-                        ++npents;
-                        // mark the pentagon right node
-                        idx_t iil = get_local_id(pentagon_right_idx(ix, iy, ns));
-                        if (not is_node_SB[iil]) {
-                            ++nnodes;
-                            is_node_SB[iil] = true;
-                        }
-                    }
-                    else {
-                        ++nquads;
-                    }
-                    // mark upper corner
-                    idx_t iil = get_local_id(up_idx(ix, iy, ns));
-                    if (not is_node_SB[iil]) {
-                        ++nnodes;
-                        is_node_SB[iil] = true;
-                    }
-                    // mark lower corner
-                    iil = get_local_id(down_idx(ix, iy, ns));
-                    if (not is_node_SB[iil]) {
-                        ++nnodes;
-                        is_node_SB[iil] = true;
-                    }
-                    // mark right corner
-                    iil = get_local_id(right_idx(ix, iy, ns));
-                    if (not is_node_SB[iil]) {
-                        ++nnodes;
-                        is_node_SB[iil] = true;
-                    }
-                }
+    cell_vertices.reserve(4 * owned.size() + 4);
+    cell_nb_vertices.reserve(owned.size());
+    cell_glb_idx.reserve(owned.size());
+    for (gidx_t idx : owned) {
+        int ix, iy;
+        node_location(idx, ix, iy);
+        const bool at_pole = (iy == 0 or iy == ny - 1);
+        if (at_pole and (nb_pole_nodes < 8 or ix % 2 == 0)) {
+            // if nb_pole_nodes = 8 : only every other pole node owns a quad
+            // if nb_pole_nodes = 4 : the pole nodes do not own any pentagons
+            // if nb_pole_nodes = 1 : the pole nodes do not own any quads
+            continue;
+        }
+        const bool pentagon         = (pole_elements == "pentagons" and (iy == 1 or iy == ny - 2));
+        const bool south_hemisphere = (iy > 2 * ns);
+
+        // cell vertices, in anti-clockwise order
+        cell_vertices.emplace_back(idx);
+        cell_vertices.emplace_back(down_idx(ix, iy, ns));
+        if (pentagon && not south_hemisphere) {
+            cell_vertices.emplace_back(pentagon_right_idx(ix, iy, ns));
+        }
+        cell_vertices.emplace_back(right_idx(ix, iy, ns));
+        if (pentagon && south_hemisphere) {
+            // in the south hemisphere the pentagon point comes in a different clock-wise ordering
+            cell_vertices.emplace_back(pentagon_right_idx(ix, iy, ns));
+        }
+        cell_vertices.emplace_back(up_idx(ix, iy, ns));
+        cell_nb_vertices.emplace_back(pentagon ? 5 : 4);
+
+        // match global cell indexing for the three healpix versions
+        gidx_t glb;
+        if (nb_pole_nodes == 1) {
+            glb = idx;
+        }
+        else if (nb_pole_nodes == 8) {
+            if (iy == 0) {
+                glb = 12 * ns * ns + 1 + ix / 2;
+            }
+            else if (iy == ny - 1) {
+                glb = 12 * ns * ns + 5 + ix / 2;
+            }
+            else {
+                glb = idx - 7;
+            }
+        }
+        else {
+            if (pentagon) {
+                glb = (iy == 1 ? ix + 1 : 12 * ns * ns - 3 + ix);
+            }
+            else {
+                glb = idx - 3;
             }
-            ++ii;
         }
+        cell_glb_idx.emplace_back(glb);
+        pentagon ? ++npents : ++nquads;
     }
     int ncells = nquads + npents;
     ATLAS_ASSERT(ncells > 0);
 
+    // Nodes needed by the cells of this part, sorted by index for lookup
+    std::vector<gidx_t> node_idx(cell_vertices);
+    std::sort(node_idx.begin(), node_idx.end());
+    node_idx.erase(std::unique(node_idx.begin(), node_idx.end()), node_idx.end());
+    const int nnodes = static_cast<int>(node_idx.size());
+
+    // Local numbering: non-ghost nodes first, then ghost nodes; each in order of latitude and then longitude,
+    // with the periodic node of a latitude last.
+    std::vector<int> node_ix(nnodes);
+    std::vector<int> node_iy(nnodes);
+    std::vector<int> node_part(nnodes);
+    std::vector<bool> node_ghost(nnodes);
+    for (int n = 0; n < nnodes; ++n) {
+        node_location(node_idx[n], node_ix[n], node_iy[n]);
+        const bool periodic = (node_idx[n] >= nb_nodes_);
+        // the periodic node gets its proc rank from the last node of the latitude
+        node_part[n]  = compute_part(node_iy[n], periodic ? ring_begin[node_iy[n] + 1] - 1 : node_idx[n]);
+        node_ghost[n] = periodic or node_part[n] != mypart;
+    }
+    std::vector<int> order(nnodes);
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&](int a, int b) -> bool {
+        if (node_ghost[a] != node_ghost[b]) {
+            return node_ghost[b];
+        }
+        if (node_iy[a] != node_iy[b]) {
+            return node_iy[a] < node_iy[b];
+        }
+        return node_ix[a] < node_ix[b];
+    });
+    std::vector<idx_t> node_local(nnodes);
+    for (int inode = 0; inode < nnodes; ++inode) {
+        node_local[order[inode]] = inode;
+    }
+    auto local_index = [&](gidx_t idx) -> idx_t {
+        return node_local[std::lower_bound(node_idx.begin(), node_idx.end(), idx) - node_idx.begin()];
+    };
+
 #if DEBUG_OUTPUT
     Log::info() << "[" << mypart << "] : "
                 << "nnodes = " << nnodes << ", nquads = " << nquads << ", npents = " << npents
-                << ", parts_sidx = " << parts_sidx << std::endl;
-    Log::info() << "[" << mypart << "] : "
-                << "iy_min = " << iy_min << ", iy_max = " << iy_max << std::endl;
-#endif
-#if DEBUG_OUTPUT_DETAIL
-    Log::info() << "[" << mypart << "] : "
-                << "is_node_SB = ";
-    for (int ii = 0; ii < nnodes_SB; ii++) {
-        Log::info() << is_node_SB[ii] << ",";
-    }
-    Log::info() << std::endl;
+                << ", nowned = " << owned.size() << std::endl;
 #endif
 
     // define nodes and associated properties
@@ -812,221 +782,117 @@ void HealpixMeshGenerator::generate_mesh(const StructuredGrid& grid, const grid:
     auto cells_glb_idx      = array::make_view<gidx_t, 1>(mesh.cells().global_index());
     auto& node_connectivity = mesh.cells().node_connectivity();
 
-    idx_t cell_nodes[5];
-    int jquadcell = quad_begin;
-    int jpentcell = pent_begin;
-
-    int inode_nonghost, inode_ghost;
-
     // loop over nodes and set properties
-    inode_nonghost = 0;
-    inode_ghost    = nnodes_nonghost;  // ghost nodes start counting after nonghost nodes
-    ii             = 0;                // index inside SB
-    for (iy = iy_min; iy <= iy_max; iy++) {
-        int nx = nb_lat_nodes(iy) + 1;
-        for (ix = 0; ix < nx; ix++) {
-            int iil = idx_xy_to_x(ix, iy, ns);
-            iil -= (iil < nb_nodes_ ? parts_sidx : -nnodes_SB + iy_max + nb_nodes_ + 1);
-            if (is_node_SB[iil]) {
-                // set node counter
-                if (is_ghost_SB[iil]) {
-                    inode = inode_ghost++;
-                }
-                else {
-                    inode = inode_nonghost++;
-                }
-
-                // flags
-                Topology::reset(flags(inode));
-
-                glb_idx(inode) = 1 + match_node_idx(idx_xy_to_x(ix, iy, ns), ns);
-
-                // grid coordinates
-                double _xy[2];
-                double xy1[2], xy2[2];
-                if (iy == 0) {
-                    _xy[0] = (nb_pole_nodes == 8 ? 45. * ix : (nb_pole_nodes == 4 ? 90. * ix : 180.));
-                    _xy[1] = 90.;
-                    Topology::set(flags(inode), Topology::BC);
-                }
-                else if (iy == ny - 1) {
-                    _xy[0] = (nb_pole_nodes == 8 ? 45. * ix : (nb_pole_nodes == 4 ? 90. * ix : 180.));
-                    _xy[1] = -90.;
-                    Topology::set(flags(inode), Topology::BC);
-                }
-                else if (ix == nx - 1) {
-                    grid.xy(ix - 1, iy - 1, xy1);
-                    grid.xy(ix - 2, iy - 1, xy2);
-                    _xy[0] = 1.5 * xy1[0] - 0.5 * xy2[0];
-                    _xy[1] = xy1[1];
-                    Topology::set(flags(inode), Topology::BC);
-                }
-                else if (ix == 0) {
-                    grid.xy(ix + 1, iy - 1, xy1);
-                    grid.xy(ix, iy - 1, xy2);
-                    _xy[0] = 1.5 * xy2[0] - 0.5 * xy1[0];
-                    _xy[1] = xy1[1];
-                    Topology::set(flags(inode), Topology::BC);
-                }
-                else {
-                    grid.xy(ix, iy - 1, xy1);
-                    grid.xy(ix - 1, iy - 1, xy2);
-                    _xy[0] = 0.5 * (xy1[0] + xy2[0]);
-                    _xy[1] = xy1[1];
-                }
+    for (int inode = 0; inode < nnodes; ++inode) {
+        const int n  = order[inode];
+        const int ix = node_ix[n];
+        const int iy = node_iy[n];
+        const int nx = nb_lat_nodes(iy) + 1;
+
+        // flags
+        Topology::reset(flags(inode));
+
+        glb_idx(inode) = 1 + match_node_idx(node_idx[n], ns);
+
+        // grid coordinates
+        double _xy[2];
+        double xy1[2], xy2[2];
+        if (iy == 0) {
+            _xy[0] = (nb_pole_nodes == 8 ? 45. * ix : (nb_pole_nodes == 4 ? 90. * ix : 180.));
+            _xy[1] = 90.;
+            Topology::set(flags(inode), Topology::BC);
+        }
+        else if (iy == ny - 1) {
+            _xy[0] = (nb_pole_nodes == 8 ? 45. * ix : (nb_pole_nodes == 4 ? 90. * ix : 180.));
+            _xy[1] = -90.;
+            Topology::set(flags(inode), Topology::BC);
+        }
+        else if (ix == nx - 1) {
+            grid.xy(ix - 1, iy - 1, xy1);
+            grid.xy(ix - 2, iy - 1, xy2);
+            _xy[0] = 1.5 * xy1[0] - 0.5 * xy2[0];
+            _xy[1] = xy1[1];
+            Topology::set(flags(inode), Topology::BC);
+        }
+        else if (ix == 0) {
+            grid.xy(ix + 1, iy - 1, xy1);
+            grid.xy(ix, iy - 1, xy2);
+            _xy[0] = 1.5 * xy2[0] - 0.5 * xy1[0];
+            _xy[1] = xy1[1];
+            Topology::set(flags(inode), Topology::BC);
+        }
+        else {
+            grid.xy(ix, iy - 1, xy1);
+            grid.xy(ix - 1, iy - 1, xy2);
+            _xy[0] = 0.5 * (xy1[0] + xy2[0]);
+            _xy[1] = xy1[1];
+        }
 
-                if (Topology::check(flags(inode), Topology::BC)) {
-                    if (iy == 0) {
-                        Topology::set(flags(inode), Topology::NORTH);
-                    }
-                    else if (iy == ny - 1) {
-                        Topology::set(flags(inode), Topology::SOUTH);
-                    }
-                    if (ix == 0) {
-                        Topology::set(flags(inode), Topology::WEST);
-                    }
-                    else if (ix == nx - 1) {
-                        Topology::set(flags(inode), Topology::EAST | Topology::GHOST);
-                        ATLAS_ASSERT(is_ghost_SB[iil]);
-                    }
-                }
+        if (Topology::check(flags(inode), Topology::BC)) {
+            if (iy == 0) {
+                Topology::set(flags(inode), Topology::NORTH);
+            }
+            else if (iy == ny - 1) {
+                Topology::set(flags(inode), Topology::SOUTH);
+            }
+            if (ix == 0) {
+                Topology::set(flags(inode), Topology::WEST);
+            }
+            else if (ix == nx - 1) {
+                Topology::set(flags(inode), Topology::EAST | Topology::GHOST);
+                ATLAS_ASSERT(node_ghost[n]);
+            }
+        }
 
-                xy(inode, LON) = _xy[LON];
-                xy(inode, LAT) = _xy[LAT];
+        xy(inode, LON) = _xy[LON];
+        xy(inode, LAT) = _xy[LAT];
 
-                // geographic coordinates by using projection
-                grid.projection().xy2lonlat(_xy);
-                lonlat(inode, LON) = _xy[LON];
-                lonlat(inode, LAT) = _xy[LAT];
+        // geographic coordinates by using projection
+        grid.projection().xy2lonlat(_xy);
+        lonlat(inode, LON) = _xy[LON];
+        lonlat(inode, LAT) = _xy[LAT];
 
-                part(inode)  = parts_SB[iil];
-                ghost(inode) = is_ghost_SB[iil];
-                halo(inode)  = 0;
+        part(inode)  = node_part[n];
+        ghost(inode) = node_ghost[n];
+        halo(inode)  = 0;
 
-                if (ghost(inode)) {
-                    Topology::set(flags(inode), Topology::GHOST);
-                    remote_idx(inode) = local_idx_SB[iil];
-                }
-                else {
-                    remote_idx(inode) = -1;
-                }
-                if (Topology::check(flags(inode), Topology::BC | Topology::EAST)) {
-                    part(inode) = mypart;  // To be fixed later
-                }
-                local_idx_SB[iil] = inode;
+        // remote indices are computed by build_parallel_fields
+        remote_idx(inode) = -1;
+        if (ghost(inode)) {
+            Topology::set(flags(inode), Topology::GHOST);
+        }
+        if (Topology::check(flags(inode), Topology::BC | Topology::EAST)) {
+            part(inode) = mypart;  // To be fixed later
+        }
 
 #if DEBUG_OUTPUT_DETAIL
-                Log::info() << "[" << mypart << "] : "
-                            << "New node \tinode=" << inode << "; iil= " << iil << "; ix=" << ix << "; iy=" << iy
-                            << "; glon=" << lonlat(inode, 0) << "; glat=" << lonlat(inode, 1)
-                            << "; glb_idx=" << glb_idx(inode) << "; loc_idx=" << local_idx_SB[iil] << std::endl;
+        Log::info() << "[" << mypart << "] : "
+                    << "New node \tinode=" << inode << "; ix=" << ix << "; iy=" << iy << "; glon=" << lonlat(inode, 0)
+                    << "; glat=" << lonlat(inode, 1) << "; glb_idx=" << glb_idx(inode) << std::endl;
 #endif
-            }
-            ii += (ix != nx - 1 ? 1 : 0);
-        }
     }
 
-    auto get_local_idx_SB = [&local_idx_SB, &get_local_id](gidx_t gidx) { return local_idx_SB[get_local_id(gidx)]; };
-
-    ii               = 0;  // index inside SB (surrounding belt)
-    int jcell_offset = 0;  // global index offset due to extra points at the north pole
-    gidx_t jcell     = 0;  // global cell counter
-    gidx_t points_in_partition = 0;
-    for (iy = iy_min; iy <= iy_max; iy++) {
-        int nx = nb_lat_nodes(iy) + 1;
-        points_in_partition += (nx - 1);
-        for (ix = 0; ix < nx; ix++) {
-            const bool at_pole     = (iy == 0 or iy == ny - 1);
-            int not_duplicate_cell = (at_pole ? ix % 2 : 1);
-            if (at_pole and (not not_duplicate_cell or nb_pole_nodes < 8)) {
-                // if nb_pole_nodes = 4 : the pole nodes do not own any pentagons
-                // if nb_pole_nodes = 1 : the pole nodes do not own any quads
-                continue;
-            }
-            bool pentagon = (iy == 1 or iy == 4 * ns - 1) and pole_elements == "pentagons";
-            int iil       = idx_xy_to_x(ix, iy, ns);
-            iil -= (iil < nb_nodes_ ? parts_sidx : -nnodes_SB + iy_max + nb_nodes_ + 1);
-            if (not is_ghost_SB[iil]) {
-                jcell++;  // a cell will be added
-                // define cell vertices (in local indices) in cell_nodes
-                int node_id           = 0;
-                cell_nodes[node_id++] = get_local_idx_SB(idx_xy_to_x(ix, iy, ns));
-                cell_nodes[node_id++] = get_local_idx_SB(down_idx(ix, iy, ns));
-                bool south_hemisphere = (iy > 2 * ns);
-                if (pentagon && not south_hemisphere) {
-                    cell_nodes[node_id++] = get_local_idx_SB(pentagon_right_idx(ix, iy, ns));
-                }
-                cell_nodes[node_id++] = get_local_idx_SB(right_idx(ix, iy, ns));
-                if (pentagon && south_hemisphere) {
-                    // in the south hemisphere the pentagon point comes in a different clock-wise ordering
-                    cell_nodes[node_id++] = get_local_idx_SB(pentagon_right_idx(ix, iy, ns));
-                }
-                cell_nodes[node_id++] = get_local_idx_SB(up_idx(ix, iy, ns));
-
-                // match global cell indexing for the three healpix versions
-                if (nb_pole_nodes == 1) {
-                    cells_glb_idx(jquadcell) = parts_sidx + points_in_partition - nx + ix + 1;
-                }
-                else if (nb_pole_nodes == 8) {
-                    if (iy == 0) {
-                        cells_glb_idx(jquadcell) = 12 * ns * ns + 1 + ix / 2;
-                        jcell_offset++;
-                    }
-                    else if (iy == ny - 1) {
-                        cells_glb_idx(jquadcell) = 12 * ns * ns + 5 + ix / 2;
-                        jcell_offset++;
-                    }
-                    else {
-                        cells_glb_idx(jquadcell) = parts_sidx + iil - 3 - (mypart != 0 ? 4 : jcell_offset);
-                    }
-                }
-                else if (nb_pole_nodes == 4) {
-                    if (iy == 0 or iy == ny - 1) {
-                        continue;
-                    }
-                    if (pentagon) {
-                        cells_glb_idx(jpentcell) = (mypart != 0 ? 12 * ns * ns - 3 + ix : jcell);
-                        jcell_offset++;
-                    }
-                    else {
-                        cells_glb_idx(jquadcell) = parts_sidx + points_in_partition - nx - 6 + ix + (mypart != 0 ? 4 : jcell_offset);
-                    }
-                }
-#if DEBUG_OUTPUT_DETAIL
-                std::cout << "[" << mypart << "] : ";
-                if (pentagon) {
-                    std::cout << "New pent: loc-idx " << jpentcell << ", glb-idx " << cells_glb_idx(jpentcell) << ": ";
-                }
-                else {
-                    std::cout << "New quad: loc-idx " << jquadcell << ", glb-idx " << cells_glb_idx(jquadcell) << ": ";
-                }
-                std::cout << glb_idx(cell_nodes[0]) << "," << glb_idx(cell_nodes[1]) << "," << glb_idx(cell_nodes[2])
-                          << "," << glb_idx(cell_nodes[3]);
-                if (pentagon) {
-                    std::cout << "," << glb_idx(cell_nodes[4]);
-                }
-                std::cout << std::endl;
-#endif
-                // add cell to the node connectivity table
-                if (pentagon) {
-                    cells_part(jpentcell) = mypart;
-                    node_connectivity.set(jpentcell, cell_nodes);
-                    ++jpentcell;
-                }
-                else {
-                    cells_part(jquadcell) = mypart;
-                    node_connectivity.set(jquadcell, cell_nodes);
-                    ++jquadcell;
-                }
-            }
-            ii += (ix != nx - 1 ? 1 : 0);
+    // add cells to the node connectivity table
+    idx_t cell_nodes[5];
+    int jquadcell = quad_begin;
+    int jpentcell = pent_begin;
+    size_t jvertex = 0;
+    for (int jcell = 0; jcell < ncells; ++jcell) {
+        const int nb_vertices = cell_nb_vertices[jcell];
+        for (int jnode = 0; jnode < nb_vertices; ++jnode) {
+            cell_nodes[jnode] = local_index(cell_vertices[jvertex++]);
         }
+        int& jlocal = (nb_vertices == 5 ? jpentcell : jquadcell);
+        cells_glb_idx(jlocal) = cell_glb_idx[jcell];
+        cells_part(jlocal)    = mypart;
+        node_connectivity.set(jlocal, cell_nodes);
+        ++jlocal;
     }
 
 #if DEBUG_OUTPUT_DETAIL
     // list nodes
     Log::info() << "Listing nodes ...";
-    for (inode = 0; inode < nnodes; inode++) {
+    for (int inode = 0; inode < nnodes; inode++) {
         std::cout << "[" << mypart << "] : "
                   << " node " << inode << ": ghost = " << ghost(inode) << ", glb_idx = " << glb_idx(inode)
                   << ", part = " << part(inode) << ", lon = " << lonlat(inode, 0) << ", lat = " << lonlat(inode, 1)
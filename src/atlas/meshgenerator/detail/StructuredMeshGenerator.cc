@@ -1091,12 +1091,6 @@ void StructuredMeshGenerator::generate_mesh(const StructuredGrid& rg, const grid
                 xy(inode, XX) = x;
                 xy(inode, YY) = y;
 
-                // geographic coordinates by using projection
-                double crd[] = {x, y};
-                rg.projection().xy2lonlat(crd);
-                lonlat(inode, LON) = crd[LON];
-                lonlat(inode, LAT) = crd[LAT];
-
                 glb_idx(inode) = n + 1;
                 part(inode)    = distribution.partition(n);
                 ghost(inode)   = 0;
@@ -1137,12 +1131,6 @@ void StructuredMeshGenerator::generate_mesh(const StructuredGrid& rg, const grid
                 xy(inode, XX) = x;
                 xy(inode, YY) = y;
 
-                // geographic coordinates by using projection
-                double crd[] = {x, y};
-                rg.projection().xy2lonlat(crd);
-                lonlat(inode, LON) = crd[LON];
-                lonlat(inode, LAT) = crd[LAT];
-
                 glb_idx(inode) = periodic_glb.at(jlat) + 1;
                 //#warning TODO: use commented approach
                 //        part(inode)      = parts.at( offset_glb.at(jlat) );
@@ -1184,12 +1172,6 @@ void StructuredMeshGenerator::generate_mesh(const StructuredGrid& rg, const grid
         xy(inode, XX) = x;
         xy(inode, YY) = y;
 
-        // geographic coordinates by using projection
-        double crd[] = {x, y};
-        rg.projection().xy2lonlat(crd);
-        lonlat(inode, LON) = crd[LON];
-        lonlat(inode, LAT) = crd[LAT];
-
         glb_idx(inode) = periodic_glb.at(rg.ny() - 1) + 2;
         part(inode)    = mypart;
         ghost(inode)   = 0;
@@ -1207,12 +1189,6 @@ void StructuredMeshGenerator::generate_mesh(const StructuredGrid& rg, const grid
         xy(inode, XX) = x;
         xy(inode, YY) = y;
 
-        // geographic coordinates by using projection
-        double crd[] = {x, y};
-        rg.projection().xy2lonlat(crd);
-        lonlat(inode, LON) = crd[LON];
-        lonlat(inode, LAT) = crd[LAT];
-
         glb_idx(inode) = periodic_glb.at(rg.ny() - 1) + 3;
         part(inode)    = mypart;
         ghost(inode)   = 0;
@@ -1221,6 +1197,12 @@ void StructuredMeshGenerator::generate_mesh(const StructuredGrid& rg, const grid
         Topology::set(flags(inode), Topology::SOUTH);
         ++jnode;
     }
+
+    // geographic coordinates of all nodes by using projection
+    ATLAS_ASSERT(xy.stride(0) == lonlat.stride(0));
+    if (nnodes > 0) {
+        rg.projection().xy2lonlat(nnodes, &xy(0, XX), &xy(0, YY), &lonlat(0, LON), &lonlat(0, LAT), xy.stride(0));
+    }
     }
 
     mesh.metadata().set<size_t>("nb_nodes_including_halo[0]", nodes.size());
@@ -19,6 +19,8 @@
 #include "atlas/library/config.h"
 #include "atlas/numerics/Method.h"
 #include "atlas/numerics/Nabla.h"
+#include "atlas/numerics/fd/Method.h"
+#include "atlas/numerics/fd/Nabla.h"
 #include "atlas/numerics/fvm/Method.h"
 #include "atlas/numerics/fvm/Nabla.h"
 #include "atlas/runtime/Exception.h"
@@ -72,7 +74,10 @@ void load_builder() {
 }
 
 struct force_link {
-    force_link() { load_builder<fvm::Nabla>(); }
+    force_link() {
+        load_builder<fvm::Nabla>();
+        load_builder<fd::Nabla>();
+    }
 };
 
 }  // namespace
@@ -0,0 +1,35 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#include "atlas/numerics/fd/Method.h"
+
+#include "atlas/grid/StructuredGrid.h"
+#include "atlas/runtime/Exception.h"
+#include "atlas/util/Earth.h"
+
+namespace atlas {
+namespace numerics {
+namespace fd {
+
+Method::Method(const functionspace::StructuredColumns& fs, const eckit::Configuration& params):
+    structured_columns_(fs), radius_(util::Earth::radius()) {
+    ATLAS_ASSERT(structured_columns_, "atlas::numerics::fd::Method needs a StructuredColumns function space");
+    if (not structured_columns_.grid().domain().global()) {
+        throw_NotImplemented("atlas::numerics::fd::Method is only implemented for global grids", Here());
+    }
+    if (structured_columns_.halo() < 2) {
+        throw_Exception("atlas::numerics::fd::Method requires a StructuredColumns halo of at least 2", Here());
+    }
+    params.get("radius", radius_);
+}
+
+}  // namespace fd
+}  // namespace numerics
+}  // namespace atlas
@@ -0,0 +1,51 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#pragma once
+
+#include <string>
+
+#include "atlas/functionspace/StructuredColumns.h"
+#include "atlas/numerics/Method.h"
+#include "atlas/util/Config.h"
+
+namespace eckit {
+class Configuration;
+}
+
+namespace atlas {
+namespace numerics {
+namespace fd {
+
+/// @brief Finite difference method on the grid points of a global StructuredColumns function space
+///
+/// No mesh is required: stencils are formed from the neighbouring points in i and j, which must be available in
+/// the halo of the function space (halo >= 2).
+class Method : public numerics::Method {
+public:
+    Method(const functionspace::StructuredColumns&, const eckit::Configuration& = util::NoConfig());
+
+    virtual const std::string& name() const override {
+        static std::string _name{"fd"};
+        return _name;
+    }
+
+    const functionspace::StructuredColumns& structured_columns() const { return structured_columns_; }
+
+    const double& radius() const { return radius_; }
+
+private:
+    functionspace::StructuredColumns structured_columns_;
+    double radius_;
+};
+
+}  // namespace fd
+}  // namespace numerics
+}  // namespace atlas
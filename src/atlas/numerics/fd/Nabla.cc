@@ -0,0 +1,361 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+
+#include "eckit/config/Parametrisation.h"
+
+#include "atlas/array/ArrayView.h"
+#include "atlas/array/MakeView.h"
+#include "atlas/field/Field.h"
+#include "atlas/functionspace/StructuredColumns.h"
+#include "atlas/grid/Stencil.h"
+#include "atlas/grid/StencilComputer.h"
+#include "atlas/grid/StructuredGrid.h"
+#include "atlas/numerics/fd/Method.h"
+#include "atlas/numerics/fd/Nabla.h"
+#include "atlas/option.h"
+#include "atlas/parallel/omp/omp.h"
+#include "atlas/runtime/Exception.h"
+#include "atlas/runtime/Log.h"
+#include "atlas/runtime/Trace.h"
+#include "atlas/util/CoordinateEnums.h"
+
+// =======================================================
+
+using Range = atlas::array::Range;
+
+namespace atlas {
+namespace numerics {
+namespace fd {
+
+namespace {
+static NablaBuilder<Nabla> __fd_nabla("fd");
+}
+
+Nabla::Nabla(const numerics::Method& method, const eckit::Parametrisation& p): atlas::numerics::NablaImpl(method, p) {
+    fd_ = dynamic_cast<const fd::Method*>(&method);
+    if (!fd_) {
+        throw_Exception("atlas::numerics::fd::Nabla needs a atlas::numerics::fd::Method", Here());
+    }
+    Log::debug() << "Nabla constructed for method " << fd_->name() << " with "
+                 << fd_->structured_columns().grid().size() << " grid points total" << std::endl;
+    fd_->attach();
+
+    setup();
+}
+
+Nabla::~Nabla() = default;
+
+void Nabla::setup() {
+    ATLAS_TRACE("fd::Nabla::setup");
+    const double deg2rad = M_PI / 180.;
+    const double tol     = 1.e-10;
+
+    const auto& fs   = fd_->structured_columns();
+    const auto& grid = fs.grid();
+    if (90. - std::abs(grid.y().front()) < tol || 90. - std::abs(grid.y().back()) < tol) {
+        throw_NotImplemented("atlas::numerics::fd::Nabla does not support grids with points at the poles", Here());
+    }
+
+    // Rows beyond the poles have latitudes 180 - lat or -180 - lat, and the orientation of vectors is reversed
+    j_begin_halo_ = fs.j_begin_halo();
+    rows_.resize(fs.j_end_halo() - j_begin_halo_);
+    for (idx_t j = fs.j_begin_halo(); j < fs.j_end_halo(); ++j) {
+        Row& row        = rows_[j - j_begin_halo_];
+        row.cos_lat     = std::abs(std::cos(fs.compute_xy(0, j).y() * deg2rad));
+        row.vector_sign = (j < 0 || j >= grid.ny()) ? -1. : 1.;
+    }
+
+    // The stencil of width 3 around a grid point spans the rows j-1, j, j+1. On row j it is centred on the point
+    // itself, on the other rows it consists of the points nearest to the longitude of the point.
+    const grid::ComputeHorizontalStencil compute_horizontal_stencil(grid, 3);
+    const auto xy      = array::make_view<double, 2>(fs.xy());
+    const auto index_i = array::make_indexview<idx_t, 1>(fs.index_i());
+    const auto index_j = array::make_indexview<idx_t, 1>(fs.index_j());
+
+    const idx_t size = fs.sizeOwned();
+    stencils_.resize(size);
+
+    // Exceptions must not escape the parallel loop: invalid stencils are recorded, and reported after the loop
+    idx_t invalid_centre = size;
+    idx_t invalid_halo   = size;
+    atlas_omp_parallel_for(idx_t n = 0; n < size; ++n) {
+        const double x = xy(n, XX);
+        const double y = xy(n, YY);
+        grid::HorizontalStencil<3> stencil;
+        compute_horizontal_stencil(x, y, stencil);
+        if (stencil.j(1) != index_j(n) || stencil.i(1, 1) != index_i(n)) {
+            atlas_omp_critical { invalid_centre = std::min(invalid_centre, n); }
+            continue;
+        }
+        bool in_halo = true;
+        for (idx_t r = 0; r < 3; ++r) {
+            if (stencil.i(0, r) < fs.i_begin_halo(stencil.j(r)) || stencil.i(2, r) >= fs.i_end_halo(stencil.j(r))) {
+                in_halo = false;
+            }
+        }
+        if (!in_halo) {
+            atlas_omp_critical { invalid_halo = std::min(invalid_halo, n); }
+            continue;
+        }
+
+        Stencil& s = stencils_[n];
+        s.row      = stencil.j(1) - j_begin_halo_;
+
+        const double x_east = fs.compute_xy(stencil.i(2, 1), stencil.j(1)).x();
+        const double x_west = fs.compute_xy(stencil.i(0, 1), stencil.j(1)).x();
+        s.east_west         = {fs.index(stencil.i(2, 1), stencil.j(1)), fs.index(stencil.i(0, 1), stencil.j(1))};
+        s.weight_lon        = 1. / ((x_east - x_west) * deg2rad);
+
+        // Quadratic interpolation along the row to the longitude of the point
+        auto interpolation_weights = [&](idx_t r, std::array<idx_t, 3>& points) {
+            std::array<double, 3> xr;
+            for (idx_t a = 0; a < 3; ++a) {
+                xr[a]     = fs.compute_xy(stencil.i(a, r), stencil.j(r)).x();
+                points[a] = fs.index(stencil.i(a, r), stencil.j(r));
+            }
+            std::array<double, 3> w;
+            for (idx_t a = 0; a < 3; ++a) {
+                w[a] = 1.;
+                for (idx_t b = 0; b < 3; ++b) {
+                    if (b != a) {
+                        w[a] *= (x - xr[b]) / (xr[a] - xr[b]);
+                    }
+                }
+            }
+            return w;
+        };
+        const auto w_north = interpolation_weights(0, s.north);
+        const auto w_south = interpolation_weights(2, s.south);
+
+        // Derivative at the point of the parabola through the rows north, centre and south
+        const double y_north = fs.compute_xy(stencil.i(0, 0), stencil.j(0)).y();
+        const double y_south = fs.compute_xy(stencil.i(0, 2), stencil.j(2)).y();
+        const double d_north = (y - y_south) / ((y_north - y) * (y_north - y_south) * deg2rad);
+        const double d_south = (y - y_north) / ((y_south - y) * (y_south - y_north) * deg2rad);
+        for (idx_t a = 0; a < 3; ++a) {
+            s.weight_north[a] = d_north * w_north[a];
+            s.weight_south[a] = d_south * w_south[a];
+        }
+        s.weight_centre = -(d_north + d_south);
+    }
+    if (invalid_centre < size) {
+        throw_AssertionFailed("fd::Nabla stencil of point " + std::to_string(invalid_centre) +
+                                  " is not centred on the point itself",
+                              Here());
+    }
+    if (invalid_halo < size) {
+        throw_Exception("fd::Nabla stencil of point " + std::to_string(invalid_halo) +
+                            " out of bounds of the StructuredColumns halo",
+                        Here());
+    }
+}
+
+template <typename Value, typename Result>
+void Nabla::derivatives(idx_t n, idx_t nlev, const std::array<double, 3>& factors, const Value& value,
+                        const Result& result) const {
+    const Stencil& s = stencils_[n];
+    const std::array<double, 3> w_north{factors[0] * s.weight_north[0], factors[0] * s.weight_north[1],
+                                        factors[0] * s.weight_north[2]};
+    const std::array<double, 3> w_south{factors[2] * s.weight_south[0], factors[2] * s.weight_south[1],
+                                        factors[2] * s.weight_south[2]};
+    const double w_centre = factors[1] * s.weight_centre;
+    for (idx_t jlev = 0; jlev < nlev; ++jlev) {
+        const double dlon = s.weight_lon * (value(s.east_west[0], jlev) - value(s.east_west[1], jlev));
+        const double dlat = w_north[0] * value(s.north[0], jlev) + w_north[1] * value(s.north[1], jlev) +
+                            w_north[2] * value(s.north[2], jlev) + w_centre * value(n, jlev) +
+                            w_south[0] * value(s.south[0], jlev) + w_south[1] * value(s.south[1], jlev) +
+                            w_south[2] * value(s.south[2], jlev);
+        result(jlev, dlon, dlat);
+    }
+}
+
+void Nabla::gradient(const Field& field, Field& grad_field) const {
+    if (field.variables() > 1) {
+        return gradient_of_vector(field, grad_field);
+    }
+    else {
+        return gradient_of_scalar(field, grad_field);
+    }
+}
+
+void Nabla::gradient_of_scalar(const Field& scalar_field, Field& grad_field) const {
+    Log::debug() << "Compute gradient of scalar field " << scalar_field.name() << " with fd method" << std::endl;
+    const double radius = fd_->radius();
+
+    const auto scalar = scalar_field.levels()
+                            ? array::make_view<double, 2>(scalar_field).slice(Range::all(), Range::all())
+                            : array::make_view<double, 1>(scalar_field).slice(Range::all(), Range::dummy());
+    auto grad         = grad_field.levels()
+                            ? array::make_view<double, 3>(grad_field).slice(Range::all(), Range::all(), Range::all())
+                            : array::make_view<double, 2>(grad_field).slice(Range::all(), Range::dummy(), Range::all());
+
+    const idx_t nlev = scalar.shape(1);
+    if (grad.shape(1) != nlev) {
+        throw_AssertionFailed("gradient field should have same number of levels", Here());
+    }
+
+    const std::array<double, 3> ones{1., 1., 1.};
+    auto value = [&](idx_t p, idx_t jlev) { return scalar(p, jlev); };
+
+    const idx_t npts = static_cast<idx_t>(stencils_.size());
+    atlas_omp_parallel_for(idx_t n = 0; n < npts; ++n) {
+        const double metric_lon = 1. / (radius * rows_[stencils_[n].row].cos_lat);
+        const double metric_lat = 1. / radius;
+        derivatives(n, nlev, ones, value, [&](idx_t jlev, double dlon, double dlat) {
+            grad(n, jlev, LON) = metric_lon * dlon;
+            grad(n, jlev, LAT) = metric_lat * dlat;
+        });
+    }
+    grad_field.set_dirty();
+}
+
+void Nabla::gradient_of_vector(const Field& vector_field, Field& grad_field) const {
+    Log::debug() << "Compute gradient of vector field " << vector_field.name() << " with fd method" << std::endl;
+    const double radius = fd_->radius();
+
+    const auto vector =
+        vector_field.levels()
+            ? array::make_view<double, 3>(vector_field).slice(Range::all(), Range::all(), Range::all())
+            : array::make_view<double, 2>(vector_field).slice(Range::all(), Range::dummy(), Range::all());
+    auto grad = grad_field.levels()
+                    ? array::make_view<double, 3>(grad_field).slice(Range::all(), Range::all(), Range::all())
+                    : array::make_view<double, 2>(grad_field).slice(Range::all(), Range::dummy(), Range::all());
+
+    const idx_t nlev = vector.shape(1);
+    if (grad.shape(1) != nlev) {
+        throw_AssertionFailed("gradient field should have same number of levels", Here());
+    }
+
+    enum
+    {
+        LONdLON = 0,
+        LONdLAT = 1,
+        LATdLON = 2,
+        LATdLAT = 3
+    };
+
+    auto u = [&](idx_t p, idx_t jlev) { return vector(p, jlev, LON); };
+    auto v = [&](idx_t p, idx_t jlev) { return vector(p, jlev, LAT); };
+
+    // Halo exchange of fields of type "vector" already reverses the components across the poles
+    const bool reversed = vector_field.metadata().getString("type", "scalar") == "vector";
+    auto sign           = [&](idx_t row) { return reversed ? 1. : rows_[row].vector_sign; };
+
+    const idx_t npts = static_cast<idx_t>(stencils_.size());
+    atlas_omp_parallel_for(idx_t n = 0; n < npts; ++n) {
+        const idx_t row               = stencils_[n].row;
+        const double metric_lon       = 1. / (radius * rows_[row].cos_lat);
+        const double metric_lat       = 1. / radius;
+        const std::array<double, 3> s = {sign(row - 1), 1., sign(row + 1)};
+        derivatives(n, nlev, s, u, [&](idx_t jlev, double dlon, double dlat) {
+            grad(n, jlev, LONdLON) = metric_lon * dlon;
+            grad(n, jlev, LONdLAT) = metric_lat * dlat;
+        });
+        derivatives(n, nlev, s, v, [&](idx_t jlev, double dlon, double dlat) {
+            grad(n, jlev, LATdLON) = metric_lon * dlon;
+            grad(n, jlev, LATdLAT) = metric_lat * dlat;
+        });
+    }
+    grad_field.set_dirty();
+}
+
+// ================================================================================
+
+// In divergence and curl, components are multiplied by cos(lat) of their row. Across the poles both the vector
+// components and cos(lat) change sign. Halo exchange keeps the components of fields of type "scalar", which are
+// multiplied by |cos(lat)|; it reverses those of fields of type "vector", which are multiplied by the signed cos(lat).
+
+void Nabla::divergence(const Field& vector_field, Field& div_field) const {
+    const double radius = fd_->radius();
+
+    const auto vector =
+        vector_field.levels()
+            ? array::make_view<double, 3>(vector_field).slice(Range::all(), Range::all(), Range::all())
+            : array::make_view<double, 2>(vector_field).slice(Range::all(), Range::dummy(), Range::all());
+    auto div = div_field.levels() ? array::make_view<double, 2>(div_field).slice(Range::all(), Range::all())
+                                  : array::make_view<double, 1>(div_field).slice(Range::all(), Range::dummy());
+
+    const idx_t nlev = vector.shape(1);
+    if (div.shape(1) != nlev) {
+        throw_AssertionFailed("div_field should have same number of levels", Here());
+    }
+
+    const std::array<double, 3> ones{1., 1., 1.};
+    auto u = [&](idx_t p, idx_t jlev) { return vector(p, jlev, LON); };
+    auto v = [&](idx_t p, idx_t jlev) { return vector(p, jlev, LAT); };
+
+    const bool reversed = vector_field.metadata().getString("type", "scalar") == "vector";
+    auto cos_lat        = [&](idx_t row) { return (reversed ? rows_[row].vector_sign : 1.) * rows_[row].cos_lat; };
+
+    const idx_t npts = static_cast<idx_t>(stencils_.size());
+    atlas_omp_parallel_for(idx_t n = 0; n < npts; ++n) {
+        const idx_t row                 = stencils_[n].row;
+        const double metric             = 1. / (radius * rows_[row].cos_lat);
+        const std::array<double, 3> cos = {cos_lat(row - 1), rows_[row].cos_lat, cos_lat(row + 1)};
+        derivatives(n, nlev, ones, u, [&](idx_t jlev, double dlon, double) { div(n, jlev) = dlon; });
+        derivatives(n, nlev, cos, v,
+                    [&](idx_t jlev, double, double dlat) { div(n, jlev) = metric * (div(n, jlev) + dlat); });
+    }
+    div_field.set_dirty();
+}
+
+void Nabla::curl(const Field& vector_field, Field& curl_field) const {
+    const double radius = fd_->radius();
+
+    const auto vector =
+        vector_field.levels()
+            ? array::make_view<double, 3>(vector_field).slice(Range::all(), Range::all(), Range::all())
+            : array::make_view<double, 2>(vector_field).slice(Range::all(), Range::dummy(), Range::all());
+    auto curl = curl_field.levels() ? array::make_view<double, 2>(curl_field).slice(Range::all(), Range::all())
+                                    : array::make_view<double, 1>(curl_field).slice(Range::all(), Range::dummy());
+
+    const idx_t nlev = vector.shape(1);
+    if (curl.shape(1) != nlev) {
+        throw_AssertionFailed("curl field should have same number of levels", Here());
+    }
+
+    const std::array<double, 3> ones{1., 1., 1.};
+    auto u = [&](idx_t p, idx_t jlev) { return vector(p, jlev, LON); };
+    auto v = [&](idx_t p, idx_t jlev) { return vector(p, jlev, LAT); };
+
+    const bool reversed = vector_field.metadata().getString("type", "scalar") == "vector";
+    auto cos_lat        = [&](idx_t row) { return (reversed ? rows_[row].vector_sign : 1.) * rows_[row].cos_lat; };
+
+    const idx_t npts = static_cast<idx_t>(stencils_.size());
+    atlas_omp_parallel_for(idx_t n = 0; n < npts; ++n) {
+        const idx_t row                 = stencils_[n].row;
+        const double metric             = 1. / (radius * rows_[row].cos_lat);
+        const std::array<double, 3> cos = {cos_lat(row - 1), rows_[row].cos_lat, cos_lat(row + 1)};
+        derivatives(n, nlev, ones, v, [&](idx_t jlev, double dlon, double) { curl(n, jlev) = dlon; });
+        derivatives(n, nlev, cos, u,
+                    [&](idx_t jlev, double, double dlat) { curl(n, jlev) = metric * (curl(n, jlev) - dlat); });
+    }
+    curl_field.set_dirty();
+}
+
+void Nabla::laplacian(const Field& scalar, Field& lapl) const {
+    const auto& fs = fd_->structured_columns();
+    Field grad(fs.createField<double>(option::name("grad") | option::levels(scalar.levels()) | option::variables(2)));
+    gradient(scalar, grad);
+    fs.haloExchange(grad);
+    divergence(grad, lapl);
+}
+
+const FunctionSpace& Nabla::functionspace() const {
+    return fd_->structured_columns();
+}
+
+}  // namespace fd
+}  // namespace numerics
+}  // namespace atlas
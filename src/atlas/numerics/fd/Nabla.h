@@ -0,0 +1,98 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#pragma once
+
+#include <array>
+#include <vector>
+
+#include "atlas/library/config.h"
+#include "atlas/numerics/Nabla.h"
+
+namespace atlas {
+namespace numerics {
+namespace fd {
+class Method;
+}
+}  // namespace numerics
+}  // namespace atlas
+
+namespace atlas {
+class Field;
+}
+
+namespace atlas {
+namespace numerics {
+namespace fd {
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+/// Second order finite differences on the owned points of a StructuredColumns function space.
+///
+/// Longitudinal derivatives are centred differences along the grid row. Latitudinal derivatives are centred
+/// differences over the rows north and south, after quadratic interpolation of these rows to the longitude of the
+/// point, using stencils of grid::ComputeHorizontalStencil. Across the poles, stencil rows lie in the halo of the
+/// function space, where the sign of vector components is reversed.
+///
+/// Results are computed for owned points only, and the halo of the output fields is marked dirty.
+class Nabla : public atlas::numerics::NablaImpl {
+public:
+    Nabla(const atlas::numerics::Method&, const eckit::Parametrisation&);
+    virtual ~Nabla() override;
+
+    virtual void gradient(const Field& scalar, Field& grad) const override;
+    virtual void divergence(const Field& vector, Field& div) const override;
+    virtual void curl(const Field& vector, Field& curl) const override;
+    virtual void laplacian(const Field& scalar, Field& laplacian) const override;
+
+    virtual const FunctionSpace& functionspace() const override;
+
+private:
+    void setup();
+
+    void gradient_of_scalar(const Field& scalar, Field& grad) const;
+    void gradient_of_vector(const Field& vector, Field& grad) const;
+
+    // Calls result(jlev, d/dlon, d/dlat) of value(point, jlev) at owned point n for all levels, with the weights of
+    // the rows north, centre and south multiplied by factors
+    template <typename Value, typename Result>
+    void derivatives(idx_t n, idx_t nlev, const std::array<double, 3>& factors, const Value& value,
+                     const Result& result) const;
+
+    // Stencil of an owned point, with weights per radian
+    struct Stencil {
+        idx_t row;                           // index in rows_ of the row of the point
+        std::array<idx_t, 2> east_west;      // neighbours on the same row
+        std::array<idx_t, 3> north;          // points of the row to the north
+        std::array<idx_t, 3> south;          // points of the row to the south
+        double weight_lon;                   // d/dlon = weight_lon * (f[east] - f[west])
+        std::array<double, 3> weight_north;  // d/dlat = sum(weight_north * f[north]) + weight_centre * f
+        std::array<double, 3> weight_south;  //          + sum(weight_south * f[south])
+        double weight_centre;
+    };
+
+    // Properties of the rows j_begin_halo ... j_end_halo of the function space
+    struct Row {
+        double cos_lat;      // cosine of latitude
+        double vector_sign;  // -1 for rows across the pole, for vector components not reversed by halo exchange
+    };
+
+private:
+    fd::Method const* fd_;
+    idx_t j_begin_halo_;
+    std::vector<Row> rows_;
+    std::vector<Stencil> stencils_;
+};
+#endif
+
+// ------------------------------------------------------------------
+
+}  // namespace fd
+}  // namespace numerics
+}  // namespace atlas
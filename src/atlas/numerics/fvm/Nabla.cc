@@ -8,6 +8,8 @@
  * nor does it submit to any jurisdiction.
  */
 
+#include <cmath>
+
 #include "eckit/config/Parametrisation.h"
 
 #include "atlas/array/ArrayView.h"
@@ -18,6 +20,7 @@
 #include "atlas/mesh/Nodes.h"
 #include "atlas/numerics/fvm/Method.h"
 #include "atlas/numerics/fvm/Nabla.h"
+#include "atlas/option.h"
 #include "atlas/parallel/omp/omp.h"
 #include "atlas/runtime/Exception.h"
 #include "atlas/runtime/Log.h"
@@ -62,40 +65,103 @@ Nabla::Nabla(const numerics::Method& method, const eckit::Parametrisation& p): a
 Nabla::~Nabla() = default;
 
 void Nabla::setup() {
-    const mesh::Edges& edges = fvm_->mesh().edges();
+    const double radius  = fvm_->radius();
+    const double deg2rad = M_PI / 180.;
+    const double scale   = deg2rad * deg2rad * radius;
 
-    const idx_t nedges = fvm_->edge_columns().nb_edges();
+    const mesh::Nodes& nodes = fvm_->mesh().nodes();
+    const idx_t nnodes       = fvm_->node_columns().nb_nodes();
 
-    const auto edge_flags = array::make_view<int, 1>(edges.flags());
-    auto is_pole_edge     = [&](idx_t e) { return Topology::check(edge_flags(e), Topology::POLE); };
+    const auto lonlat_deg   = array::make_view<double, 2>(nodes.lonlat());
+    const auto dual_volumes = array::make_view<double, 1>(nodes.field("dual_volumes"));
 
-    // Filter pole_edges out of all edges
-    std::vector<idx_t> tmp(nedges);
-    idx_t c(0);
-    for (idx_t jedge = 0; jedge < nedges; ++jedge) {
-        if (is_pole_edge(jedge)) {
-            tmp[c++] = jedge;
-        }
+    cos_lat_.resize(nnodes);
+    dual_volumes_.resize(nnodes);
+    atlas_omp_parallel_for(idx_t jnode = 0; jnode < nnodes; ++jnode) {
+        cos_lat_[jnode]      = std::cos(lonlat_deg(jnode, LAT) * deg2rad);
+        dual_volumes_[jnode] = dual_volumes(jnode) * scale;
+    }
+}
+
+namespace {
+
+template <typename Value>
+auto make_scalar_view(const Field& field) {
+    return field.levels() ? array::make_view<Value, 2>(field).slice(Range::all(), Range::all())
+                          : array::make_view<Value, 1>(field).slice(Range::all(), Range::dummy());
+}
+
+template <typename Value>
+auto make_vector_view(const Field& field) {
+    return field.levels() ? array::make_view<Value, 3>(field).slice(Range::all(), Range::all(), Range::all())
+                          : array::make_view<Value, 2>(field).slice(Range::all(), Range::dummy(), Range::all());
+}
+
+bool is_float(const Field& field) {
+    if (field.datatype() == array::DataType::kind<double>()) {
+        return false;
     }
-    pole_edges_.clear();
-    pole_edges_.reserve(c);
-    for (idx_t jedge = 0; jedge < c; ++jedge) {
-        pole_edges_.push_back(tmp[jedge]);
+    if (field.datatype() != array::DataType::kind<float>()) {
+        throw_Exception("atlas::numerics::fvm::Nabla only supports fields of type double or float", Here());
     }
+    return true;
 }
 
+// Calls functor(Value(), Result()) with the value types of the input and output fields
+template <typename Functor>
+void dispatch(const Field& input, const Field& output, const Functor& functor) {
+    const bool float_input  = is_float(input);
+    const bool float_output = is_float(output);
+    if (not float_input && not float_output) {
+        functor(double(), double());
+    }
+    else if (float_input && float_output) {
+        functor(float(), float());
+    }
+    else if (float_input) {
+        functor(float(), double());
+    }
+    else {
+        functor(double(), float());
+    }
+}
+
+}  // namespace
+
 void Nabla::gradient(const Field& field, Field& grad_field) const {
     if (field.variables() > 1) {
-        return gradient_of_vector(field, grad_field);
+        dispatch(field, grad_field, [&](auto value, auto result) {
+            gradient_of_vector<decltype(value), decltype(result)>(field, grad_field);
+        });
     }
     else {
-        return gradient_of_scalar(field, grad_field);
+        dispatch(field, grad_field, [&](auto value, auto result) {
+            gradient_of_scalar<decltype(value), decltype(result)>(field, grad_field);
+        });
     }
 }
 
+void Nabla::divergence(const Field& vector_field, Field& div_field) const {
+    dispatch(vector_field, div_field, [&](auto value, auto result) {
+        divergence_of_vector<decltype(value), decltype(result)>(vector_field, div_field);
+    });
+}
+
+void Nabla::curl(const Field& vector_field, Field& curl_field) const {
+    dispatch(vector_field, curl_field, [&](auto value, auto result) {
+        curl_of_vector<decltype(value), decltype(result)>(vector_field, curl_field);
+    });
+}
+
+// ================================================================================
+
+// The kernels below loop over nodes and accumulate the contributions of the edges of each node directly, computing
+// the average over an edge once for each of its two nodes rather than storing edge averages in a temporary array.
+// Arithmetic is in double precision for any field type.
+
+template <typename Value, typename Result>
 void Nabla::gradient_of_scalar(const Field& scalar_field, Field& grad_field) const {
     Log::debug() << "Compute gradient of scalar field " << scalar_field.name() << " with fvm method" << std::endl;
-    const double radius  = fvm_->radius();
     const double deg2rad = M_PI / 180.;
 
     const mesh::Edges& edges = fvm_->mesh().edges();
@@ -104,75 +170,54 @@ void Nabla::gradient_of_scalar(const Field& scalar_field, Field& grad_field) con
     const idx_t nnodes = fvm_->node_columns().nb_nodes();
     const idx_t nedges = fvm_->edge_columns().nb_edges();
 
-    const auto scalar = scalar_field.levels()
-                            ? array::make_view<double, 2>(scalar_field).slice(Range::all(), Range::all())
-                            : array::make_view<double, 1>(scalar_field).slice(Range::all(), Range::dummy());
-    auto grad         = grad_field.levels()
-                            ? array::make_view<double, 3>(grad_field).slice(Range::all(), Range::all(), Range::all())
-                            : array::make_view<double, 2>(grad_field).slice(Range::all(), Range::dummy(), Range::all());
+    const auto scalar = make_scalar_view<Value>(scalar_field);
+    auto grad         = make_vector_view<Result>(grad_field);
 
     const idx_t nlev = scalar.shape(1);
     if (grad.shape(1) != nlev) {
         throw_AssertionFailed("gradient field should have same number of levels", Here());
     }
 
-    const auto lonlat_deg     = array::make_view<double, 2>(nodes.lonlat());
-    const auto dual_volumes   = array::make_view<double, 1>(nodes.field("dual_volumes"));
     const auto dual_normals   = array::make_view<double, 2>(edges.field("dual_normals"));
     const auto node2edge_sign = array::make_view<double, 2>(nodes.field("node2edge_sign"));
 
     const mesh::Connectivity& node2edge           = nodes.edge_connectivity();
     const mesh::MultiBlockConnectivity& edge2node = edges.node_connectivity();
 
-    array::ArrayT<double> avgS_arr(nedges, nlev, 2ul);
-    auto avgS = array::make_view<double, 3>(avgS_arr);
-
-    const double scale = deg2rad * deg2rad * radius;
-
-    atlas_omp_parallel {
-        atlas_omp_for(idx_t jedge = 0; jedge < nedges; ++jedge) {
-            idx_t ip1 = edge2node(jedge, 0);
-            idx_t ip2 = edge2node(jedge, 1);
-
-            for (idx_t jlev = 0; jlev < nlev; ++jlev) {
-                double avg             = (scalar(ip1, jlev) + scalar(ip2, jlev)) * 0.5;
-                avgS(jedge, jlev, LON) = dual_normals(jedge, LON) * deg2rad * avg;
-                avgS(jedge, jlev, LAT) = dual_normals(jedge, LAT) * deg2rad * avg;
-            }
+    atlas_omp_parallel_for(idx_t jnode = 0; jnode < nnodes; ++jnode) {
+        for (idx_t jlev = 0; jlev < nlev; ++jlev) {
+            grad(jnode, jlev, LON) = 0.;
+            grad(jnode, jlev, LAT) = 0.;
         }
-
-        atlas_omp_for(idx_t jnode = 0; jnode < nnodes; ++jnode) {
-            for (idx_t jlev = 0; jlev < nlev; ++jlev) {
-                grad(jnode, jlev, LON) = 0.;
-                grad(jnode, jlev, LAT) = 0.;
-            }
-            for (idx_t jedge = 0; jedge < node2edge.cols(jnode); ++jedge) {
-                const idx_t iedge = node2edge(jnode, jedge);
-                if (iedge < nedges) {
-                    const double add = node2edge_sign(jnode, jedge);
-                    for (idx_t jlev = 0; jlev < nlev; ++jlev) {
-                        grad(jnode, jlev, LON) += add * avgS(iedge, jlev, LON);
-                        grad(jnode, jlev, LAT) += add * avgS(iedge, jlev, LAT);
-                    }
+        for (idx_t jedge = 0; jedge < node2edge.cols(jnode); ++jedge) {
+            const idx_t iedge = node2edge(jnode, jedge);
+            if (iedge < nedges) {
+                const idx_t ip1    = edge2node(iedge, 0);
+                const idx_t ip2    = edge2node(iedge, 1);
+                const double add   = node2edge_sign(jnode, jedge);
+                const double S[2]  = {dual_normals(iedge, LON) * deg2rad, dual_normals(iedge, LAT) * deg2rad};
+                for (idx_t jlev = 0; jlev < nlev; ++jlev) {
+                    const double avg = (double(scalar(ip1, jlev)) + double(scalar(ip2, jlev))) * 0.5;
+                    grad(jnode, jlev, LON) += add * (S[LON] * avg);
+                    grad(jnode, jlev, LAT) += add * (S[LAT] * avg);
                 }
             }
+        }
 
-            const double y        = lonlat_deg(jnode, LAT) * deg2rad;
-            const double metric_y = 1. / (dual_volumes(jnode) * scale);
-            const double metric_x = metric_y / std::cos(y);
-            for (idx_t jlev = 0; jlev < nlev; ++jlev) {
-                grad(jnode, jlev, LON) *= metric_x;
-                grad(jnode, jlev, LAT) *= metric_y;
-            }
+        const double metric_y = 1. / dual_volumes_[jnode];
+        const double metric_x = metric_y / cos_lat_[jnode];
+        for (idx_t jlev = 0; jlev < nlev; ++jlev) {
+            grad(jnode, jlev, LON) *= metric_x;
+            grad(jnode, jlev, LAT) *= metric_y;
         }
     }
 }
 
 // ================================================================================
 
+template <typename Value, typename Result>
 void Nabla::gradient_of_vector(const Field& vector_field, Field& grad_field) const {
     Log::debug() << "Compute gradient of vector field " << vector_field.name() << " with fvm method" << std::endl;
-    const double radius  = fvm_->radius();
     const double deg2rad = M_PI / 180.;
 
     const mesh::Edges& edges = fvm_->mesh().edges();
@@ -181,21 +226,14 @@ void Nabla::gradient_of_vector(const Field& vector_field, Field& grad_field) con
     const idx_t nnodes = fvm_->node_columns().nb_nodes();
     const idx_t nedges = fvm_->edge_columns().nb_edges();
 
-    const auto vector =
-        vector_field.levels()
-            ? array::make_view<double, 3>(vector_field).slice(Range::all(), Range::all(), Range::all())
-            : array::make_view<double, 2>(vector_field).slice(Range::all(), Range::dummy(), Range::all());
-    auto grad = grad_field.levels()
-                    ? array::make_view<double, 3>(grad_field).slice(Range::all(), Range::all(), Range::all())
-                    : array::make_view<double, 2>(grad_field).slice(Range::all(), Range::dummy(), Range::all());
+    const auto vector = make_vector_view<Value>(vector_field);
+    auto grad         = make_vector_view<Result>(grad_field);
 
     const idx_t nlev = vector.shape(1);
     if (grad.shape(1) != nlev) {
         throw_AssertionFailed("gradient field should have same number of levels", Here());
     }
 
-    const auto lonlat_deg     = array::make_view<double, 2>(nodes.lonlat());
-    const auto dual_volumes   = array::make_view<double, 1>(nodes.field("dual_volumes"));
     const auto dual_normals   = array::make_view<double, 2>(edges.field("dual_normals"));
     const auto node2edge_sign = array::make_view<double, 2>(nodes.field("node2edge_sign"));
     const auto edge_flags     = array::make_view<int, 1>(edges.flags());
@@ -204,11 +242,6 @@ void Nabla::gradient_of_vector(const Field& vector_field, Field& grad_field) con
     const mesh::Connectivity& node2edge           = nodes.edge_connectivity();
     const mesh::MultiBlockConnectivity& edge2node = edges.node_connectivity();
 
-    array::ArrayT<double> avgS_arr(nedges, nlev, 4ul);
-    array::ArrayView<double, 3> avgS = array::make_view<double, 3>(avgS_arr);
-
-    const double scale = deg2rad * deg2rad * radius;
-
     enum
     {
         LONdLON = 0,
@@ -217,70 +250,52 @@ void Nabla::gradient_of_vector(const Field& vector_field, Field& grad_field) con
         LATdLAT = 3
     };
 
-    atlas_omp_parallel {
-        atlas_omp_for(idx_t jedge = 0; jedge < nedges; ++jedge) {
-            idx_t ip1  = edge2node(jedge, 0);
-            idx_t ip2  = edge2node(jedge, 1);
-            double pbc = 1. - 2. * is_pole_edge(jedge);
-
-            for (idx_t jlev = 0; jlev < nlev; ++jlev) {
-                double avg[2]              = {(vector(ip1, jlev, LON) + pbc * vector(ip2, jlev, LON)) * 0.5,
-                                 (vector(ip1, jlev, LAT) + pbc * vector(ip2, jlev, LAT)) * 0.5};
-                avgS(jedge, jlev, LONdLON) = dual_normals(jedge, LON) * deg2rad * avg[LON];
-                // above = 0 at pole because of dual_normals
-                avgS(jedge, jlev, LONdLAT) = dual_normals(jedge, LAT) * deg2rad * avg[LON];
-                avgS(jedge, jlev, LATdLON) = dual_normals(jedge, LON) * deg2rad * avg[LAT];
-                // above = 0 at pole because of dual_normals
-                avgS(jedge, jlev, LATdLAT) = dual_normals(jedge, LAT) * deg2rad * avg[LAT];
-            }
+    atlas_omp_parallel_for(idx_t jnode = 0; jnode < nnodes; ++jnode) {
+        for (idx_t jlev = 0; jlev < nlev; ++jlev) {
+            grad(jnode, jlev, LONdLON) = 0.;
+            grad(jnode, jlev, LONdLAT) = 0.;
+            grad(jnode, jlev, LATdLON) = 0.;
+            grad(jnode, jlev, LATdLAT) = 0.;
         }
-
-        atlas_omp_for(idx_t jnode = 0; jnode < nnodes; ++jnode) {
-            for (idx_t jlev = 0; jlev < nlev; ++jlev) {
-                grad(jnode, jlev, LONdLON) = 0.;
-                grad(jnode, jlev, LONdLAT) = 0.;
-                grad(jnode, jlev, LATdLON) = 0.;
-                grad(jnode, jlev, LATdLAT) = 0.;
-            }
-            for (idx_t jedge = 0; jedge < node2edge.cols(jnode); ++jedge) {
-                const idx_t iedge = node2edge(jnode, jedge);
-                if (iedge < nedges) {
-                    double add = node2edge_sign(jnode, jedge);
-                    for (idx_t jlev = 0; jlev < nlev; ++jlev) {
-                        grad(jnode, jlev, LONdLON) += add * avgS(iedge, jlev, LONdLON);
-                        grad(jnode, jlev, LONdLAT) += add * avgS(iedge, jlev, LONdLAT);
-                        grad(jnode, jlev, LATdLON) += add * avgS(iedge, jlev, LATdLON);
-                        grad(jnode, jlev, LATdLAT) += add * avgS(iedge, jlev, LATdLAT);
-                    }
+        for (idx_t jedge = 0; jedge < node2edge.cols(jnode); ++jedge) {
+            const idx_t iedge = node2edge(jnode, jedge);
+            if (iedge < nedges) {
+                const idx_t ip1      = edge2node(iedge, 0);
+                const idx_t ip2      = edge2node(iedge, 1);
+                const bool pole_edge = is_pole_edge(iedge);
+                const double pbc     = 1. - 2. * pole_edge;
+                const double add     = node2edge_sign(jnode, jedge);
+                // Fix wrong node2edge_sign for vector quantities
+                const double add_lat = (pole_edge && jnode == ip2) ? add - 2. : add;
+                const double S[2]    = {dual_normals(iedge, LON) * deg2rad, dual_normals(iedge, LAT) * deg2rad};
+                for (idx_t jlev = 0; jlev < nlev; ++jlev) {
+                    const double avg[2] = {
+                        (double(vector(ip1, jlev, LON)) + pbc * double(vector(ip2, jlev, LON))) * 0.5,
+                        (double(vector(ip1, jlev, LAT)) + pbc * double(vector(ip2, jlev, LAT))) * 0.5};
+                    grad(jnode, jlev, LONdLON) += add * (S[LON] * avg[LON]);
+                    // above = 0 at pole because of dual_normals
+                    grad(jnode, jlev, LONdLAT) += add_lat * (S[LAT] * avg[LON]);
+                    grad(jnode, jlev, LATdLON) += add * (S[LON] * avg[LAT]);
+                    // above = 0 at pole because of dual_normals
+                    grad(jnode, jlev, LATdLAT) += add_lat * (S[LAT] * avg[LAT]);
                 }
             }
-            const double y        = lonlat_deg(jnode, LAT) * deg2rad;
-            const double metric_y = 1. / (dual_volumes(jnode) * scale);
-            const double metric_x = metric_y / std::cos(y);
-            for (idx_t jlev = 0; jlev < nlev; ++jlev) {
-                grad(jnode, jlev, LONdLON) *= metric_x;
-                grad(jnode, jlev, LATdLON) *= metric_x;
-                grad(jnode, jlev, LONdLAT) *= metric_y;
-                grad(jnode, jlev, LATdLAT) *= metric_y;
-            }
         }
-    }
-    // Fix wrong node2edge_sign for vector quantities
-    for (size_t jedge = 0; jedge < pole_edges_.size(); ++jedge) {
-        const idx_t iedge     = pole_edges_[jedge];
-        const idx_t jnode     = edge2node(iedge, 1);
-        const double metric_y = 1. / (dual_volumes(jnode) * scale);
+        const double metric_y = 1. / dual_volumes_[jnode];
+        const double metric_x = metric_y / cos_lat_[jnode];
         for (idx_t jlev = 0; jlev < nlev; ++jlev) {
-            grad(jnode, jlev, LONdLAT) -= 2. * avgS(iedge, jlev, LONdLAT) * metric_y;
-            grad(jnode, jlev, LATdLAT) -= 2. * avgS(iedge, jlev, LATdLAT) * metric_y;
+            grad(jnode, jlev, LONdLON) *= metric_x;
+            grad(jnode, jlev, LATdLON) *= metric_x;
+            grad(jnode, jlev, LONdLAT) *= metric_y;
+            grad(jnode, jlev, LATdLAT) *= metric_y;
         }
     }
 }
 
 // ================================================================================
 
-void Nabla::divergence(const Field& vector_field, Field& div_field) const {
-    const double radius  = fvm_->radius();
+template <typename Value, typename Result>
+void Nabla::divergence_of_vector(const Field& vector_field, Field& div_field) const {
     const double deg2rad = M_PI / 180.;
 
     const mesh::Edges& edges = fvm_->mesh().edges();
@@ -289,12 +304,8 @@ void Nabla::divergence(const Field& vector_field, Field& div_field) const {
     const idx_t nnodes = fvm_->node_columns().nb_nodes();
     const idx_t nedges = fvm_->edge_columns().nb_edges();
 
-    const auto vector =
-        vector_field.levels()
-            ? array::make_view<double, 3>(vector_field).slice(Range::all(), Range::all(), Range::all())
-            : array::make_view<double, 2>(vector_field).slice(Range::all(), Range::dummy(), Range::all());
-    auto div = div_field.levels() ? array::make_view<double, 2>(div_field).slice(Range::all(), Range::all())
-                                  : array::make_view<double, 1>(div_field).slice(Range::all(), Range::dummy());
+    const auto vector = make_vector_view<Value>(vector_field);
+    auto div          = make_scalar_view<Result>(div_field);
 
     const idx_t nlev = vector.shape(1);
     if (div.shape(1) != nlev) {
@@ -302,7 +313,6 @@ void Nabla::divergence(const Field& vector_field, Field& div_field) const {
     }
 
     const auto lonlat_deg     = array::make_view<double, 2>(nodes.lonlat());
-    const auto dual_volumes   = array::make_view<double, 1>(nodes.field("dual_volumes"));
     const auto dual_normals   = array::make_view<double, 2>(edges.field("dual_normals"));
     const auto node2edge_sign = array::make_view<double, 2>(nodes.field("node2edge_sign"));
     const auto edge_flags     = array::make_view<int, 1>(edges.flags());
@@ -311,75 +321,49 @@ void Nabla::divergence(const Field& vector_field, Field& div_field) const {
     const mesh::Connectivity& node2edge           = nodes.edge_connectivity();
     const mesh::MultiBlockConnectivity& edge2node = edges.node_connectivity();
 
-    array::ArrayT<double> avgS_arr(nedges, nlev, 2ul);
-    array::ArrayView<double, 3> avgS = array::make_view<double, 3>(avgS_arr);
-
-    const double scale = deg2rad * deg2rad * radius;
-
-    enum
-    {
-        LONdLON = 0,
-        LATdLAT = 1
-    };
-    atlas_omp_parallel {
-        atlas_omp_for(idx_t jedge = 0; jedge < nedges; ++jedge) {
-            double pbc = 1 - is_pole_edge(jedge);
-
-            idx_t ip1 = edge2node(jedge, 0);
-            idx_t ip2 = edge2node(jedge, 1);
-            double y1 = lonlat_deg(ip1, LAT) * deg2rad;
-            double y2 = lonlat_deg(ip2, LAT) * deg2rad;
-
-            double cosy1, cosy2;
-            if (metric_approach_ == 0) {
-                cosy1 = std::cos(y1) * pbc;
-                cosy2 = std::cos(y2) * pbc;
-            }
-            else {
-                cosy1 = cosy2 = std::cos(0.5 * (y1 + y2)) * pbc;
-            }
-
-            double S[2] = {dual_normals(jedge, LON) * deg2rad, dual_normals(jedge, LAT) * deg2rad};
-            double avg[2];
-
-            for (idx_t jlev = 0; jlev < nlev; ++jlev) {
-                double u1 = vector(ip1, jlev, LON);
-                double u2 = vector(ip2, jlev, LON);
-                double v1 = vector(ip1, jlev, LAT) * cosy1;
-                double v2 = vector(ip2, jlev, LAT) * cosy2;
-
-                avg[LON] = (u1 + u2) * 0.5;
-                avg[LAT] = (v1 + v2) * 0.5;
-
-                avgS(jedge, jlev, LONdLON) = avg[LON] * S[LON];
-                avgS(jedge, jlev, LATdLAT) = avg[LAT] * S[LAT];
-            }
+    atlas_omp_parallel_for(idx_t jnode = 0; jnode < nnodes; ++jnode) {
+        for (idx_t jlev = 0; jlev < nlev; ++jlev) {
+            div(jnode, jlev) = 0.;
         }
+        for (idx_t jedge = 0; jedge < node2edge.cols(jnode); ++jedge) {
+            const idx_t iedge = node2edge(jnode, jedge);
+            if (iedge < nedges) {
+                const double pbc = 1 - is_pole_edge(iedge);
+
+                const idx_t ip1 = edge2node(iedge, 0);
+                const idx_t ip2 = edge2node(iedge, 1);
+
+                double cosy1, cosy2;
+                if (metric_approach_ == 0) {
+                    cosy1 = cos_lat_[ip1] * pbc;
+                    cosy2 = cos_lat_[ip2] * pbc;
+                }
+                else {
+                    const double y1 = lonlat_deg(ip1, LAT) * deg2rad;
+                    const double y2 = lonlat_deg(ip2, LAT) * deg2rad;
+                    cosy1 = cosy2 = std::cos(0.5 * (y1 + y2)) * pbc;
+                }
 
-        atlas_omp_for(idx_t jnode = 0; jnode < nnodes; ++jnode) {
-            for (idx_t jlev = 0; jlev < nlev; ++jlev) {
-                div(jnode, jlev) = 0.;
-            }
-            for (idx_t jedge = 0; jedge < node2edge.cols(jnode); ++jedge) {
-                idx_t iedge = node2edge(jnode, jedge);
-                if (iedge < nedges) {
-                    double add = node2edge_sign(jnode, jedge);
-                    for (idx_t jlev = 0; jlev < nlev; ++jlev) {
-                        div(jnode, jlev) += add * (avgS(iedge, jlev, LONdLON) + avgS(iedge, jlev, LATdLAT));
-                    }
+                const double add  = node2edge_sign(jnode, jedge);
+                const double S[2] = {dual_normals(iedge, LON) * deg2rad, dual_normals(iedge, LAT) * deg2rad};
+                for (idx_t jlev = 0; jlev < nlev; ++jlev) {
+                    const double u1 = vector(ip1, jlev, LON);
+                    const double u2 = vector(ip2, jlev, LON);
+                    const double v1 = vector(ip1, jlev, LAT) * cosy1;
+                    const double v2 = vector(ip2, jlev, LAT) * cosy2;
+                    div(jnode, jlev) += add * ((u1 + u2) * 0.5 * S[LON] + (v1 + v2) * 0.5 * S[LAT]);
                 }
             }
-            const double y = lonlat_deg(jnode, LAT) * deg2rad;
-            double metric  = 1. / (dual_volumes(jnode) * scale * std::cos(y));
-            for (idx_t jlev = 0; jlev < nlev; ++jlev) {
-                div(jnode, jlev) *= metric;
-            }
+        }
+        const double metric = 1. / (dual_volumes_[jnode] * cos_lat_[jnode]);
+        for (idx_t jlev = 0; jlev < nlev; ++jlev) {
+            div(jnode, jlev) *= metric;
         }
     }
 }
 
-void Nabla::curl(const Field& vector_field, Field& curl_field) const {
-    const double radius  = fvm_->radius();
+template <typename Value, typename Result>
+void Nabla::curl_of_vector(const Field& vector_field, Field& curl_field) const {
     const double deg2rad = M_PI / 180.;
 
     const mesh::Edges& edges = fvm_->mesh().edges();
@@ -388,12 +372,8 @@ void Nabla::curl(const Field& vector_field, Field& curl_field) const {
     const idx_t nnodes = fvm_->node_columns().nb_nodes();
     const idx_t nedges = fvm_->edge_columns().nb_edges();
 
-    const auto vector =
-        vector_field.levels()
-            ? array::make_view<double, 3>(vector_field).slice(Range::all(), Range::all(), Range::all())
-            : array::make_view<double, 2>(vector_field).slice(Range::all(), Range::dummy(), Range::all());
-    auto curl = curl_field.levels() ? array::make_view<double, 2>(curl_field).slice(Range::all(), Range::all())
-                                    : array::make_view<double, 1>(curl_field).slice(Range::all(), Range::dummy());
+    const auto vector = make_vector_view<Value>(vector_field);
+    auto curl         = make_scalar_view<Result>(curl_field);
 
     const idx_t nlev = vector.shape(1);
     if (curl.shape(1) != nlev) {
@@ -401,88 +381,63 @@ void Nabla::curl(const Field& vector_field, Field& curl_field) const {
     }
 
     const auto lonlat_deg     = array::make_view<double, 2>(nodes.lonlat());
-    const auto dual_volumes   = array::make_view<double, 1>(nodes.field("dual_volumes"));
     const auto dual_normals   = array::make_view<double, 2>(edges.field("dual_normals"));
     const auto node2edge_sign = array::make_view<double, 2>(nodes.field("node2edge_sign"));
     const auto edge_flags     = array::make_view<int, 1>(edges.flags());
     auto is_pole_edge         = [&](idx_t e) { return Topology::check(edge_flags(e), Topology::POLE); };
 
-
     const mesh::Connectivity& node2edge           = nodes.edge_connectivity();
     const mesh::MultiBlockConnectivity& edge2node = edges.node_connectivity();
 
-    array::ArrayT<double> avgS_arr(nedges, nlev, 2ul);
-    array::ArrayView<double, 3> avgS = array::make_view<double, 3>(avgS_arr);
-
-    const double scale = deg2rad * deg2rad * radius;
-
-    enum
-    {
-        LONdLAT = 0,
-        LATdLON = 1
-    };
-
-
-    atlas_omp_parallel {
-        atlas_omp_for(idx_t jedge = 0; jedge < nedges; ++jedge) {
-            idx_t ip1 = edge2node(jedge, 0);
-            idx_t ip2 = edge2node(jedge, 1);
-            double y1 = lonlat_deg(ip1, LAT) * deg2rad;
-            double y2 = lonlat_deg(ip2, LAT) * deg2rad;
-
-            double pbc = 1 - is_pole_edge(jedge);
-            double cosy1;
-            double cosy2;
-            if (metric_approach_ == 0) {
-                cosy1 = std::cos(y1) * pbc;
-                cosy2 = std::cos(y2) * pbc;
-            }
-            else {
-                cosy1 = cosy2 = std::cos(0.5 * (y1 + y2)) * pbc;
-            }
-
-            double S[2] = {dual_normals(jedge, LON) * deg2rad, dual_normals(jedge, LAT) * deg2rad};
-            double avg[2];
-
-            for (idx_t jlev = 0; jlev < nlev; ++jlev) {
-                double u1 = vector(ip1, jlev, LON) * cosy1;
-                double u2 = vector(ip2, jlev, LON) * cosy2;
-                double v1 = vector(ip1, jlev, LAT);
-                double v2 = vector(ip2, jlev, LAT);
-
-                avg[LON] = (u1 + u2) * 0.5;
-                avg[LAT] = (v1 + v2) * 0.5;
-
-                avgS(jedge, jlev, LONdLAT) = avg[LON] * S[LAT];
-                avgS(jedge, jlev, LATdLON) = avg[LAT] * S[LON];
-            }
+    atlas_omp_parallel_for(idx_t jnode = 0; jnode < nnodes; ++jnode) {
+        for (idx_t jlev = 0; jlev < nlev; ++jlev) {
+            curl(jnode, jlev) = 0.;
         }
+        for (idx_t jedge = 0; jedge < node2edge.cols(jnode); ++jedge) {
+            const idx_t iedge = node2edge(jnode, jedge);
+            if (iedge < nedges) {
+                const double pbc = 1 - is_pole_edge(iedge);
+
+                const idx_t ip1 = edge2node(iedge, 0);
+                const idx_t ip2 = edge2node(iedge, 1);
+
+                double cosy1, cosy2;
+                if (metric_approach_ == 0) {
+                    cosy1 = cos_lat_[ip1] * pbc;
+                    cosy2 = cos_lat_[ip2] * pbc;
+                }
+                else {
+                    const double y1 = lonlat_deg(ip1, LAT) * deg2rad;
+                    const double y2 = lonlat_deg(ip2, LAT) * deg2rad;
+                    cosy1 = cosy2 = std::cos(0.5 * (y1 + y2)) * pbc;
+                }
 
-        atlas_omp_for(idx_t jnode = 0; jnode < nnodes; ++jnode) {
-            for (idx_t jlev = 0; jlev < nlev; ++jlev) {
-                curl(jnode, jlev) = 0.;
-            }
-            for (idx_t jedge = 0; jedge < node2edge.cols(jnode); ++jedge) {
-                idx_t iedge = node2edge(jnode, jedge);
-                if (iedge < nedges) {
-                    double add = node2edge_sign(jnode, jedge);
-                    for (idx_t jlev = 0; jlev < nlev; ++jlev) {
-                        curl(jnode, jlev) += add * (avgS(iedge, jlev, LATdLON) - avgS(iedge, jlev, LONdLAT));
-                    }
+                const double add  = node2edge_sign(jnode, jedge);
+                const double S[2] = {dual_normals(iedge, LON) * deg2rad, dual_normals(iedge, LAT) * deg2rad};
+                for (idx_t jlev = 0; jlev < nlev; ++jlev) {
+                    const double u1 = vector(ip1, jlev, LON) * cosy1;
+                    const double u2 = vector(ip2, jlev, LON) * cosy2;
+                    const double v1 = vector(ip1, jlev, LAT);
+                    const double v2 = vector(ip2, jlev, LAT);
+                    curl(jnode, jlev) += add * ((v1 + v2) * 0.5 * S[LON] - (u1 + u2) * 0.5 * S[LAT]);
                 }
             }
-            double y      = lonlat_deg(jnode, LAT) * deg2rad;
-            double metric = 1. / (dual_volumes(jnode) * scale * std::cos(y));
-            for (idx_t jlev = 0; jlev < nlev; ++jlev) {
-                curl(jnode, jlev) *= metric;
-            }
+        }
+        const double metric = 1. / (dual_volumes_[jnode] * cos_lat_[jnode]);
+        for (idx_t jlev = 0; jlev < nlev; ++jlev) {
+            curl(jnode, jlev) *= metric;
         }
     }
 }
 
 void Nabla::laplacian(const Field& scalar, Field& lapl) const {
-    Field grad(fvm_->node_columns().createField<double>(option::name("grad") | option::levels(scalar.levels()) |
-                                                        option::variables(2)));
+    // The gradient is kept in a workspace of the type of the result, reallocated only when levels or type change
+    std::lock_guard<std::mutex> lock(laplacian_mutex_);
+    Field& grad = laplacian_workspace_;
+    if (not grad || grad.levels() != scalar.levels() || grad.datatype() != lapl.datatype()) {
+        grad = fvm_->node_columns().createField(option::name("grad") | option::levels(scalar.levels()) |
+                                                option::variables(2) | option::datatype(lapl.datatype()));
+    }
     gradient(scalar, grad);
     if (fvm_->node_columns().halo().size() < 2) {
         fvm_->node_columns().haloExchange(grad);
@@ -10,8 +10,10 @@
 
 #pragma once
 
+#include <mutex>
 #include <vector>
 
+#include "atlas/field/Field.h"
 #include "atlas/library/config.h"
 #include "atlas/numerics/Nabla.h"
 
@@ -23,15 +25,16 @@ class Method;
 }  // namespace numerics
 }  // namespace atlas
 
-namespace atlas {
-class Field;
-}
-
 namespace atlas {
 namespace numerics {
 namespace fvm {
 
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
+/// Edge-based finite volume operators on the nodes of a mesh with a median dual.
+///
+/// Fields may be of type double or float, and input and output fields may differ in type. Edge contributions are
+/// accumulated directly into the nodes, so that no temporary edge arrays are allocated. The gradient needed by the
+/// laplacian is kept in a workspace field that is reused between calls.
 class Nabla : public atlas::numerics::NablaImpl {
 public:
     Nabla(const atlas::numerics::Method&, const eckit::Parametrisation&);
@@ -47,13 +50,23 @@ public:
 private:
     void setup();
 
+    template <typename Value, typename Result>
     void gradient_of_scalar(const Field& scalar, Field& grad) const;
+    template <typename Value, typename Result>
     void gradient_of_vector(const Field& vector, Field& grad) const;
+    template <typename Value, typename Result>
+    void divergence_of_vector(const Field& vector, Field& div) const;
+    template <typename Value, typename Result>
+    void curl_of_vector(const Field& vector, Field& curl) const;
 
 private:
     fvm::Method const* fvm_;
-    std::vector<idx_t> pole_edges_;
+    std::vector<double> cos_lat_;       // cos(lat) of nodes
+    std::vector<double> dual_volumes_;  // dual volumes of nodes, in radians^2 times radius
     int metric_approach_{0};
+
+    mutable Field laplacian_workspace_;
+    mutable std::mutex laplacian_mutex_;
 };
 #endif
 // ------------------------------------------------------------------
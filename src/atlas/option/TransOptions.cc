@@ -35,6 +35,18 @@ flt::flt(bool flt) {
     set("flt", flt);
 }
 
+flt_threshold::flt_threshold(double threshold) {
+    set("flt_threshold", threshold);
+}
+
+auxiliary_grid::auxiliary_grid(bool auxiliary_grid) {
+    set("auxiliary_grid", auxiliary_grid);
+}
+
+auxiliary_grid_tolerance::auxiliary_grid_tolerance(double tolerance) {
+    set("auxiliary_grid_tolerance", tolerance);
+}
+
 fft::fft(FFT fft) {
     static const std::map<FFT, std::string> FFT_to_string = {
         {FFT::OFF, "OFF"}, {FFT::FFT992, "FFT992"}, {FFT::FFTW, "FFTW"}};
@@ -60,6 +60,27 @@ public:
 
 // ----------------------------------------------------------------------------
 
+class flt_threshold : public util::Config {
+public:
+    flt_threshold(double);
+};
+
+// ----------------------------------------------------------------------------
+
+class auxiliary_grid : public util::Config {
+public:
+    auxiliary_grid(bool);
+};
+
+// ----------------------------------------------------------------------------
+
+class auxiliary_grid_tolerance : public util::Config {
+public:
+    auxiliary_grid_tolerance(double);
+};
+
+// ----------------------------------------------------------------------------
+
 class fft : public util::Config {
 public:
     fft(FFT);
@@ -0,0 +1,26 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#include "atlas/output/VTU.h"
+#include "atlas/output/detail/VTUImpl.h"
+
+namespace atlas {
+namespace output {
+
+//----------------------------------------------------------------------------------------------------------------------
+
+VTU::VTU(const Output& output): Output(output) {}
+
+VTU::VTU(const eckit::PathName& p): Output(new detail::VTUImpl(p)) {}
+
+VTU::VTU(const eckit::PathName& p, const eckit::Parametrisation& c): Output(new detail::VTUImpl(p, c)) {}
+
+}  // namespace output
+}  // namespace atlas
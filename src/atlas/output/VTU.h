@@ -0,0 +1,61 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#pragma once
+
+#include "atlas/output/Output.h"
+#include "atlas/util/Config.h"
+
+namespace eckit {
+class Parametrisation;
+class PathName;
+}  // namespace eckit
+
+namespace atlas {
+namespace output {
+
+// -----------------------------------------------------------------------------
+
+/// @brief Output of a Mesh and its NodeColumns / CellColumns fields in VTK XML format
+///
+/// Every MPI task writes its own part of the mesh, including halo, to an UnstructuredGrid
+/// file (.vtu) with all data stored as raw binary in an appended block. With more than one
+/// MPI task, a parallel index file (.pvtu) is written as well, which references all parts.
+/// No data is gathered; field values are streamed directly from memory.
+///
+/// Ghost nodes and halo cells are flagged with the VTK array "vtkGhostType" so that readers
+/// such as ParaView hide the duplicates. Multi-level fields are written as a single array
+/// with one component per level (and variable).
+///
+/// The file is (re)written on every call to write. Fields written for the same mesh
+/// accumulate, so that
+/// @code{.cpp}
+///     output::VTU vtu("out.vtu");
+///     vtu.write(mesh);
+///     vtu.write(field1);
+///     vtu.write(field2);
+/// @endcode
+/// results in one file containing the mesh with both fields.
+///
+/// Configuration options:
+///  - coordinates [string] : "xy" (default), "lonlat" or "xyz"
+///  - ghost [bool]         : write ghost nodes and halo cells without flagging them (default false)
+class VTU : public Output {
+public:
+    VTU(const Output& output);
+
+    VTU(const eckit::PathName&);
+    VTU(const eckit::PathName&, const eckit::Parametrisation&);
+};
+
+// -----------------------------------------------------------------------------
+
+}  // namespace output
+}  // namespace atlas
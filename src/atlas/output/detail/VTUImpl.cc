@@ -0,0 +1,505 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "eckit/filesystem/PathName.h"
+
+#include "atlas/array/ArrayView.h"
+#include "atlas/array/MakeView.h"
+#include "atlas/field/Field.h"
+#include "atlas/field/FieldSet.h"
+#include "atlas/functionspace/CellColumns.h"
+#include "atlas/functionspace/FunctionSpace.h"
+#include "atlas/functionspace/NodeColumns.h"
+#include "atlas/mesh/HybridElements.h"
+#include "atlas/mesh/Mesh.h"
+#include "atlas/mesh/Nodes.h"
+#include "atlas/mesh/actions/BuildXYZField.h"
+#include "atlas/output/detail/VTUImpl.h"
+#include "atlas/parallel/mpi/mpi.h"
+#include "atlas/runtime/Exception.h"
+#include "atlas/runtime/Log.h"
+#include "atlas/runtime/Trace.h"
+
+namespace atlas {
+namespace output {
+namespace detail {
+
+// -----------------------------------------------------------------------------
+
+void VTUImpl::defaults() {
+    config_.ghost       = false;
+    config_.file        = "output.vtu";
+    config_.coordinates = "xy";
+}
+
+// -----------------------------------------------------------------------------
+
+namespace /*anonymous*/ {
+
+// -----------------------------------------------------------------------------
+
+void merge(VTUImpl::Configuration& present, const eckit::Parametrisation& update) {
+    update.get("ghost", present.ghost);
+    update.get("file", present.file);
+    update.get("coordinates", present.coordinates);
+}
+
+// -----------------------------------------------------------------------------
+
+bool little_endian() {
+    const std::uint16_t one = 1;
+    return *reinterpret_cast<const std::uint8_t*>(&one) == 1;
+}
+
+std::string vtk_type(const array::DataType& datatype) {
+    switch (datatype.kind()) {
+        case array::DataType::KIND_REAL64:
+            return "Float64";
+        case array::DataType::KIND_REAL32:
+            return "Float32";
+        case array::DataType::KIND_INT64:
+            return "Int64";
+        case array::DataType::KIND_INT32:
+            return "Int32";
+        case array::DataType::KIND_UINT64:
+            return "UInt64";
+        case array::DataType::KIND_BYTE:
+            return "UInt8";
+        default:
+            ATLAS_NOTIMPLEMENTED;
+    }
+}
+
+template <typename T>
+std::string vtk_type() {
+    return vtk_type(array::DataType::create<T>());
+}
+
+template <>
+std::string vtk_type<std::uint8_t>() {
+    return "UInt8";
+}
+
+// Cells of atlas meshes are 2D elements, so the number of nodes identifies the VTK cell type
+std::uint8_t vtk_cell_type(idx_t nb_nodes) {
+    switch (nb_nodes) {
+        case 1:
+            return 1;  // VTK_VERTEX
+        case 2:
+            return 3;  // VTK_LINE
+        case 3:
+            return 5;  // VTK_TRIANGLE
+        case 4:
+            return 9;  // VTK_QUAD
+        default:
+            return 7;  // VTK_POLYGON
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+/// A DataArray stored in the appended data section
+struct DataBlock {
+    std::string section;
+    std::string name;
+    std::string type;
+    idx_t components;
+    std::uint64_t bytes;
+    std::function<void(std::ostream&)> write;
+};
+
+template <typename T>
+DataBlock make_block(const std::string& section, const std::string& name, idx_t components,
+                     const std::vector<T>& values) {
+    DataBlock block;
+    block.section    = section;
+    block.name       = name;
+    block.type       = vtk_type<T>();
+    block.components = components;
+    block.bytes      = values.size() * sizeof(T);
+    const T* data    = values.data();
+    block.write      = [data, bytes = block.bytes](std::ostream& out) {
+        out.write(reinterpret_cast<const char*>(data), static_cast<std::streamsize>(bytes));
+    };
+    return block;
+}
+
+/// Write array values in row-major order, directly from memory when the array is contiguous
+void write_array(std::ostream& out, const array::Array& array) {
+    const char* data     = static_cast<const char*>(array.storage());
+    const size_t element = array.datatype().size();
+    if (array.contiguous()) {
+        out.write(data, static_cast<std::streamsize>(array.size() * element));
+        return;
+    }
+
+    // Strided array (e.g. padded or sliced): copy in chunks of whole rows
+    const idx_t rank    = array.rank();
+    const auto& shape   = array.shape();
+    const auto& strides = array.strides();
+    idx_t row_size      = 1;
+    for (idx_t r = 1; r < rank; ++r) {
+        row_size *= shape[r];
+    }
+    constexpr size_t chunk = 1 << 20;
+    std::vector<char> buffer;
+    buffer.reserve(chunk + row_size * element);
+    for (idx_t i = 0; i < shape[0]; ++i) {
+        for (idx_t j = 0; j < row_size; ++j) {
+            size_t offset = size_t(i) * strides[0];
+            idx_t rem     = j;
+            for (idx_t r = rank - 1; r >= 1; --r) {
+                offset += size_t(rem % shape[r]) * strides[r];
+                rem /= shape[r];
+            }
+            buffer.insert(buffer.end(), data + offset * element, data + (offset + 1) * element);
+        }
+        if (buffer.size() >= chunk) {
+            out.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+            buffer.clear();
+        }
+    }
+    out.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+}
+
+DataBlock make_block(const std::string& section, const Field& field, idx_t size) {
+    if (field.shape(0) != size) {
+        std::stringstream msg;
+        msg << "Field \"" << field.name() << "\" has " << field.shape(0) << " entries in first dimension, expected "
+            << size;
+        throw_Exception(msg.str(), Here());
+    }
+    DataBlock block;
+    block.section    = section;
+    block.name       = field.name();
+    block.type       = vtk_type(field.datatype());
+    block.components = size ? static_cast<idx_t>(field.size() / size) : 1;
+    block.bytes      = field.size() * field.datatype().size();
+    const array::Array* array = &field.array();
+    block.write               = [array](std::ostream& out) { write_array(out, *array); };
+    return block;
+}
+
+// -----------------------------------------------------------------------------
+
+void write_attributes(std::ostream& out, const DataBlock& block) {
+    out << "type=\"" << block.type << "\"";
+    if (not block.name.empty()) {
+        out << " Name=\"" << block.name << "\"";
+    }
+    out << " NumberOfComponents=\"" << block.components << "\"";
+}
+
+std::string file_stem(const std::string& file) {
+    for (std::string ext : {".pvtu", ".vtu"}) {
+        if (file.size() > ext.size() && file.compare(file.size() - ext.size(), ext.size(), ext) == 0) {
+            return file.substr(0, file.size() - ext.size());
+        }
+    }
+    return file;
+}
+
+std::string piece_path(const std::string& stem, int part) {
+    if (mpi::size() == 1) {
+        return stem + ".vtu";
+    }
+    return stem + "_p" + std::to_string(part) + ".vtu";
+}
+
+void write_pvtu(const std::string& stem, const std::vector<DataBlock>& blocks, bool ghost_level) {
+    eckit::PathName path(stem + ".pvtu");
+    std::ofstream out(path.localPath());
+    if (!out.is_open()) {
+        throw_CantOpenFile(path.asString());
+    }
+    out << "<?xml version=\"1.0\"?>\n"
+        << "<VTKFile type=\"PUnstructuredGrid\" version=\"1.0\" byte_order=\""
+        << (little_endian() ? "LittleEndian" : "BigEndian") << "\" header_type=\"UInt64\">\n"
+        << "  <PUnstructuredGrid GhostLevel=\"" << ghost_level << "\">\n";
+    for (std::string section : {"PointData", "CellData", "Points"}) {
+        out << "    <P" << section << ">\n";
+        for (const auto& block : blocks) {
+            if (block.section == section) {
+                out << "      <PDataArray ";
+                write_attributes(out, block);
+                out << "/>\n";
+            }
+        }
+        out << "    </P" << section << ">\n";
+    }
+    for (int part = 0; part < mpi::size(); ++part) {
+        out << "    <Piece Source=\"" << eckit::PathName(piece_path(stem, part)).baseName() << "\"/>\n";
+    }
+    out << "  </PUnstructuredGrid>\n"
+        << "</VTKFile>\n";
+}
+
+// -----------------------------------------------------------------------------
+
+}  // anonymous namespace
+
+// -----------------------------------------------------------------------------
+
+VTUImpl::VTUImpl(std::ostream&) {
+    defaults();
+    ATLAS_NOTIMPLEMENTED;
+}
+
+// -----------------------------------------------------------------------------
+
+VTUImpl::VTUImpl(std::ostream&, const eckit::Parametrisation& config) {
+    defaults();
+    merge(config_, config);
+    ATLAS_NOTIMPLEMENTED;
+}
+
+// -----------------------------------------------------------------------------
+
+VTUImpl::VTUImpl(const eckit::PathName& file) {
+    defaults();
+    config_.file = file.asString();
+}
+
+// -----------------------------------------------------------------------------
+
+VTUImpl::VTUImpl(const eckit::PathName& file, const eckit::Parametrisation& config) {
+    defaults();
+    merge(config_, config);
+    config_.file = file.asString();
+}
+
+// -----------------------------------------------------------------------------
+
+VTUImpl::~VTUImpl() = default;
+
+// -----------------------------------------------------------------------------
+
+void VTUImpl::add(const Field& field, const FunctionSpace& functionspace) const {
+    Mesh mesh;
+    std::vector<Field>* fields;
+    if (functionspace.type() == functionspace::NodeColumns::type()) {
+        mesh   = functionspace::NodeColumns(functionspace).mesh();
+        fields = &point_fields_;
+    }
+    else if (functionspace.type() == functionspace::CellColumns::type()) {
+        mesh   = functionspace::CellColumns(functionspace).mesh();
+        fields = &cell_fields_;
+    }
+    else {
+        throw_Exception("VTU output only supports fields on NodeColumns or CellColumns, not " + functionspace.type(),
+                        Here());
+    }
+    if (mesh.get() != mesh_.get()) {
+        mesh_ = mesh;
+        point_fields_.clear();
+        cell_fields_.clear();
+    }
+    for (auto& f : *fields) {
+        if (f.name() == field.name()) {
+            f = field;
+            return;
+        }
+    }
+    fields->emplace_back(field);
+}
+
+// -----------------------------------------------------------------------------
+
+void VTUImpl::write(const Configuration& c) const {
+    ATLAS_TRACE("VTU::write");
+    ATLAS_ASSERT(mesh_);
+
+    const mesh::Nodes& nodes          = mesh_.nodes();
+    const mesh::HybridElements& cells = mesh_.cells();
+    const idx_t nb_nodes              = nodes.size();
+    const idx_t nb_cells              = cells.size();
+
+    std::vector<DataBlock> blocks;
+
+    // PointData and CellData
+    for (const auto& field : point_fields_) {
+        blocks.emplace_back(make_block("PointData", field, nb_nodes));
+    }
+    for (const auto& field : cell_fields_) {
+        blocks.emplace_back(make_block("CellData", field, nb_cells));
+    }
+
+    std::vector<std::uint8_t> ghost_nodes;
+    std::vector<std::uint8_t> ghost_cells;
+    if (not c.ghost) {
+        // vtkGhostType: 1 = DUPLICATEPOINT / DUPLICATECELL
+        auto ghost = array::make_view<int, 1>(nodes.ghost());
+        ghost_nodes.resize(nb_nodes);
+        for (idx_t n = 0; n < nb_nodes; ++n) {
+            ghost_nodes[n] = ghost(n) ? 1 : 0;
+        }
+        auto halo = array::make_view<int, 1>(cells.halo());
+        ghost_cells.resize(nb_cells);
+        for (idx_t e = 0; e < nb_cells; ++e) {
+            ghost_cells[e] = halo(e) ? 1 : 0;
+        }
+        blocks.emplace_back(make_block("PointData", "vtkGhostType", 1, ghost_nodes));
+        blocks.emplace_back(make_block("CellData", "vtkGhostType", 1, ghost_cells));
+    }
+
+    // Points
+    std::vector<double> points;
+    if (c.coordinates == "xyz") {
+        if (not nodes.has_field("xyz")) {
+            Log::debug() << "Building xyz representation for nodes" << std::endl;
+            mesh::actions::BuildXYZField("xyz")(const_cast<Mesh&>(mesh_));
+        }
+        blocks.emplace_back(make_block("Points", nodes.field("xyz"), nb_nodes));
+        blocks.back().name.clear();
+    }
+    else {
+        const Field& coordinates = (c.coordinates == "lonlat") ? nodes.lonlat() : nodes.xy();
+        auto xy                  = array::make_view<double, 2>(coordinates);
+        points.resize(3 * nb_nodes);
+        for (idx_t n = 0; n < nb_nodes; ++n) {
+            points[3 * n + 0] = xy(n, 0);
+            points[3 * n + 1] = xy(n, 1);
+            points[3 * n + 2] = 0.;
+        }
+        blocks.emplace_back(make_block("Points", "", 3, points));
+    }
+
+    // Cells
+    const auto& node_connectivity = cells.node_connectivity();
+    std::vector<idx_t> connectivity;
+    std::vector<idx_t> offsets(nb_cells);
+    std::vector<std::uint8_t> types(nb_cells);
+    connectivity.reserve(node_connectivity.size());
+    for (idx_t e = 0; e < nb_cells; ++e) {
+        const idx_t cols = node_connectivity.cols(e);
+        for (idx_t j = 0; j < cols; ++j) {
+            connectivity.emplace_back(node_connectivity(e, j));
+        }
+        offsets[e] = static_cast<idx_t>(connectivity.size());
+        types[e]   = vtk_cell_type(cols);
+    }
+    blocks.emplace_back(make_block("Cells", "connectivity", 1, connectivity));
+    blocks.emplace_back(make_block("Cells", "offsets", 1, offsets));
+    blocks.emplace_back(make_block("Cells", "types", 1, types));
+
+    const std::string stem = file_stem(c.file);
+    const int part         = mpi::rank();
+
+    eckit::PathName path(piece_path(stem, part));
+    std::ofstream out(path.localPath(), std::ios_base::out | std::ios_base::binary);
+    if (!out.is_open()) {
+        throw_CantOpenFile(path.asString());
+    }
+
+    out << "<?xml version=\"1.0\"?>\n"
+        << "<VTKFile type=\"UnstructuredGrid\" version=\"1.0\" byte_order=\""
+        << (little_endian() ? "LittleEndian" : "BigEndian") << "\" header_type=\"UInt64\">\n"
+        << "  <UnstructuredGrid>\n"
+        << "    <Piece NumberOfPoints=\"" << nb_nodes << "\" NumberOfCells=\"" << nb_cells << "\">\n";
+    std::uint64_t offset = 0;
+    for (std::string section : {"PointData", "CellData", "Points", "Cells"}) {
+        out << "      <" << section << ">\n";
+        for (const auto& block : blocks) {
+            if (block.section == section) {
+                out << "        <DataArray ";
+                write_attributes(out, block);
+                out << " format=\"appended\" offset=\"" << offset << "\"/>\n";
+                offset += sizeof(std::uint64_t) + block.bytes;
+            }
+        }
+        out << "      </" << section << ">\n";
+    }
+    out << "    </Piece>\n"
+        << "  </UnstructuredGrid>\n"
+        << "  <AppendedData encoding=\"raw\">\n"
+        << "_";
+    for (std::string section : {"PointData", "CellData", "Points", "Cells"}) {
+        for (const auto& block : blocks) {
+            if (block.section == section) {
+                out.write(reinterpret_cast<const char*>(&block.bytes), sizeof(std::uint64_t));
+                block.write(out);
+            }
+        }
+    }
+    out << "\n  </AppendedData>\n"
+        << "</VTKFile>\n";
+    out.close();
+
+    if (mpi::size() > 1 && part == 0) {
+        write_pvtu(stem, blocks, not c.ghost);
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+void VTUImpl::write(const Mesh& mesh, const eckit::Parametrisation& config) const {
+    VTUImpl::Configuration c = config_;
+    merge(c, config);
+    mesh_ = mesh;
+    point_fields_.clear();
+    cell_fields_.clear();
+    write(c);
+}
+
+// -----------------------------------------------------------------------------
+
+void VTUImpl::write(const Field& field, const eckit::Parametrisation& config) const {
+    write(field, field.functionspace(), config);
+}
+
+// -----------------------------------------------------------------------------
+
+void VTUImpl::write(const FieldSet& fields, const eckit::Parametrisation& config) const {
+    VTUImpl::Configuration c = config_;
+    merge(c, config);
+    for (const Field& field : fields) {
+        add(field, field.functionspace());
+    }
+    write(c);
+}
+
+// -----------------------------------------------------------------------------
+
+void VTUImpl::write(const Field& field, const FunctionSpace& functionspace,
+                    const eckit::Parametrisation& config) const {
+    VTUImpl::Configuration c = config_;
+    merge(c, config);
+    add(field, functionspace);
+    write(c);
+}
+
+// -----------------------------------------------------------------------------
+
+void VTUImpl::write(const FieldSet& fields, const FunctionSpace& functionspace,
+                    const eckit::Parametrisation& config) const {
+    VTUImpl::Configuration c = config_;
+    merge(c, config);
+    for (const Field& field : fields) {
+        add(field, functionspace);
+    }
+    write(c);
+}
+
+// -----------------------------------------------------------------------------
+
+static OutputBuilder<detail::VTUImpl> __vtu("vtu");
+
+// -----------------------------------------------------------------------------
+
+}  // namespace detail
+}  // namespace output
+}  // namespace atlas
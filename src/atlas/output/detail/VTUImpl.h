@@ -0,0 +1,77 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "atlas/field/Field.h"
+#include "atlas/mesh/Mesh.h"
+#include "atlas/output/Output.h"
+#include "atlas/util/Config.h"
+
+namespace atlas {
+namespace output {
+namespace detail {
+
+// -----------------------------------------------------------------------------
+
+class VTUImpl : public OutputImpl {
+public:
+    VTUImpl(std::ostream&);
+    VTUImpl(std::ostream&, const eckit::Parametrisation&);
+
+    VTUImpl(const eckit::PathName&);
+    VTUImpl(const eckit::PathName&, const eckit::Parametrisation&);
+
+    virtual ~VTUImpl();
+
+    /// Write mesh file
+    virtual void write(const Mesh&, const eckit::Parametrisation& = util::NoConfig()) const;
+
+    /// Write field to file
+    virtual void write(const Field&, const eckit::Parametrisation& = util::NoConfig()) const;
+
+    /// Write fieldset to file using FunctionSpace
+    virtual void write(const FieldSet&, const eckit::Parametrisation& = util::NoConfig()) const;
+
+    /// Write field to file using Functionspace
+    virtual void write(const Field&, const FunctionSpace&, const eckit::Parametrisation& = util::NoConfig()) const;
+
+    /// Write fieldset to file using FunctionSpace
+    virtual void write(const FieldSet&, const FunctionSpace&, const eckit::Parametrisation& = util::NoConfig()) const;
+
+public:
+    struct Configuration {
+        bool ghost;
+        std::string file;
+        std::string coordinates;
+    };
+
+private:
+    void defaults();
+    void add(const Field&, const FunctionSpace&) const;
+    void write(const Configuration&) const;
+
+private:
+    Configuration config_;
+
+    // State accumulated over successive calls to write()
+    mutable Mesh mesh_;
+    mutable std::vector<Field> point_fields_;
+    mutable std::vector<Field> cell_fields_;
+};
+
+// -----------------------------------------------------------------------------
+
+}  // namespace detail
+}  // namespace output
+}  // namespace atlas
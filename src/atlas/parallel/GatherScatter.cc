@@ -193,8 +193,7 @@ void GatherScatter::setup(const int part[], const idx_t remote_idx[], const int
 
     // Sort on "g" member, and remove duplicates
     ATLAS_TRACE_SCOPE("sorting") {
-        //        omp::sort(node_sort.begin(), node_sort.end());
-        std::sort(node_sort.begin(), node_sort.end());
+        omp::radix_sort(node_sort.begin(), node_sort.end(), [](const Node& n) { return n.g; });
         node_sort.erase(std::unique(node_sort.begin(), node_sort.end()), node_sort.end());
     }
 
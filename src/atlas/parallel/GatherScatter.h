@@ -10,6 +10,7 @@
 
 #pragma once
 
+#include <functional>
 #include <numeric>
 #include <stdexcept>
 #include <type_traits>
@@ -17,7 +18,9 @@
 
 #include "atlas/array/ArrayView.h"
 #include "atlas/library/config.h"
+#include "atlas/parallel/Packing.h"
 #include "atlas/parallel/mpi/mpi.h"
+#include "atlas/parallel/omp/omp.h"
 #include "atlas/runtime/Exception.h"
 #include "atlas/util/Object.h"
 
@@ -305,13 +308,19 @@ void GatherScatter::pack_send_buffer(const parallel::Field<DATA_TYPE const>& fie
                                      DATA_TYPE send_buffer[]) const {
     const idx_t sendcnt = static_cast<idx_t>(sendmap.size());
 
-    idx_t ibuf              = 0;
     const idx_t send_stride = field.var_strides[0] * field.var_shape[0];
+    const idx_t var_size    = std::accumulate(field.var_shape.data(), field.var_shape.data() + field.var_rank, idx_t{1},
+                                           std::multiplies<idx_t>());
+
+    // Each point occupies a contiguous block of var_size values in the buffer, so points are packed independently
+    ATLAS_MAYBE_UNUSED const bool threaded = packing_threaded(size_t(sendcnt) * size_t(var_size));
 
     switch (field.var_rank) {
         case 1:
+            atlas_omp_pragma(omp parallel for schedule(static) if(threaded))
             for (idx_t p = 0; p < sendcnt; ++p) {
                 const idx_t pp = send_stride * sendmap[p];
+                idx_t ibuf     = p * var_size;
                 for (idx_t i = 0; i < field.var_shape[0]; ++i) {
                     DATA_TYPE tmp       = field.data[pp + i * field.var_strides[0]];
                     send_buffer[ibuf++] = tmp;
@@ -319,8 +328,10 @@ void GatherScatter::pack_send_buffer(const parallel::Field<DATA_TYPE const>& fie
             }
             break;
         case 2:
+            atlas_omp_pragma(omp parallel for schedule(static) if(threaded))
             for (idx_t p = 0; p < sendcnt; ++p) {
                 const idx_t pp = send_stride * sendmap[p];
+                idx_t ibuf     = p * var_size;
                 for (idx_t i = 0; i < field.var_shape[0]; ++i) {
                     const idx_t ii = pp + i * field.var_strides[0];
                     for (idx_t j = 0; j < field.var_shape[1]; ++j) {
@@ -330,8 +341,10 @@ void GatherScatter::pack_send_buffer(const parallel::Field<DATA_TYPE const>& fie
             }
             break;
         case 3:
+            atlas_omp_pragma(omp parallel for schedule(static) if(threaded))
             for (idx_t p = 0; p < sendcnt; ++p) {
                 const idx_t pp = send_stride * sendmap[p];
+                idx_t ibuf     = p * var_size;
                 for (idx_t i = 0; i < field.var_shape[0]; ++i) {
                     const idx_t ii = pp + i * field.var_strides[0];
                     for (idx_t j = 0; j < field.var_shape[1]; ++j) {
@@ -353,21 +366,28 @@ void GatherScatter::unpack_recv_buffer(const std::vector<int>& recvmap, const DA
                                        const parallel::Field<DATA_TYPE>& field) const {
     const idx_t recvcnt = static_cast<idx_t>(recvmap.size());
 
-    size_t ibuf             = 0;
     const idx_t recv_stride = field.var_strides[0] * field.var_shape[0];
+    const idx_t var_size    = std::accumulate(field.var_shape.data(), field.var_shape.data() + field.var_rank, idx_t{1},
+                                           std::multiplies<idx_t>());
+
+    ATLAS_MAYBE_UNUSED const bool threaded = packing_threaded(size_t(recvcnt) * size_t(var_size));
 
     switch (field.var_rank) {
         case 1:
+            atlas_omp_pragma(omp parallel for schedule(static) if(threaded))
             for (idx_t p = 0; p < recvcnt; ++p) {
                 const idx_t pp = recv_stride * recvmap[p];
+                size_t ibuf    = size_t(p) * size_t(var_size);
                 for (idx_t i = 0; i < field.var_shape[0]; ++i) {
                     field.data[pp + i * field.var_strides[0]] = recv_buffer[ibuf++];
                 }
             }
             break;
         case 2:
+            atlas_omp_pragma(omp parallel for schedule(static) if(threaded))
             for (idx_t p = 0; p < recvcnt; ++p) {
                 const idx_t pp = recv_stride * recvmap[p];
+                size_t ibuf    = size_t(p) * size_t(var_size);
                 for (idx_t i = 0; i < field.var_shape[0]; ++i) {
                     const idx_t ii = pp + i * field.var_strides[0];
                     for (idx_t j = 0; j < field.var_shape[1]; ++j) {
@@ -377,8 +397,10 @@ void GatherScatter::unpack_recv_buffer(const std::vector<int>& recvmap, const DA
             }
             break;
         case 3:
+            atlas_omp_pragma(omp parallel for schedule(static) if(threaded))
             for (idx_t p = 0; p < recvcnt; ++p) {
                 const idx_t pp = recv_stride * recvmap[p];
+                size_t ibuf    = size_t(p) * size_t(var_size);
                 for (idx_t i = 0; i < field.var_shape[0]; ++i) {
                     const idx_t ii = pp + i * field.var_strides[0];
                     for (idx_t j = 0; j < field.var_shape[1]; ++j) {
@@ -14,12 +14,15 @@
 
 #pragma once
 
+#include <algorithm>
 #include <stdexcept>
 #include <string>
 #include <vector>
 
 #include "atlas/parallel/HaloAdjointExchangeImpl.h"
 #include "atlas/parallel/HaloExchangeImpl.h"
+#include "atlas/parallel/Packing.h"
+#include "atlas/parallel/omp/omp.h"
 #include "atlas/parallel/mpi/Statistics.h"
 #include "atlas/parallel/mpi/mpi.h"
 
@@ -319,29 +322,71 @@ void HaloExchange::isend_and_wait_for_receive(int tag, std::vector<int>& recv_co
 
 template <int ParallelDim, int RANK>
 struct halo_packer {
+    // Each node occupies a contiguous block of (buffer_size / count) values in the buffer, so that nodes
+    // can be packed independently. Threading only kicks in for large enough buffers (see packing_threaded)
     template <typename DATA_TYPE>
     static void pack(const int sendcnt, array::SVector<int> const& sendmap,
-                     const array::ArrayView<DATA_TYPE, RANK>& field, DATA_TYPE* send_buffer, int /*send_buffer_size*/) {
-        idx_t ibuf = 0;
+                     const array::ArrayView<DATA_TYPE, RANK>& field, DATA_TYPE* send_buffer, int send_buffer_size) {
+        const idx_t var_size = sendcnt ? send_buffer_size / sendcnt : 0;
+        ATLAS_MAYBE_UNUSED const bool threaded = packing_threaded(send_buffer_size);
+        if (node_block_contiguous(field, var_size)) {
+            const DATA_TYPE* data = field.data();
+            atlas_omp_pragma(omp parallel for schedule(static) if(threaded))
+            for (int node_cnt = 0; node_cnt < sendcnt; ++node_cnt) {
+                std::copy_n(data + sendmap[node_cnt] * field.stride(0), var_size, send_buffer + node_cnt * var_size);
+            }
+            return;
+        }
+        atlas_omp_pragma(omp parallel for schedule(static) if(threaded))
         for (int node_cnt = 0; node_cnt < sendcnt; ++node_cnt) {
             const idx_t node_idx = sendmap[node_cnt];
+            idx_t ibuf           = node_cnt * var_size;
             halo_packer_impl<ParallelDim, RANK, 0>::apply(ibuf, node_idx, field, send_buffer);
         }
     }
 
     template <typename DATA_TYPE>
     static void unpack(const int recvcnt, array::SVector<int> const& recvmap, const DATA_TYPE* recv_buffer,
-                       int /*recv_buffer_size*/, array::ArrayView<DATA_TYPE, RANK>& field) {
-        idx_t ibuf = 0;
+                       int recv_buffer_size, array::ArrayView<DATA_TYPE, RANK>& field) {
+        const idx_t var_size = recvcnt ? recv_buffer_size / recvcnt : 0;
+        ATLAS_MAYBE_UNUSED const bool threaded = packing_threaded(recv_buffer_size);
+        if (node_block_contiguous(field, var_size)) {
+            DATA_TYPE* data = field.data();
+            atlas_omp_pragma(omp parallel for schedule(static) if(threaded))
+            for (int node_cnt = 0; node_cnt < recvcnt; ++node_cnt) {
+                std::copy_n(recv_buffer + node_cnt * var_size, var_size, data + recvmap[node_cnt] * field.stride(0));
+            }
+            return;
+        }
+        atlas_omp_pragma(omp parallel for schedule(static) if(threaded))
         for (int node_cnt = 0; node_cnt < recvcnt; ++node_cnt) {
             const idx_t node_idx = recvmap[node_cnt];
+            idx_t ibuf           = node_cnt * var_size;
             halo_unpacker_impl<ParallelDim, RANK, 0>::apply(ibuf, node_idx, recv_buffer, field);
         }
     }
+
+    // When the parallel dimension is outermost and the remaining dimensions are packed in memory (e.g. levels
+    // with unit stride), the values of a node are one contiguous block, copied without per-value indexing
+    template <typename DATA_TYPE>
+    static bool node_block_contiguous(const array::ArrayView<DATA_TYPE, RANK>& field, idx_t var_size) {
+        if (ParallelDim != 0) {
+            return false;
+        }
+        idx_t block_size = 1;
+        for (int d = RANK - 1; d > 0; --d) {
+            if (field.stride(d) != block_size) {
+                return false;
+            }
+            block_size *= field.shape(d);
+        }
+        return block_size == var_size;
+    }
 };
 
 template <int ParallelDim, int RANK>
 struct halo_adjoint_packer {
+    // Not threaded: the same node can appear multiple times in the map, and values are accumulated
     template <typename DATA_TYPE>
     static void unpack(const int recvcnt, array::SVector<int> const& recvmap, const DATA_TYPE* recv_buffer,
                        int /*recv_buffer_size*/, array::ArrayView<DATA_TYPE, RANK>& field) {
@@ -0,0 +1,41 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#include "atlas/parallel/Packing.h"
+
+#include "eckit/config/Resource.h"
+
+#include "atlas/parallel/omp/omp.h"
+
+namespace atlas {
+namespace parallel {
+
+namespace {
+size_t& threshold() {
+    // Roughly where, for a few threads, the copy bandwidth gain outweighs the cost of spawning a parallel region
+    static size_t threshold = static_cast<size_t>(eckit::Resource<long>("$ATLAS_PACKING_OMP_THRESHOLD", 16384));
+    return threshold;
+}
+}  // namespace
+
+size_t packing_omp_threshold() {
+    return threshold();
+}
+
+void packing_omp_threshold(size_t value) {
+    threshold() = value;
+}
+
+bool packing_threaded(size_t buffer_size) {
+    return buffer_size >= packing_omp_threshold() && atlas_omp_get_max_threads() > 1 && not atlas_omp_in_parallel();
+}
+
+}  // namespace parallel
+}  // namespace atlas
@@ -0,0 +1,31 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#pragma once
+
+#include <cstddef>
+
+namespace atlas {
+namespace parallel {
+
+/// @brief Minimum number of values in a communication buffer for which packing and unpacking
+/// in HaloExchange and GatherScatter is threaded with OpenMP. Smaller buffers are packed serially,
+/// as the threading overhead would dominate.
+/// The default can be overridden with environment variable ATLAS_PACKING_OMP_THRESHOLD
+size_t packing_omp_threshold();
+
+/// @brief Override the packing threshold, e.g. to benchmark serial versus threaded packing
+void packing_omp_threshold(size_t);
+
+/// @brief Whether packing or unpacking of a buffer of given size should be threaded
+bool packing_threaded(size_t buffer_size);
+
+}  // namespace parallel
+}  // namespace atlas
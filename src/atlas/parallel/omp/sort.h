@@ -11,8 +11,12 @@
 #pragma once
 
 #include <algorithm>
+#include <array>
+#include <cstdint>
 #include <functional>
 #include <iterator>
+#include <type_traits>
+#include <vector>
 
 #include "atlas/library/config.h"
 #include "atlas/parallel/omp/omp.h"
@@ -88,6 +92,47 @@ namespace omp {
  *     Random-access iterators for bounding the sequence to be sorted
  * blocks_begin, blocks_end
  *     Random-access iterators that define offsets from paramter "first" of blocks that are already sorted
+ *
+ *
+ *
+ * radix_sort
+ * ==========
+ *
+ * 1)  template <typename RandomAccessIterator>
+ *       void radix_sort( RandomAccessIterator first, RandomAccessIterator last );
+ *
+ * 2)  template <typename RandomAccessIterator, typename Key>
+ *       void radix_sort( RandomAccessIterator first, RandomAccessIterator last, Key key );
+ *
+ * Sorts the elements in the range [first,last) into ascending order of an integral key, signed or unsigned,
+ * of at most 64 bits. The key is the element itself for the first version, and key(element) for the second.
+ *
+ * The sort is stable: equivalent elements keep their original relative order. It is a least significant digit
+ * radix sort with 8-bit digits, where every pass is distributed over the OpenMP threads. Digits that are equal for
+ * all keys are skipped, so that e.g. 64-bit global indices of a mesh require only a few passes.
+ * sort(first,last) uses radix_sort for integral elements.
+ *
+ *
+ *
+ * radix_sort_by_key
+ * =================
+ *
+ *     template <typename KeyIterator, typename ValueIterator>
+ *       void radix_sort_by_key( KeyIterator keys_first, KeyIterator keys_last, ValueIterator values_first );
+ *
+ * Stable sort of the integral keys in range [keys_first,keys_last), where the values in range
+ * [values_first, values_first + (keys_last - keys_first)) are reordered as their keys.
+ *
+ *
+ *
+ * radix_argsort
+ * =============
+ *
+ *     template <typename RandomAccessIterator, typename IndexIterator>
+ *       void radix_argsort( RandomAccessIterator first, RandomAccessIterator last, IndexIterator indices_first );
+ *
+ * Fills the range [indices_first, indices_first + (last - first)) with the permutation that stably sorts the
+ * integral keys in range [first,last), i.e. first[indices_first[i]] is ascending in i. The keys are not modified.
  */
 
 
@@ -172,6 +217,102 @@ void merge_blocks_recursive_seq(RandomAccessIterator& iterator, const Indexable&
     std::inplace_merge(begin, mid, end, compare);
 }
 
+// Order preserving map of an integral key to an unsigned integer
+template <typename T>
+typename std::make_unsigned<T>::type radix_unsigned(T key) {
+    static_assert(std::is_integral<T>::value && sizeof(T) <= 8, "radix_sort requires integral keys of at most 64 bits");
+    using U = typename std::make_unsigned<T>::type;
+    return std::is_signed<T>::value ? U(key) ^ (U(1) << (8 * sizeof(T) - 1)) : U(key);
+}
+
+// One stable pass of a least significant digit radix sort, moving the elements of [in, in+size) to [out, out+size)
+// ordered by the digit (key >> shift) & 0xff. Every thread counts, and then moves, a contiguous chunk of elements.
+template <typename InputIterator, typename OutputIterator, typename Key>
+void radix_sort_pass(InputIterator in, OutputIterator out, size_t size, const Key& key, int shift,
+                     std::vector<std::array<size_t, 256>>& offsets) {
+    atlas_omp_parallel {
+        const size_t nb_threads = atlas_omp_get_num_threads();
+        const size_t thread     = atlas_omp_get_thread_num();
+        const size_t begin      = size * thread / nb_threads;
+        const size_t end        = size * (thread + 1) / nb_threads;
+        auto& count             = offsets[thread];
+        count.fill(0);
+        for (size_t i = begin; i < end; ++i) {
+            ++count[(radix_unsigned(key(in[i])) >> shift) & 0xff];
+        }
+        atlas_omp_pragma(omp barrier)
+        atlas_omp_pragma(omp single) {
+            size_t offset = 0;
+            for (size_t digit = 0; digit < 256; ++digit) {
+                for (size_t t = 0; t < nb_threads; ++t) {
+                    size_t c          = offsets[t][digit];
+                    offsets[t][digit] = offset;
+                    offset += c;
+                }
+            }
+        }
+        for (size_t i = begin; i < end; ++i) {
+            out[count[(radix_unsigned(key(in[i])) >> shift) & 0xff]++] = std::move(in[i]);
+        }
+    }
+}
+
+template <typename RandomAccessIterator, typename Key>
+void radix_sort(RandomAccessIterator first, RandomAccessIterator last, const Key& key) {
+    using value_type = typename std::iterator_traits<RandomAccessIterator>::value_type;
+    const size_t size = std::distance(first, last);
+    if (size < 2) {
+        return;
+    }
+    if (size < 1024) {
+        std::stable_sort(first, last, [&key](const value_type& a, const value_type& b) { return key(a) < key(b); });
+        return;
+    }
+
+    // Bits in which keys differ: passes over digits without such bits would not reorder anything
+    using unsigned_key          = decltype(radix_unsigned(key(first[0])));
+    const auto first_key        = radix_unsigned(key(first[0]));
+    unsigned_key differing_bits = 0;
+    atlas_omp_pragma(omp parallel for schedule(static) reduction(| : differing_bits))
+    for (size_t i = 1; i < size; ++i) {
+        differing_bits |= radix_unsigned(key(first[i])) ^ first_key;
+    }
+
+    std::vector<value_type> buffer(size);
+    std::vector<std::array<size_t, 256>> offsets(atlas_omp_get_max_threads());
+    bool in_buffer = false;
+    for (int shift = 0; shift < int(8 * sizeof(unsigned_key)); shift += 8) {
+        if (((differing_bits >> shift) & 0xff) == 0) {
+            continue;
+        }
+        if (in_buffer) {
+            radix_sort_pass(buffer.begin(), first, size, key, shift, offsets);
+        }
+        else {
+            radix_sort_pass(first, buffer.begin(), size, key, shift, offsets);
+        }
+        in_buffer = not in_buffer;
+    }
+    if (in_buffer) {
+        std::move(buffer.begin(), buffer.end(), first);
+    }
+}
+
+template <typename Key, typename Index>
+struct RadixKeyIndex {
+    Key key;
+    Index index;
+};
+
+template <typename RandomAccessIterator>
+void sort(RandomAccessIterator first, RandomAccessIterator last, std::true_type /*integral*/) {
+    using value_type = typename std::iterator_traits<RandomAccessIterator>::value_type;
+    radix_sort(first, last, [](const value_type& v) { return v; });
+}
+
+template <typename RandomAccessIterator>
+void sort(RandomAccessIterator first, RandomAccessIterator last, std::false_type /*integral*/);
+
 }  // namespace detail
 
 template <typename RandomAccessIterator, typename Compare>
@@ -192,9 +333,63 @@ void sort(RandomAccessIterator first, RandomAccessIterator last, Compare compare
 
 template <typename RandomAccessIterator>
 void sort(RandomAccessIterator first, RandomAccessIterator last) {
+    using value_type = typename std::iterator_traits<RandomAccessIterator>::value_type;
+    detail::sort(first, last,
+                 std::integral_constant<bool, std::is_integral<value_type>::value &&
+                                                  not std::is_same<value_type, bool>::value>());
+}
+
+template <typename RandomAccessIterator, typename Key>
+void radix_sort(RandomAccessIterator first, RandomAccessIterator last, Key key) {
+    detail::radix_sort(first, last, key);
+}
+
+template <typename RandomAccessIterator>
+void radix_sort(RandomAccessIterator first, RandomAccessIterator last) {
+    using value_type = typename std::iterator_traits<RandomAccessIterator>::value_type;
+    detail::radix_sort(first, last, [](const value_type& v) { return v; });
+}
+
+template <typename RandomAccessIterator, typename IndexIterator>
+void radix_argsort(RandomAccessIterator first, RandomAccessIterator last, IndexIterator indices_first) {
+    using key_type   = typename std::iterator_traits<RandomAccessIterator>::value_type;
+    using index_type = typename std::iterator_traits<IndexIterator>::value_type;
+    using KeyIndex   = detail::RadixKeyIndex<key_type, index_type>;
+    const index_type size = std::distance(first, last);
+    std::vector<KeyIndex> key_index(size);
+    atlas_omp_parallel_for(index_type i = 0; i < size; ++i) {
+        key_index[i] = KeyIndex{first[i], i};
+    }
+    detail::radix_sort(key_index.begin(), key_index.end(), [](const KeyIndex& k) { return k.key; });
+    atlas_omp_parallel_for(index_type i = 0; i < size; ++i) {
+        indices_first[i] = key_index[i].index;
+    }
+}
+
+template <typename KeyIterator, typename ValueIterator>
+void radix_sort_by_key(KeyIterator keys_first, KeyIterator keys_last, ValueIterator values_first) {
+    using key_type   = typename std::iterator_traits<KeyIterator>::value_type;
+    using value_type = typename std::iterator_traits<ValueIterator>::value_type;
+    const size_t size = std::distance(keys_first, keys_last);
+    std::vector<size_t> indices(size);
+    radix_argsort(keys_first, keys_last, indices.begin());
+    std::vector<key_type> keys(size);
+    std::vector<value_type> values(size);
+    atlas_omp_parallel_for(size_t i = 0; i < size; ++i) {
+        keys[i]   = std::move(keys_first[indices[i]]);
+        values[i] = std::move(values_first[indices[i]]);
+    }
+    std::move(keys.begin(), keys.end(), keys_first);
+    std::move(values.begin(), values.end(), values_first);
+}
+
+namespace detail {
+template <typename RandomAccessIterator>
+void sort(RandomAccessIterator first, RandomAccessIterator last, std::false_type /*integral*/) {
     using value_type = typename std::iterator_traits<RandomAccessIterator>::value_type;
     ::atlas::omp::sort(first, last, std::less<value_type>());
 }
+}  // namespace detail
 
 template <typename RandomAccessIterator, typename RandomAccessIterator2, typename Compare>
 void merge_blocks(RandomAccessIterator first, RandomAccessIterator last, RandomAccessIterator2 blocks_size_first,
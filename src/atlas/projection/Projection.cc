@@ -49,6 +49,16 @@ void atlas::Projection::lonlat2xy(Point2& point) const {
     get()->lonlat2xy(point);
 }
 
+void atlas::Projection::xy2lonlat(idx_t n, const double x[], const double y[], double lon[], double lat[],
+                                  idx_t stride) const {
+    get()->xy2lonlat(n, x, y, lon, lat, stride);
+}
+
+void atlas::Projection::lonlat2xy(idx_t n, const double lon[], const double lat[], double x[], double y[],
+                                  idx_t stride) const {
+    get()->lonlat2xy(n, lon, lat, x, y, stride);
+}
+
 atlas::Projection::Jacobian atlas::Projection::jacobian(const PointLonLat& p) const {
     return get()->jacobian(p);
 }
@@ -65,6 +65,11 @@ public:
     void lonlat2xy(double crd[]) const;
     void lonlat2xy(Point2&) const;
 
+    /// @brief Convert n points at once, optionally strided (e.g. stride 2 for interleaved coordinates).
+    /// Input and output arrays may alias.
+    void xy2lonlat(idx_t n, const double x[], const double y[], double lon[], double lat[], idx_t stride = 1) const;
+    void lonlat2xy(idx_t n, const double lon[], const double lat[], double x[], double y[], idx_t stride = 1) const;
+
     Jacobian jacobian(const PointLonLat&) const;
 
     PointLonLat lonlat(const PointXY&) const;
@@ -333,6 +333,16 @@ void CubedSphereEquiAnglProjection::xy2lonlat(double crd[]) const {
     }
 }
 
+void CubedSphereEquiAnglProjection::xy2lonlat(idx_t n, const double x[], const double y[], double lon[], double lat[],
+                                              idx_t stride) const {
+    convert_points(n, x, y, lon, lat, stride, [this](double crd[]) { CubedSphereEquiAnglProjection::xy2lonlat(crd); });
+}
+
+void CubedSphereEquiAnglProjection::lonlat2xy(idx_t n, const double lon[], const double lat[], double x[], double y[],
+                                              idx_t stride) const {
+    convert_points(n, lon, lat, x, y, stride, [this](double crd[]) { CubedSphereEquiAnglProjection::lonlat2xy(crd); });
+}
+
 // -------------------------------------------------------------------------------------------------
 
 Jacobian CubedSphereEquiAnglProjection::jacobian(const PointLonLat& lonlat) const {
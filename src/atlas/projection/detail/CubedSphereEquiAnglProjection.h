@@ -49,6 +49,10 @@ public:
     // projection and inverse projection
     void xy2lonlat(double crd[]) const override;
     void lonlat2xy(double crd[]) const override;
+    void xy2lonlat(idx_t n, const double x[], const double y[], double lon[], double lat[],
+                   idx_t stride) const override;
+    void lonlat2xy(idx_t n, const double lon[], const double lat[], double x[], double y[],
+                   idx_t stride) const override;
 
     Jacobian jacobian(const PointLonLat&) const override;
 
@@ -126,6 +126,16 @@ void CubedSphereEquiDistProjection::xy2lonlat(double crd[]) const {
     }
 }
 
+void CubedSphereEquiDistProjection::xy2lonlat(idx_t n, const double x[], const double y[], double lon[], double lat[],
+                                              idx_t stride) const {
+    convert_points(n, x, y, lon, lat, stride, [this](double crd[]) { CubedSphereEquiDistProjection::xy2lonlat(crd); });
+}
+
+void CubedSphereEquiDistProjection::lonlat2xy(idx_t n, const double lon[], const double lat[], double x[], double y[],
+                                              idx_t stride) const {
+    convert_points(n, lon, lat, x, y, stride, [this](double crd[]) { CubedSphereEquiDistProjection::lonlat2xy(crd); });
+}
+
 
 // -------------------------------------------------------------------------------------------------
 
@@ -85,6 +85,18 @@ void LambertAzimuthalEqualAreaProjection::xy2lonlat(double crd[]) const {
     crd[LAT] = sin_lat_r > 1 ? 90 : sin_lat_r < -1 ? -90 : util::Constants::radiansToDegrees() * std::asin(sin_lat_r);
 }
 
+void LambertAzimuthalEqualAreaProjection::xy2lonlat(idx_t n, const double x[], const double y[], double lon[],
+                                                    double lat[], idx_t stride) const {
+    convert_points(n, x, y, lon, lat, stride,
+                   [this](double crd[]) { LambertAzimuthalEqualAreaProjection::xy2lonlat(crd); });
+}
+
+void LambertAzimuthalEqualAreaProjection::lonlat2xy(idx_t n, const double lon[], const double lat[], double x[],
+                                                    double y[], idx_t stride) const {
+    convert_points(n, lon, lat, x, y, stride,
+                   [this](double crd[]) { LambertAzimuthalEqualAreaProjection::lonlat2xy(crd); });
+}
+
 
 ProjectionImpl::Jacobian LambertAzimuthalEqualAreaProjection::jacobian(const PointLonLat&) const {
     throw_NotImplemented("LambertAzimuthalEqualAreaProjection::jacobian", Here());
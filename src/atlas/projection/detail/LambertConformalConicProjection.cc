@@ -99,6 +99,18 @@ void LambertConformalConicProjection::xy2lonlat(double crd[]) const {
                    : util::Constants::radiansToDegrees() * 2. * std::atan(std::pow(radius_ * F_ / rho, inv_n_)) - 90.;
 }
 
+void LambertConformalConicProjection::xy2lonlat(idx_t n, const double x[], const double y[], double lon[], double lat[],
+                                                idx_t stride) const {
+    convert_points(n, x, y, lon, lat, stride,
+                   [this](double crd[]) { LambertConformalConicProjection::xy2lonlat(crd); });
+}
+
+void LambertConformalConicProjection::lonlat2xy(idx_t n, const double lon[], const double lat[], double x[], double y[],
+                                                idx_t stride) const {
+    convert_points(n, lon, lat, x, y, stride,
+                   [this](double crd[]) { LambertConformalConicProjection::lonlat2xy(crd); });
+}
+
 ProjectionImpl::Jacobian LambertConformalConicProjection::jacobian(const PointLonLat& lonlat) const {
     ProjectionImpl::Jacobian jac;
 
@@ -40,6 +40,16 @@ public:
     // projection and inverse projection
     void xy2lonlat(double crd[]) const override { rotation_.rotate(crd); }
     void lonlat2xy(double crd[]) const override { rotation_.unrotate(crd); }
+    void xy2lonlat(idx_t n, const double x[], const double y[], double lon[], double lat[],
+                   idx_t stride) const override {
+        copy_points(n, x, y, lon, lat, stride);
+        rotation_.rotate(n, lon, lat, stride);
+    }
+    void lonlat2xy(idx_t n, const double lon[], const double lat[], double x[], double y[],
+                   idx_t stride) const override {
+        copy_points(n, lon, lat, x, y, stride);
+        rotation_.unrotate(n, x, y, stride);
+    }
 
     Jacobian jacobian(const PointLonLat&) const override;
 
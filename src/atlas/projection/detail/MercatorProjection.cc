@@ -152,6 +152,60 @@ void MercatorProjectionT<Rotation>::xy2lonlat(double crd[]) const {
     normalise_(crd);
 }
 
+template <typename Rotation>
+void MercatorProjectionT<Rotation>::xy2lonlat(idx_t n, const double x[], const double y[], double lon[],
+                                              double lat[], idx_t stride) const {
+    //  deepcode ignore FloatingPointEquals: We want exact comparison
+    if (eccentricity_ != 0.) {
+        // iterative latitude computation, see xy2lonlat(double[])
+        convert_points(n, x, y, lon, lat, stride, [this](double crd[]) { MercatorProjectionT::xy2lonlat(crd); });
+        return;
+    }
+
+    // first projection
+    for (idx_t i = 0; i < n; ++i) {
+        const idx_t j   = i * stride;
+        const double xx = x[j] - false_easting_;
+        const double yy = y[j] - false_northing_;
+        lon[j]          = lon0_ + R2D(xx * inv_k_radius_);
+        lat[j]          = 90. - 2. * R2D(std::atan(std::exp(-yy * inv_k_radius_)));
+    }
+
+    // then rotate
+    rotation_.rotate(n, lon, lat, stride);
+
+    // then normalise
+    if (normalise_) {
+        for (idx_t i = 0; i < n; ++i) {
+            normalise_(lon + i * stride);
+        }
+    }
+}
+
+template <typename Rotation>
+void MercatorProjectionT<Rotation>::lonlat2xy(idx_t n, const double lon[], const double lat[], double x[],
+                                              double y[], idx_t stride) const {
+    // first unrotate
+    copy_points(n, lon, lat, x, y, stride);
+    rotation_.unrotate(n, x, y, stride);
+
+    // then project
+    for (idx_t i = 0; i < n; ++i) {
+        const idx_t j = i * stride;
+        double sinlat = std::sin(D2R(y[j]));
+        double t      = (1. + sinlat) / (1. - sinlat);
+        if (eccentricity_ > 0) {  // --> ellipsoidal correction
+            double e        = eccentricity_;
+            double e_sinlat = e * sinlat;
+            t *= std::pow((1. - e_sinlat) / (1. + e_sinlat), e);
+        }
+        x[j] = k_radius_ * (D2R(normalise_mercator_(x[j]) - lon0_));
+        y[j] = k_radius_ * 0.5 * std::log(t);
+        x[j] += false_easting_;
+        y[j] += false_northing_;
+    }
+}
+
 template <typename Rotation>
 ProjectionImpl::Jacobian MercatorProjectionT<Rotation>::jacobian(const PointLonLat&) const {
     throw_NotImplemented("MercatorProjectionT::jacobian", Here());
@@ -33,6 +33,8 @@ public:
 
     std::string type() const override { return static_type(); }
 
+    using ProjectionImpl::lonlat2xy;
+    using ProjectionImpl::xy2lonlat;
     void xy2lonlat(double[]) const override;
     void lonlat2xy(double[]) const override;
 
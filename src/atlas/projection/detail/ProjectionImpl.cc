@@ -226,6 +226,15 @@ const ProjectionImpl* ProjectionImpl::create(const std::string& type, const ecki
     return ProjectionFactory::build(type, p);
 }
 
+void ProjectionImpl::xy2lonlat(idx_t n, const double x[], const double y[], double lon[], double lat[],
+                               idx_t stride) const {
+    convert_points(n, x, y, lon, lat, stride, [this](double crd[]) { xy2lonlat(crd); });
+}
+
+void ProjectionImpl::lonlat2xy(idx_t n, const double lon[], const double lat[], double x[], double y[],
+                               idx_t stride) const {
+    convert_points(n, lon, lat, x, y, stride, [this](double crd[]) { lonlat2xy(crd); });
+}
 
 PointXYZ ProjectionImpl::xyz(const PointLonLat& lonlat) const {
     atlas::PointXYZ xyz;
@@ -15,6 +15,7 @@
 #include <memory>
 #include <string>
 
+#include "atlas/library/config.h"
 #include "atlas/projection/Jacobian.h"
 #include "atlas/runtime/Exception.h"
 #include "atlas/util/Factory.h"
@@ -57,6 +58,25 @@ public:
     virtual void xy2lonlat(double crd[]) const = 0;
     virtual void lonlat2xy(double crd[]) const = 0;
 
+    /// @brief Convert n points from xy to lonlat
+    ///
+    /// Point i is read from (x[i*stride], y[i*stride]) and written to (lon[i*stride], lat[i*stride]),
+    /// so interleaved coordinates are converted with stride 2. Input and output may alias.
+    /// The default implementation calls the single-point conversion for each point.
+    virtual void xy2lonlat(idx_t n, const double x[], const double y[], double lon[], double lat[],
+                           idx_t stride) const;
+
+    /// @brief Convert n points from lonlat to xy, see xy2lonlat(idx_t, ...)
+    virtual void lonlat2xy(idx_t n, const double lon[], const double lat[], double x[], double y[],
+                           idx_t stride) const;
+
+    void xy2lonlat(idx_t n, const double x[], const double y[], double lon[], double lat[]) const {
+        xy2lonlat(n, x, y, lon, lat, 1);
+    }
+    void lonlat2xy(idx_t n, const double lon[], const double lat[], double x[], double y[]) const {
+        lonlat2xy(n, lon, lat, x, y, 1);
+    }
+
     virtual Jacobian jacobian(const PointLonLat&) const = 0;
 
     void xy2lonlat(Point2&) const;
@@ -139,6 +159,31 @@ public:
         virtual ProjectionImpl::Derivate* make(const ProjectionImpl& p, PointXY A, PointXY B, double h,
                                                double refLongitude = 0.) = 0;
     };
+
+protected:
+    /// Apply a single-point conversion to n strided points, see xy2lonlat(idx_t, ...)
+    template <typename Convert>
+    static void convert_points(idx_t n, const double a[], const double b[], double c[], double d[], idx_t stride,
+                               const Convert& convert_point) {
+        for (idx_t i = 0; i < n; ++i) {
+            const idx_t j = i * stride;
+            double crd[]  = {a[j], b[j]};
+            convert_point(crd);
+            c[j] = crd[0];
+            d[j] = crd[1];
+        }
+    }
+
+    /// Copy n strided points from (a,b) to (c,d), unless they alias already
+    static void copy_points(idx_t n, const double a[], const double b[], double c[], double d[], idx_t stride) {
+        if (a != c || b != d) {
+            for (idx_t i = 0; i < n; ++i) {
+                const idx_t j = i * stride;
+                c[j]          = a[j];
+                d[j]          = b[j];
+            }
+        }
+    }
 };
 
 inline void ProjectionImpl::xy2lonlat(Point2& point) const {
@@ -194,6 +239,10 @@ public:
     }
     void unrotate(double*) const { /* do nothing */
     }
+    void rotate(idx_t, double[], double[], idx_t) const { /* do nothing */
+    }
+    void unrotate(idx_t, double[], double[], idx_t) const { /* do nothing */
+    }
 
     bool rotated() const { return false; }
 
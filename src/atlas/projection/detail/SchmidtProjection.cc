@@ -77,6 +77,28 @@ void SchmidtProjectionT<Rotation>::lonlat2xy(double crd[]) const {
     crd[1] = R2D(std::asin(std::cos(2. * std::atan(c_ * std::tan(std::acos(std::sin(D2R(crd[1]))) * 0.5)))));
 }
 
+template <typename Rotation>
+void SchmidtProjectionT<Rotation>::xy2lonlat(idx_t n, const double x[], const double y[], double lon[], double lat[],
+                                             idx_t stride) const {
+    for (idx_t i = 0; i < n; ++i) {
+        const idx_t j = i * stride;
+        lon[j]        = x[j];
+        lat[j] = R2D(std::asin(std::cos(2. * std::atan(1 / c_ * std::tan(std::acos(std::sin(D2R(y[j]))) * 0.5)))));
+    }
+    rotation_.rotate(n, lon, lat, stride);
+}
+
+template <typename Rotation>
+void SchmidtProjectionT<Rotation>::lonlat2xy(idx_t n, const double lon[], const double lat[], double x[], double y[],
+                                             idx_t stride) const {
+    copy_points(n, lon, lat, x, y, stride);
+    rotation_.unrotate(n, x, y, stride);
+    for (idx_t i = 0; i < n; ++i) {
+        const idx_t j = i * stride;
+        y[j]          = R2D(std::asin(std::cos(2. * std::atan(c_ * std::tan(std::acos(std::sin(D2R(y[j]))) * 0.5)))));
+    }
+}
+
 template <>
 ProjectionImpl::Jacobian SchmidtProjectionT<NotRotated>::jacobian(const PointLonLat&) const {
     throw_NotImplemented("SchmidtProjectionT<NotRotated>::jacobian", Here());
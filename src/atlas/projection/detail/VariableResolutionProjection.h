@@ -34,6 +34,8 @@ public:
 
     // projection and inverse projection
 
+    using ProjectionImpl::lonlat2xy;
+    using ProjectionImpl::xy2lonlat;
     void xy2lonlat(double crd[]) const override;
     void lonlat2xy(double crd[]) const override;
 
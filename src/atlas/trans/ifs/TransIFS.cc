@@ -614,6 +614,9 @@ struct PackStructuredColumns {
     PackStructuredColumns(LocalView<double, 2>& rgpview): rgpview_(rgpview), f(0) {}
 
     void operator()(const StructuredColumns& sc, const Field& field, idx_t components = 0) {
+        if (sc.ordering() != "none") {
+            throw_NotImplemented("Spectral transforms require StructuredColumns with default ordering", Here());
+        }
         switch (field.rank()) {
             case 1:
                 pack_1(sc, field, components);
@@ -786,6 +789,9 @@ struct UnpackStructuredColumns {
     UnpackStructuredColumns(const LocalView<double, 2>& rgpview): rgpview_(rgpview), f(0) {}
 
     void operator()(const StructuredColumns& sc, Field& field, int components = 0) {
+        if (sc.ordering() != "none") {
+            throw_NotImplemented("Spectral transforms require StructuredColumns with default ordering", Here());
+        }
         switch (field.rank()) {
             case 1:
                 unpack_1(sc, field, components);
@@ -0,0 +1,176 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#include "atlas/trans/local/AuxiliaryGridInterpolation.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <string>
+
+#include "atlas/parallel/omp/omp.h"
+#include "atlas/runtime/Exception.h"
+
+namespace atlas {
+namespace trans {
+
+namespace {
+
+// Relative accuracy of cardinal interpolation with an oversampling factor of 2 is about 10^(2-width)
+int kernel_width(double tolerance) {
+    ATLAS_ASSERT(tolerance > 0.);
+    int width = static_cast<int>(std::ceil(-std::log10(tolerance))) + 2;
+    return std::max(4, std::min(width, AuxiliaryGridInterpolation::max_width));
+}
+
+}  // namespace
+
+//-----------------------------------------------------------------------------
+
+AuxiliaryGridInterpolation::AuxiliaryGridInterpolation(int bandwidth, double tolerance):
+    nx_(4 * (bandwidth + 1)),
+    ny_(2 * (bandwidth + 1)),
+    width_(kernel_width(tolerance)),
+    beta_(2.30 * width_),
+    tolerance_(tolerance) {
+    grid_ = Grid("Slat" + std::to_string(nx_) + "x" + std::to_string(ny_));
+
+    for (int d = 0; 2 * d < width_; ++d) {
+        kernel_samples_.push_back(kernel(d));
+    }
+
+    // Discrete Fourier transform of the kernel samples along a latitude
+    zonal_deconvolution_.resize(bandwidth + 1);
+    for (int m = 0; m <= bandwidth; ++m) {
+        double symbol = kernel_samples_[0];
+        for (size_t d = 1; d < kernel_samples_.size(); ++d) {
+            symbol += 2. * kernel_samples_[d] * std::cos(2. * M_PI * m * d / nx_);
+        }
+        zonal_deconvolution_[m] = 1. / symbol;
+    }
+}
+
+double AuxiliaryGridInterpolation::kernel(double distance) const {
+    const double z = 2. * distance / width_;
+    return std::abs(z) < 1. ? std::exp(beta_ * (std::sqrt(1. - z * z) - 1.)) : 0.;
+}
+
+void AuxiliaryGridInterpolation::deconvolve_meridional(int nb_fields, int nb_wind_fields, double values[]) const {
+    // The meridians at longitudes i and i + nx/2 form a great circle of 2*ny uniformly spaced points, on which the
+    // kernel convolution is a symmetric positive definite circulant matrix with a condition number below 10.
+    const int size_circle    = 2 * ny_;
+    const int nb_circles     = nx_ / 2;
+    const int nb_kernel      = static_cast<int>(kernel_samples_.size());
+    const size_t size_field  = size_t(nx_) * size_t(ny_);
+    const int max_iterations = 100;
+
+    atlas_omp_parallel {
+        std::vector<double> b(size_circle), x(size_circle), r(size_circle), p(size_circle), q(size_circle);
+        auto convolve = [&](const std::vector<double>& in, std::vector<double>& out) {
+            for (int k = 0; k < size_circle; ++k) {
+                double sum = kernel_samples_[0] * in[k];
+                for (int d = 1; d < nb_kernel; ++d) {
+                    sum += kernel_samples_[d] *
+                           (in[(k + d) % size_circle] + in[(k - d + size_circle) % size_circle]);
+                }
+                out[k] = sum;
+            }
+        };
+        auto dot = [&](const std::vector<double>& u, const std::vector<double>& v) {
+            double sum = 0.;
+            for (int k = 0; k < size_circle; ++k) {
+                sum += u[k] * v[k];
+            }
+            return sum;
+        };
+
+        atlas_omp_for(int jcircle = 0; jcircle < nb_fields * nb_circles; ++jcircle) {
+            const int jfld    = jcircle / nb_circles;
+            const int i       = jcircle % nb_circles;
+            const double sign = (jfld < nb_wind_fields ? -1. : 1.);
+            double* field     = values + jfld * size_field;
+
+            for (int j = 0; j < ny_; ++j) {
+                b[j]                   = field[size_t(j) * nx_ + i];
+                b[size_circle - 1 - j] = sign * field[size_t(j) * nx_ + i + nb_circles];
+            }
+
+            // Conjugate gradients
+            std::fill(x.begin(), x.end(), 0.);
+            r                 = b;
+            p                 = b;
+            double rr         = dot(r, r);
+            const double stop = tolerance_ * tolerance_ * rr;
+            for (int iteration = 0; iteration < max_iterations && rr > stop; ++iteration) {
+                convolve(p, q);
+                const double alpha = rr / dot(p, q);
+                for (int k = 0; k < size_circle; ++k) {
+                    x[k] += alpha * p[k];
+                    r[k] -= alpha * q[k];
+                }
+                const double rr_next = dot(r, r);
+                for (int k = 0; k < size_circle; ++k) {
+                    p[k] = r[k] + (rr_next / rr) * p[k];
+                }
+                rr = rr_next;
+            }
+
+            for (int j = 0; j < ny_; ++j) {
+                field[size_t(j) * nx_ + i]              = x[j];
+                field[size_t(j) * nx_ + i + nb_circles] = sign * x[size_circle - 1 - j];
+            }
+        }
+    }
+}
+
+void AuxiliaryGridInterpolation::interpolate(const PointLonLat& p, int nb_fields, int nb_wind_fields,
+                                             const double values[], double result[], size_t stride) const {
+    // Fractional grid indices of the point
+    const double u_lon = p.lon() / 360. * nx_;
+    const double u_lat = (90. - p.lat()) / 180. * ny_ - 0.5;
+    const int i0       = static_cast<int>(std::floor(u_lon - 0.5 * width_)) + 1;
+    const int j0       = static_cast<int>(std::floor(u_lat - 0.5 * width_)) + 1;
+
+    std::array<double, max_width> weight_lon, weight_lat;
+    std::array<int, max_width> col, col_across_pole, row;
+    std::array<bool, max_width> across_pole;
+    for (int a = 0; a < width_; ++a) {
+        weight_lon[a]      = kernel(u_lon - (i0 + a));
+        col[a]             = ((i0 + a) % nx_ + nx_) % nx_;
+        col_across_pole[a] = (col[a] + nx_ / 2) % nx_;
+    }
+    for (int b = 0; b < width_; ++b) {
+        const int j    = j0 + b;
+        weight_lat[b]  = kernel(u_lat - j);
+        across_pole[b] = (j < 0 || j >= ny_);
+        row[b]         = (j < 0 ? -1 - j : (j >= ny_ ? 2 * ny_ - 1 - j : j));
+    }
+
+    const size_t size_field = size_t(nx_) * size_t(ny_);
+    for (int jfld = 0; jfld < nb_fields; ++jfld) {
+        const double sign = (jfld < nb_wind_fields ? -1. : 1.);
+        double sum        = 0.;
+        for (int b = 0; b < width_; ++b) {
+            const double* values_row = values + jfld * size_field + size_t(row[b]) * nx_;
+            const auto& cols         = across_pole[b] ? col_across_pole : col;
+            double sum_row           = 0.;
+            for (int a = 0; a < width_; ++a) {
+                sum_row += weight_lon[a] * values_row[cols[a]];
+            }
+            sum += weight_lat[b] * (across_pole[b] ? sign * sum_row : sum_row);
+        }
+        result[jfld * stride] = sum;
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+}  // namespace trans
+}  // namespace atlas
@@ -0,0 +1,79 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#pragma once
+
+#include <vector>
+
+#include "atlas/grid/Grid.h"
+#include "atlas/util/Point.h"
+
+namespace atlas {
+namespace trans {
+
+//-----------------------------------------------------------------------------
+
+/// @brief Evaluation at arbitrary points of band-limited spherical fields given on an auxiliary grid
+///
+/// The auxiliary grid is a regular longitude-latitude grid with latitudes shifted away from the poles,
+/// oversampled by a factor 2 with respect to the bandwidth. Continued across the poles (longitude + 180 degrees,
+/// with a change of sign for wind components), every meridian is a uniformly sampled great circle.
+///
+/// Fields are interpolated with a tensor product of "exponential of semicircle" kernels, as in non-uniform FFTs.
+/// Interpolation is cardinal: the kernel is deconvolved from the grid values beforehand, exactly in spectral space
+/// for longitudes (zonal_deconvolution), and with a conjugate gradient solve along the great circles for latitudes
+/// (deconvolve_meridional). The kernel width follows from the requested relative tolerance.
+///
+/// Reference:
+///    A. Barnett, J. Magland, L. af Klinteberg, A parallel nonuniform fast Fourier transform library based on an
+///    "exponential of semicircle" kernel, SIAM J. Sci. Comput. 41 (2019) C479-C504
+class AuxiliaryGridInterpolation {
+public:
+    /// @param bandwidth  maximum wavenumber of the fields, in longitude and latitude
+    /// @param tolerance  relative interpolation tolerance
+    AuxiliaryGridInterpolation(int bandwidth, double tolerance);
+
+    /// Auxiliary grid "Slat<nx>x<ny>" where fields must be given
+    const Grid& grid() const { return grid_; }
+
+    /// Number of grid points of the kernel in each direction
+    int width() const { return width_; }
+
+    /// Maximum kernel width, reached for tolerances around 1.e-14
+    static constexpr int max_width = 16;
+
+    /// Factor to apply to spectral coefficients of zonal wavenumber m before transforming to grid()
+    double zonal_deconvolution(int m) const { return zonal_deconvolution_[m]; }
+
+    /// Deconvolve the kernel along meridians, in place.
+    /// Values are ordered [field][grid point]; the first nb_wind_fields fields are wind components.
+    void deconvolve_meridional(int nb_fields, int nb_wind_fields, double values[]) const;
+
+    /// Interpolate deconvolved values at a point, with result[jfld * stride] for each field
+    void interpolate(const PointLonLat&, int nb_fields, int nb_wind_fields, const double values[], double result[],
+                     size_t stride) const;
+
+private:
+    double kernel(double distance) const;
+
+    Grid grid_;
+    int nx_;
+    int ny_;
+    int width_;
+    double beta_;
+    std::vector<double> zonal_deconvolution_;
+    std::vector<double> kernel_samples_;  // kernel(d) for integer d = 0, 1, ... within the kernel support
+    double tolerance_;
+};
+
+//-----------------------------------------------------------------------------
+
+}  // namespace trans
+}  // namespace atlas
@@ -0,0 +1,350 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#include "atlas/trans/local/ButterflyMatrix.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <numeric>
+
+#include "atlas/parallel/omp/omp.h"
+#include "atlas/runtime/Exception.h"
+
+namespace atlas {
+namespace trans {
+
+namespace {
+
+// Interpolative decomposition of the columns of W (m x n, column-major, overwritten), with absolute tolerance:
+//     W(:, pivots[rank:n]) ~= W(:, pivots[0:rank]) * T,   T = interpolation [n-rank][rank]
+// computed with a column-pivoted modified Gram-Schmidt QR factorisation.
+void interpolative_decomposition(std::vector<double>& W, size_t m, size_t n, double tolerance,
+                                 std::vector<size_t>& pivots, std::vector<double>& interpolation, size_t& rank) {
+    pivots.resize(n);
+    std::iota(pivots.begin(), pivots.end(), 0);
+    std::vector<double> R(n * n, 0.);  // R(i,j) = R[i + n*j], in pivoted order
+    std::vector<double> norms(n);
+    auto column = [&](size_t j) { return W.data() + m * j; };
+
+    const size_t max_rank = std::min(m, n);
+    rank                  = 0;
+    while (rank < max_rank) {
+        for (size_t j = rank; j < n; ++j) {
+            const double* w = column(j);
+            double norm2    = 0.;
+            for (size_t i = 0; i < m; ++i) {
+                norm2 += w[i] * w[i];
+            }
+            norms[j] = norm2;
+        }
+        const size_t p = std::max_element(norms.begin() + rank, norms.end()) - norms.begin();
+        const double r = std::sqrt(norms[p]);
+        if (r <= tolerance) {
+            break;
+        }
+        if (p != rank) {
+            std::swap_ranges(column(p), column(p) + m, column(rank));
+            std::swap_ranges(R.data() + n * p, R.data() + n * p + rank, R.data() + n * rank);
+            std::swap(pivots[p], pivots[rank]);
+        }
+        double* q = column(rank);
+        for (size_t i = 0; i < m; ++i) {
+            q[i] /= r;
+        }
+        R[rank + n * rank] = r;
+        for (size_t j = rank + 1; j < n; ++j) {
+            double* w  = column(j);
+            double dot = 0.;
+            for (size_t i = 0; i < m; ++i) {
+                dot += q[i] * w[i];
+            }
+            for (size_t i = 0; i < m; ++i) {
+                w[i] -= dot * q[i];
+            }
+            R[rank + n * j] = dot;
+        }
+        ++rank;
+    }
+
+    // T = R11^{-1} R12, by back substitution for every redundant column
+    interpolation.assign(rank * (n - rank), 0.);
+    for (size_t j = 0; j < n - rank; ++j) {
+        double* t = interpolation.data() + rank * j;
+        for (size_t i = rank; i-- > 0;) {
+            double s = R[i + n * (rank + j)];
+            for (size_t k = i + 1; k < rank; ++k) {
+                s -= R[i + n * k] * t[k];
+            }
+            t[i] = s / R[i + n * i];
+        }
+    }
+}
+
+template <typename T>
+void write_value(char*& buffer, const T& value) {
+    std::memcpy(buffer, &value, sizeof(T));
+    buffer += sizeof(T);
+}
+
+template <typename T>
+void write_vector(char*& buffer, const std::vector<T>& values) {
+    write_value(buffer, values.size());
+    std::memcpy(buffer, values.data(), values.size() * sizeof(T));
+    buffer += values.size() * sizeof(T);
+}
+
+template <typename T>
+void read_value(const char*& buffer, T& value) {
+    std::memcpy(&value, buffer, sizeof(T));
+    buffer += sizeof(T);
+}
+
+template <typename T>
+void read_vector(const char*& buffer, std::vector<T>& values) {
+    size_t size;
+    read_value(buffer, size);
+    values.resize(size);
+    std::memcpy(values.data(), buffer, size * sizeof(T));
+    buffer += size * sizeof(T);
+}
+
+}  // namespace
+
+//-----------------------------------------------------------------------------
+
+ButterflyMatrix::ButterflyMatrix(const double B[], size_t rows, size_t cols, double threshold, size_t leaf_size):
+    rows_(rows), cols_(cols) {
+    ATLAS_ASSERT(leaf_size > 0);
+    while ((rows_ >> levels_) > leaf_size && (size_t(1) << (levels_ + 1)) <= cols_) {
+        ++levels_;
+    }
+
+    double scale = 0.;
+    for (size_t i = 0; i < rows_; ++i) {
+        double norm2 = 0.;
+        for (size_t j = 0; j < cols_; ++j) {
+            norm2 += B[i + rows_ * j] * B[i + rows_ * j];
+        }
+        scale = std::max(scale, norm2);
+    }
+    const double tolerance = threshold * std::sqrt(scale);
+
+    nodes_.resize((levels_ + 1) << levels_);
+    std::vector<std::vector<size_t>> skeletons(nodes_.size());  // rows of B
+    std::vector<std::vector<size_t>> node_pivots(nodes_.size());
+    std::vector<std::vector<double>> node_interpolation(nodes_.size());
+
+    for (size_t level = 0; level <= levels_; ++level) {
+        const size_t nb_nodes = size_t(1) << levels_;
+        atlas_omp_parallel_for(size_t jnode = 0; jnode < nb_nodes; ++jnode) {
+            const size_t iblock = jnode / nb_row_blocks(level);
+            const size_t jblock = jnode % nb_row_blocks(level);
+            const size_t inode  = node_index(level, iblock, jblock);
+
+            std::vector<size_t> candidates;
+            if (level == 0) {
+                candidates.resize(row_begin(0, jblock + 1) - row_begin(0, jblock));
+                std::iota(candidates.begin(), candidates.end(), row_begin(0, jblock));
+            }
+            else {
+                const size_t child = node_index(level - 1, iblock / 2, 2 * jblock);
+                candidates         = skeletons[child];
+                candidates.insert(candidates.end(), skeletons[child + 1].begin(), skeletons[child + 1].end());
+            }
+
+            const size_t c0 = col_begin(level, iblock);
+            const size_t nc = col_begin(level, iblock + 1) - c0;
+            const size_t nr = candidates.size();
+            std::vector<double> W(nc * nr);
+            for (size_t r = 0; r < nr; ++r) {
+                for (size_t c = 0; c < nc; ++c) {
+                    W[c + nc * r] = B[candidates[r] + rows_ * (c0 + c)];
+                }
+            }
+
+            size_t rank;
+            interpolative_decomposition(W, nc, nr, tolerance, node_pivots[inode], node_interpolation[inode], rank);
+            nodes_[inode].candidates = nr;
+            nodes_[inode].rank       = rank;
+            skeletons[inode].resize(rank);
+            for (size_t r = 0; r < rank; ++r) {
+                skeletons[inode][r] = candidates[node_pivots[inode][r]];
+            }
+        }
+    }
+
+    // Flatten node data
+    for (size_t inode = 0; inode < nodes_.size(); ++inode) {
+        Node& node         = nodes_[inode];
+        node.pivots        = pivots_.size();
+        node.interpolation = interpolation_.size();
+        node.block         = blocks_.size();
+        pivots_.insert(pivots_.end(), node_pivots[inode].begin(), node_pivots[inode].end());
+        interpolation_.insert(interpolation_.end(), node_interpolation[inode].begin(),
+                              node_interpolation[inode].end());
+    }
+    for (size_t iblock = 0; iblock < nb_col_blocks(levels_); ++iblock) {
+        Node& node = nodes_[node_index(levels_, iblock, 0)];
+        node.block = blocks_.size();
+        for (size_t c = col_begin(levels_, iblock); c < col_begin(levels_, iblock + 1); ++c) {
+            for (size_t r : skeletons[node_index(levels_, iblock, 0)]) {
+                blocks_.emplace_back(B[r + rows_ * c]);
+            }
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+size_t ButterflyMatrix::row_begin(size_t level, size_t jblock) const {
+    // a row block at this level merges 2^level leaf blocks
+    return ((jblock << level) * rows_) >> levels_;
+}
+
+size_t ButterflyMatrix::col_begin(size_t level, size_t iblock) const {
+    return (iblock * cols_) >> level;
+}
+
+size_t ButterflyMatrix::node_index(size_t level, size_t iblock, size_t jblock) const {
+    return (level << levels_) + iblock * nb_row_blocks(level) + jblock;
+}
+
+//-----------------------------------------------------------------------------
+
+void ButterflyMatrix::multiply(const double A[], size_t nvec, double C[], size_t col_begin_, size_t col_end_) const {
+    ATLAS_ASSERT(col_begin_ <= col_end_ && col_end_ <= cols_);
+    if (col_begin_ == col_end_) {
+        return;
+    }
+    const size_t nb_nodes = size_t(1) << levels_;
+
+    // Skeleton coefficients of the nodes of the previous and current level: [node][rank][nvec]
+    std::vector<double> previous;
+    std::vector<double> current;
+    std::vector<size_t> previous_offset(nb_nodes + 1);
+    std::vector<size_t> offset(nb_nodes + 1);
+
+    for (size_t level = 0; level <= levels_; ++level) {
+        const Node* nodes = nodes_.data() + node_index(level, 0, 0);
+        offset[0]         = 0;
+        for (size_t jnode = 0; jnode < nb_nodes; ++jnode) {
+            offset[jnode + 1] = offset[jnode] + nodes[jnode].rank * nvec;
+        }
+        current.resize(offset[nb_nodes]);
+
+        // Only column blocks intersecting [col_begin_, col_end_) are needed. Column c is in the block iblock with
+        // col_begin(level, iblock) <= c < col_begin(level, iblock + 1), that is
+        // iblock = ceil((c + 1) * 2^level / cols) - 1
+        const size_t nb_row_blocks_level = nb_row_blocks(level);
+        const size_t iblock_begin        = (((col_begin_ + 1) << level) + cols_ - 1) / cols_ - 1;
+        const size_t iblock_end          = ((col_end_ << level) + cols_ - 1) / cols_;
+
+        atlas_omp_parallel_for(size_t jnode = iblock_begin * nb_row_blocks_level;
+                               jnode < iblock_end * nb_row_blocks_level; ++jnode) {
+            const Node& node = nodes[jnode];
+            const double* u;
+            if (level == 0) {
+                u = A + nvec * row_begin(0, jnode);
+            }
+            else {
+                // candidates are the skeletons of both children, which are adjacent in the previous level
+                const size_t iblock = jnode / nb_row_blocks_level;
+                const size_t jblock = jnode % nb_row_blocks_level;
+                u = previous.data() + previous_offset[(iblock / 2) * nb_row_blocks(level - 1) + 2 * jblock];
+            }
+            double* x            = current.data() + offset[jnode];
+            const size_t rank    = node.rank;
+            const size_t* pivots = pivots_.data() + node.pivots;
+            for (size_t r = 0; r < rank; ++r) {
+                std::copy_n(u + nvec * pivots[r], nvec, x + nvec * r);
+            }
+            for (size_t q = 0; q < node.candidates - rank; ++q) {
+                const double* uq = u + nvec * pivots[rank + q];
+                const double* t  = interpolation_.data() + node.interpolation + rank * q;
+                for (size_t r = 0; r < rank; ++r) {
+                    double* xr = x + nvec * r;
+                    for (size_t v = 0; v < nvec; ++v) {
+                        xr[v] += t[r] * uq[v];
+                    }
+                }
+            }
+        }
+        std::swap(previous, current);
+        std::swap(previous_offset, offset);
+    }
+
+    // Dense skeleton blocks of the last level, which has one node per column block
+    const Node* nodes = nodes_.data() + node_index(levels_, 0, 0);
+    for (size_t iblock = 0; iblock < nb_nodes; ++iblock) {
+        const size_t c0 = std::max(col_begin(levels_, iblock), col_begin_);
+        const size_t c1 = std::min(col_begin(levels_, iblock + 1), col_end_);
+        if (c0 >= c1) {
+            continue;
+        }
+        const Node& node = nodes[iblock];
+        const double* x  = previous.data() + previous_offset[iblock];
+        for (size_t c = c0; c < c1; ++c) {
+            const double* b = blocks_.data() + node.block + node.rank * (c - col_begin(levels_, iblock));
+            double* y       = C + nvec * (c - col_begin_);
+            std::fill_n(y, nvec, 0.);
+            for (size_t r = 0; r < node.rank; ++r) {
+                const double* xr = x + nvec * r;
+                for (size_t v = 0; v < nvec; ++v) {
+                    y[v] += b[r] * xr[v];
+                }
+            }
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+size_t ButterflyMatrix::bytes() const {
+    return 8 * sizeof(size_t) + nodes_.size() * sizeof(Node) + pivots_.size() * sizeof(size_t) +
+           (interpolation_.size() + blocks_.size()) * sizeof(double);
+}
+
+void ButterflyMatrix::write(char*& buffer) const {
+    const char* begin = buffer;
+    write_value(buffer, rows_);
+    write_value(buffer, cols_);
+    write_value(buffer, levels_);
+    write_vector(buffer, nodes_);
+    write_vector(buffer, pivots_);
+    write_vector(buffer, interpolation_);
+    write_vector(buffer, blocks_);
+    write_value(buffer, size_t(buffer - begin + sizeof(size_t)));  // total size, to check consistency
+}
+
+ButterflyMatrix ButterflyMatrix::read(const char*& buffer) {
+    const char* begin = buffer;
+    ButterflyMatrix matrix;
+    read_value(buffer, matrix.rows_);
+    read_value(buffer, matrix.cols_);
+    read_value(buffer, matrix.levels_);
+    read_vector(buffer, matrix.nodes_);
+    read_vector(buffer, matrix.pivots_);
+    read_vector(buffer, matrix.interpolation_);
+    read_vector(buffer, matrix.blocks_);
+    size_t size;
+    read_value(buffer, size);
+    const bool empty = matrix.nodes_.empty() && matrix.rows_ == 0;
+    if (size != size_t(buffer - begin) ||
+        (not empty && matrix.nodes_.size() != ((matrix.levels_ + 1) << matrix.levels_))) {
+        throw_Exception("Corrupt butterfly matrix in Legendre cache", Here());
+    }
+    return matrix;
+}
+
+//-----------------------------------------------------------------------------
+
+}  // namespace trans
+}  // namespace atlas
@@ -0,0 +1,94 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace atlas {
+namespace trans {
+
+//-----------------------------------------------------------------------------
+
+/// @brief Butterfly compression of a dense matrix B, for fast products C = A * B
+///
+/// The rows of B (input index) are split in a binary tree of blocks. At level 0 every leaf block of rows is
+/// paired with all columns (output index); at each next level pairs of row blocks are merged while the column
+/// blocks are halved. Every (row block, column block) pair is represented by a subset of its rows, the skeleton,
+/// computed with an interpolative decomposition up to an absolute tolerance of threshold times the largest row
+/// norm of B. Skeleton rows of the last level are stored as dense blocks.
+///
+/// For matrices with the complementary low-rank property, like associated Legendre functions of ordered total
+/// wavenumbers evaluated at ordered latitudes, storage and operation count are O(N log N) instead of O(N^2).
+///
+/// Reference:
+///    M. O'Neil, F. Woolfe, V. Rokhlin, An algorithm for the rapid evaluation of special function transforms,
+///    Appl. Comput. Harmon. Anal. 28 (2010) 203-226
+class ButterflyMatrix {
+public:
+    ButterflyMatrix() = default;
+
+    /// Compress the matrix B (rows x cols), stored column-major
+    ButterflyMatrix(const double B[], size_t rows, size_t cols, double threshold, size_t leaf_size = 64);
+
+    /// Read a matrix that was serialised with write(), advancing the buffer
+    static ButterflyMatrix read(const char*& buffer);
+
+    /// Serialise in buffer, advancing the buffer by bytes()
+    void write(char*& buffer) const;
+
+    /// Size in bytes of the serialised matrix
+    size_t bytes() const;
+
+    size_t rows() const { return rows_; }
+    size_t cols() const { return cols_; }
+
+    /// Number of levels of the butterfly
+    size_t levels() const { return levels_; }
+
+    /// Number of stored coefficients, to compare with rows() * cols() of the dense matrix
+    size_t footprint() const { return interpolation_.size() + blocks_.size(); }
+
+    /// C = A * B(:, col_begin:col_end), with A (nvec x rows) and C (nvec x (col_end - col_begin)), column-major
+    void multiply(const double A[], size_t nvec, double C[], size_t col_begin, size_t col_end) const;
+
+    /// C = A * B, with A (nvec x rows) and C (nvec x cols), column-major
+    void multiply(const double A[], size_t nvec, double C[]) const { multiply(A, nvec, C, 0, cols_); }
+
+private:
+    // Interpolative decomposition of a (row block, column block) pair
+    struct Node {
+        size_t candidates;     // number of candidate rows: a leaf block of B, or the skeletons of two nodes
+        size_t rank;           // number of skeleton rows
+        size_t pivots;         // offset in pivots_: [candidates], first the skeleton, then redundant positions
+        size_t interpolation;  // offset in interpolation_: [redundant][rank] coefficients
+        size_t block;          // offset in blocks_ for nodes of the last level: B(skeleton, cols) [cols][rank]
+    };
+
+    size_t row_begin(size_t level, size_t jblock) const;
+    size_t col_begin(size_t level, size_t iblock) const;
+    size_t nb_row_blocks(size_t level) const { return size_t(1) << (levels_ - level); }
+    size_t nb_col_blocks(size_t level) const { return size_t(1) << level; }
+    size_t node_index(size_t level, size_t iblock, size_t jblock) const;
+
+    size_t rows_{0};
+    size_t cols_{0};
+    size_t levels_{0};
+    std::vector<Node> nodes_;
+    std::vector<size_t> pivots_;
+    std::vector<double> interpolation_;
+    std::vector<double> blocks_;
+};
+
+//-----------------------------------------------------------------------------
+
+}  // namespace trans
+}  // namespace atlas
@@ -57,6 +57,9 @@ std::string hash(const eckit::Configuration& config) {
 
     // Add options and other unique keys
     h << "flt" << config.getBool("flt", false);
+    if (config.getBool("flt", false)) {
+        h << "flt_threshold" << config.getDouble("flt_threshold", 1.e-10);
+    }
 
     return truncate(h.digest());
 }
@@ -12,6 +12,7 @@
 
 #include <cmath>
 #include <cstdlib>
+#include <cstring>
 #include <fstream>
 
 #include "atlas/linalg/dense.h"
@@ -29,12 +30,14 @@
 #include "atlas/grid/StructuredGrid.h"
 #include "atlas/option.h"
 #include "atlas/parallel/mpi/mpi.h"
+#include "atlas/parallel/omp/omp.h"
 #include "atlas/runtime/Exception.h"
 #include "atlas/runtime/Log.h"
 #include "atlas/trans/Trans.h"
 #include "atlas/trans/VorDivToUV.h"
 #include "atlas/trans/detail/TransFactory.h"
 #include "atlas/trans/local/LegendrePolynomials.h"
+#include "atlas/trans/local/TransLocalDistributed.h"
 #include "atlas/util/Constants.h"
 
 #include "atlas/library/defines.h"
@@ -83,6 +86,14 @@ public:
 
     bool export_legendre() const { return config_.getBool("export_legendre", false); }
 
+    bool flt() const { return config_.getBool("flt", false); }
+
+    double flt_threshold() const { return config_.getDouble("flt_threshold", 1.e-10); }
+
+    bool auxiliary_grid() const { return config_.getBool("auxiliary_grid", false); }
+
+    double auxiliary_grid_tolerance() const { return config_.getDouble("auxiliary_grid_tolerance", 1.e-10); }
+
     int warning() const { return config_.getInt("warning", 1); }
 
     int fft() const {
@@ -216,6 +227,15 @@ size_t add_padding(size_t n) {
     return size_t(std::ceil(n / 8.)) * 8;
 }
 
+// Legendre caches with butterfly compressed coefficients (option "flt") start with this tag,
+// followed by the truncation and number of latitudes
+constexpr char butterfly_cache_tag[8] = {'a', 't', 'l', 'a', 's', 'F', 'L', 'T'};
+
+bool is_butterfly_cache(const void* cache, size_t size) {
+    return size >= sizeof(butterfly_cache_tag) &&
+           std::memcmp(cache, butterfly_cache_tag, sizeof(butterfly_cache_tag)) == 0;
+}
+
 std::string detect_linalg_backend(const std::string& linalg_backend_) {
     linalg::dense::Backend linalg_backend = linalg::dense::Backend{linalg_backend_};
     if (linalg_backend.type() == linalg::dense::backend::eckit_linalg::type()) {
@@ -284,6 +304,35 @@ struct FFTW_Data {
     fftw_complex* in;
     double* out;
     std::vector<fftw_plan> plans;
+
+    // Buffers and plans transforming several fields in one execution,
+    // created on first use and recreated when the number of fields changes
+    int batch_nb_fields{0};
+    fftw_complex* batch_in{nullptr};
+    double* batch_out{nullptr};
+    std::vector<fftw_plan> batch_plans;
+
+    void reset_batch(int nb_fields, size_t size_in, size_t size_out, size_t nb_plans) {
+        clear_batch();
+        batch_nb_fields = nb_fields;
+        batch_in        = fftw_alloc_complex(size_in);
+        batch_out       = fftw_alloc_real(size_out);
+        batch_plans.resize(nb_plans, nullptr);
+    }
+
+    void clear_batch() {
+        for (auto& plan : batch_plans) {
+            if (plan) {
+                fftw_destroy_plan(plan);
+            }
+        }
+        batch_plans.clear();
+        fftw_free(batch_in);
+        fftw_free(batch_out);
+        batch_in        = nullptr;
+        batch_out       = nullptr;
+        batch_nb_fields = 0;
+    }
 #endif
 };
 }  // namespace detail
@@ -315,7 +364,13 @@ TransLocal::TransLocal(const Cache& cache, const Grid& grid, const Domain& domai
     ATLAS_TRACE("TransLocal constructor");
 
     if (mpi::size() > 1) {
-        ATLAS_THROW_EXCEPTION("TransLocal is not implemented for more than 1 MPI task.");
+        if (not StructuredGrid(grid_) || grid_.projection() || not grid_.domain().global()) {
+            ATLAS_THROW_EXCEPTION(
+                "TransLocal with more than 1 MPI task is only implemented for global structured grids.");
+        }
+        distributed_.reset(new TransLocalDistributed(grid_, truncation_, TransParameters(config).fft(),
+                                                     linalg_backend_, config));
+        return;
     }
 
     double fft_threshold = 0.0;  // fraction of latitudes of the full grid down to which FFT is used.
@@ -570,7 +625,37 @@ TransLocal::TransLocal(const Cache& cache, const Grid& grid, const Domain& domai
                 legendre_asym_begin_[jm + 1] = size_asym;
             }
 
-            if (legendre_cache_) {
+            flt_ = TransParameters(config).flt();
+            if (legendre_cache_ && is_butterfly_cache(legendre_cache_, legendre_cachesize_)) {
+                flt_ = true;
+                ATLAS_TRACE("Read butterfly compressed Legendre coefficients");
+                read_legendre_butterflies(legendre_cache_, legendre_cachesize_);
+            }
+            else if (flt_) {
+                ATLAS_TRACE_SCOPE("Legendre precomputations (butterfly)") {
+                    compute_legendre_butterflies(lats.data(), TransParameters(config).flt_threshold());
+                }
+                const size_t bytes = legendre_butterflies_bytes();
+                if (TransParameters(config).export_legendre()) {
+                    ATLAS_ASSERT(not cache_.legendre());
+                    Log::debug() << "TransLocal: allocating LegendreCache: " << eckit::Bytes(bytes) << std::endl;
+                    export_legendre_ = LegendreCache(bytes);
+                    write_legendre_butterflies(
+                        const_cast<char*>(static_cast<const char*>(export_legendre_.legendre().data())));
+                }
+                std::string file_path = TransParameters(config).write_legendre();
+                if (file_path.size()) {
+                    ATLAS_TRACE("Write LegendreCache to file");
+                    Log::debug() << "Writing Legendre cache file ..." << std::endl;
+                    Log::debug() << "    path: " << file_path << std::endl;
+                    std::vector<char> buffer(bytes);
+                    write_legendre_butterflies(buffer.data());
+                    WriteCache legendre(file_path);
+                    legendre.write(buffer.data(), bytes);
+                    Log::debug() << "    size: " << eckit::Bytes(legendre.pos) << std::endl;
+                }
+            }
+            else if (legendre_cache_) {
                 ReadCache legendre(legendre_cache_);
                 legendre_sym_  = legendre.read<double>(size_sym);
                 legendre_asym_ = legendre.read<double>(size_asym);
@@ -726,7 +811,22 @@ TransLocal::TransLocal(const Cache& cache, const Grid& grid, const Domain& domai
     }
     else {
         // unstructured grid
-        if (unstruct_precomp_) {
+        if (TransParameters(config).auxiliary_grid()) {
+            ATLAS_TRACE("Auxiliary grid precomputations (unstructured)");
+            unstruct_precomp_ = false;
+            // winds are synthesised from spectra extended to truncation+1
+            auxiliary_grid_.reset(
+                new AuxiliaryGridInterpolation(truncation_ + 1, TransParameters(config).auxiliary_grid_tolerance()));
+            auxiliary_trans_.reset(new TransLocal(auxiliary_grid_->grid(), truncation_, config));
+            auxiliary_points_.reserve(grid_.size());
+            for (PointLonLat p : grid_.lonlat()) {
+                auxiliary_points_.emplace_back(p);
+            }
+            Log::debug() << "TransLocal: synthesis to unstructured grid via auxiliary grid "
+                         << auxiliary_grid_->grid().name() << " with interpolation kernel width "
+                         << auxiliary_grid_->width() << std::endl;
+        }
+        else if (unstruct_precomp_) {
             ATLAS_TRACE("Legendre precomputations (unstructured)");
 
             if (warning()) {
@@ -771,8 +871,11 @@ TransLocal::TransLocal(const Cache& cache, const Grid& grid, const long truncati
 // --------------------------------------------------------------------------------------------------------------------
 
 TransLocal::~TransLocal() {
+    if (distributed_) {
+        return;
+    }
     if (StructuredGrid(grid_) && not grid_.projection()) {
-        if (not legendre_cache_) {
+        if (not legendre_cache_ && not flt_) {
             free_aligned(legendre_sym_, "symmetric");
             free_aligned(legendre_asym_, "asymmetric");
         }
@@ -783,6 +886,7 @@ TransLocal::~TransLocal() {
             }
             fftw_free(fftw_->in);
             fftw_free(fftw_->out);
+            fftw_->clear_batch();
 #endif
         }
         else {
@@ -798,9 +902,147 @@ TransLocal::~TransLocal() {
 
 // --------------------------------------------------------------------------------------------------------------------
 
+void TransLocal::compute_legendre_butterflies(const double lats[], const double threshold) {
+    const int nb_zonal_wavenumbers = truncation_ + 1;
+    legendre_sym_butterfly_.resize(nb_zonal_wavenumbers);
+    legendre_asym_butterfly_.resize(nb_zonal_wavenumbers);
+    auto compress = [&](int jm, const double* legendre_sym, const double* legendre_asym) {
+        const size_t size_sym  = num_n(truncation_ + 1, jm, true);
+        const size_t size_asym = num_n(truncation_ + 1, jm, false);
+        legendre_sym_butterfly_[jm] = ButterflyMatrix(legendre_sym, size_sym, size_t(nlatsLeg_), threshold);
+        if (size_asym > 0) {
+            legendre_asym_butterfly_[jm] = ButterflyMatrix(legendre_asym, size_asym, size_t(nlatsLeg_), threshold);
+        }
+    };
+
+    if (legendre_cache_) {
+        // Compress the dense coefficients of the cache
+        ReadCache legendre(legendre_cache_);
+        legendre_sym_  = legendre.read<double>(legendre_sym_begin_.back());
+        legendre_asym_ = legendre.read<double>(legendre_asym_begin_.back());
+        ATLAS_ASSERT(legendre.pos == legendre_cachesize_);
+        atlas_omp_parallel_for(int jm = 0; jm < nb_zonal_wavenumbers; ++jm) {
+            compress(jm, legendre_sym_ + legendre_sym_begin_[jm], legendre_asym_ + legendre_asym_begin_[jm]);
+        }
+        return;
+    }
+
+    // Dense coefficients are computed for a range of zonal wavenumbers at a time, which bounds the memory footprint
+    // to a fraction of the uncompressed coefficients, at the cost of computing the Legendre polynomials repeatedly.
+    constexpr size_t nb_chunks = 8;
+    const size_t trc           = size_t(truncation_ + 1);
+    const size_t chunk_size =
+        (legendre_sym_begin_[nb_zonal_wavenumbers] + legendre_asym_begin_[nb_zonal_wavenumbers]) / nb_chunks + 1;
+    auto idxmn = [trc](size_t jm, size_t jn) { return (2 * trc + 3 - jm) * jm / 2 + jn - jm; };
+
+    for (int m_begin = 0, m_end = 0; m_begin < nb_zonal_wavenumbers; m_begin = m_end) {
+        while (m_end < nb_zonal_wavenumbers &&
+               (m_end == m_begin || legendre_sym_begin_[m_end + 1] - legendre_sym_begin_[m_begin] +
+                                            legendre_asym_begin_[m_end + 1] - legendre_asym_begin_[m_begin] <=
+                                        chunk_size)) {
+            ++m_end;
+        }
+        std::vector<double> legendre_sym(legendre_sym_begin_[m_end] - legendre_sym_begin_[m_begin]);
+        std::vector<double> legendre_asym(legendre_asym_begin_[m_end] - legendre_asym_begin_[m_begin]);
+        atlas_omp_parallel {
+            std::vector<double> legpol(legendre_size(trc));
+            std::vector<double> zfn((trc + 1) * (trc + 1));
+            compute_zfn(int(trc), zfn.data());
+            atlas_omp_for(idx_t jlat = 0; jlat < nlatsLeg_; ++jlat) {
+                compute_legendre_polynomials_lat(int(trc), lats[jlat], legpol.data(), zfn.data());
+                // same layout as compute_legendre_polynomials, with descending total wavenumbers
+                for (int jm = m_begin; jm < m_end; ++jm) {
+                    const size_t m         = size_t(jm);
+                    const size_t size_sym  = num_n(truncation_ + 1, jm, true);
+                    const size_t size_asym = num_n(truncation_ + 1, jm, false);
+                    size_t is = legendre_sym_begin_[jm] - legendre_sym_begin_[m_begin] + size_sym * size_t(jlat);
+                    size_t ia = legendre_asym_begin_[jm] - legendre_asym_begin_[m_begin] + size_asym * size_t(jlat);
+                    for (size_t jn = trc + 1; jn-- > m;) {
+                        if ((jn - m) % 2 == 0) {
+                            legendre_sym[is++] = legpol[idxmn(m, jn)];
+                        }
+                        else {
+                            legendre_asym[ia++] = legpol[idxmn(m, jn)];
+                        }
+                    }
+                }
+            }
+        }
+        atlas_omp_parallel_for(int jm = m_begin; jm < m_end; ++jm) {
+            compress(jm, legendre_sym.data() + legendre_sym_begin_[jm] - legendre_sym_begin_[m_begin],
+                     legendre_asym.data() + legendre_asym_begin_[jm] - legendre_asym_begin_[m_begin]);
+        }
+    }
+
+    size_t footprint = 0;
+    for (int jm = 0; jm < nb_zonal_wavenumbers; ++jm) {
+        footprint += legendre_sym_butterfly_[jm].footprint() + legendre_asym_butterfly_[jm].footprint();
+    }
+    const size_t dense = legendre_sym_begin_[nb_zonal_wavenumbers] + legendre_asym_begin_[nb_zonal_wavenumbers];
+    Log::debug() << "TransLocal: butterfly compressed Legendre coefficients: "
+                 << eckit::Bytes(sizeof(double) * footprint) << " instead of " << eckit::Bytes(sizeof(double) * dense)
+                 << std::endl;
+}
+
+size_t TransLocal::legendre_butterflies_bytes() const {
+    size_t bytes = sizeof(butterfly_cache_tag) + 2 * sizeof(size_t);
+    for (size_t jm = 0; jm < legendre_sym_butterfly_.size(); ++jm) {
+        bytes += legendre_sym_butterfly_[jm].bytes() + legendre_asym_butterfly_[jm].bytes();
+    }
+    return bytes;
+}
+
+void TransLocal::write_legendre_butterflies(char* buffer) const {
+    const size_t header[2] = {size_t(truncation_), size_t(nlatsLeg_)};
+    std::memcpy(buffer, butterfly_cache_tag, sizeof(butterfly_cache_tag));
+    std::memcpy(buffer + sizeof(butterfly_cache_tag), header, sizeof(header));
+    buffer += sizeof(butterfly_cache_tag) + sizeof(header);
+    for (size_t jm = 0; jm < legendre_sym_butterfly_.size(); ++jm) {
+        legendre_sym_butterfly_[jm].write(buffer);
+        legendre_asym_butterfly_[jm].write(buffer);
+    }
+}
+
+void TransLocal::read_legendre_butterflies(const void* cache, size_t size) {
+    const char* buffer = static_cast<const char*>(cache);
+    size_t header[2];
+    std::memcpy(header, buffer + sizeof(butterfly_cache_tag), sizeof(header));
+    if (header[0] != size_t(truncation_) || header[1] != size_t(nlatsLeg_)) {
+        std::stringstream err;
+        err << "Legendre cache with butterfly compressed coefficients was created for truncation " << header[0]
+            << " and " << header[1] << " latitudes per hemisphere, instead of truncation " << truncation_ << " and "
+            << nlatsLeg_ << " latitudes per hemisphere";
+        throw_Exception(err.str(), Here());
+    }
+    buffer += sizeof(butterfly_cache_tag) + sizeof(header);
+    legendre_sym_butterfly_.resize(truncation_ + 1);
+    legendre_asym_butterfly_.resize(truncation_ + 1);
+    for (int jm = 0; jm <= truncation_; ++jm) {
+        legendre_sym_butterfly_[jm]  = ButterflyMatrix::read(buffer);
+        legendre_asym_butterfly_[jm] = ButterflyMatrix::read(buffer);
+    }
+    ATLAS_ASSERT(size_t(buffer - static_cast<const char*>(cache)) == size);
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+
+size_t TransLocal::nb_spectral_coefficients() const {
+    if (distributed_) {
+        return distributed_->nb_spectral_coefficients();
+    }
+    return (truncation_ + 1) * (truncation_ + 2);
+}
+
+idx_t TransLocal::nb_gridpoints() const {
+    return distributed_ ? distributed_->nb_gridpoints() : grid_.size();
+}
+
 const functionspace::Spectral& TransLocal::spectral() const {
+    if (distributed_) {
+        return distributed_->spectral();
+    }
     if (not spectral_) {
-        spectral_ = functionspace::Spectral(Trans(this));
+        spectral_ = functionspace::Spectral(truncation_, util::Config("distribution", "serial"));
     }
     return spectral_;
 }
@@ -808,30 +1050,100 @@ const functionspace::Spectral& TransLocal::spectral() const {
 // --------------------------------------------------------------------------------------------------------------------
 
 void TransLocal::invtrans(const Field& spfield, Field& gpfield, const eckit::Configuration& config) const {
-    // VERY PRELIMINARY IMPLEMENTATION WITHOUT ANY GUARANTEES
-    int nb_scalar_fields = 1;
-    ATLAS_ASSERT(spfield.rank() == 1, "Only rank-1 fields supported at the moment");
-    ATLAS_ASSERT(gpfield.rank() == 1, "Only rank-1 fields supported at the moment");
-    const auto scalar_spectra = array::make_view<double, 1>(spfield);
-    auto gp_fields            = array::make_view<double, 1>(gpfield);
-
-    if (gp_fields.shape(0) < grid().size()) {
-        // Hopefully the halo (if present) is appended
-        ATLAS_DEBUG_VAR(gp_fields.shape(0));
-        ATLAS_DEBUG_VAR(grid().size());
-        ATLAS_ASSERT(gp_fields.shape(0) < grid().size());
-    }
-
-    invtrans(nb_scalar_fields, scalar_spectra.data(), gp_fields.data(), config);
+    FieldSet spfields;
+    spfields.add(spfield);
+    FieldSet gpfields;
+    gpfields.add(gpfield);
+    invtrans(spfields, gpfields, config);
 }
 
 // --------------------------------------------------------------------------------------------------------------------
 
+namespace {
+idx_t nb_levels(const Field& field) {
+    ATLAS_ASSERT(field.rank() == 1 || field.rank() == 2,
+                 "Only rank-1 fields, or rank-2 fields with levels as second dimension, are supported");
+    return field.rank() == 2 ? field.shape(1) : 1;
+}
+}  // namespace
+
 void TransLocal::invtrans(const FieldSet& spfields, FieldSet& gpfields, const eckit::Configuration& config) const {
-    // VERY PRELIMINARY IMPLEMENTATION WITHOUT ANY GUARANTEES
+    // All fields and levels are transformed together, i.e. with one Legendre GEMM per zonal wavenumber
+    // and one batched FFT, instead of one transform per field and level.
     ATLAS_ASSERT(spfields.size() == gpfields.size());
+    if (spfields.size() == 0) {
+        return;
+    }
+
+    const idx_t nb_coeffs = spfields[0].shape(0);
+    const idx_t nb_gp     = nb_gridpoints();
+    idx_t nb_fields       = 0;
     for (idx_t f = 0; f < spfields.size(); ++f) {
-        invtrans(spfields[f], gpfields[f], config);
+        ATLAS_ASSERT(spfields[f].shape(0) == nb_coeffs);
+        ATLAS_ASSERT(nb_levels(spfields[f]) == nb_levels(gpfields[f]));
+        // Hopefully the halo (if present) is appended
+        ATLAS_ASSERT(gpfields[f].shape(0) >= nb_gp);
+        nb_fields += nb_levels(spfields[f]);
+    }
+
+    // A single field without levels is already in the layout expected by the raw-array interface
+    if (spfields.size() == 1 && spfields[0].rank() == 1) {
+        const auto scalar_spectra = array::make_view<double, 1>(spfields[0]);
+        auto gp_fields            = array::make_view<double, 1>(gpfields[0]);
+        invtrans(1, scalar_spectra.data(), gp_fields.data(), config);
+        return;
+    }
+
+    // Spectral coefficients are interleaved (field index fastest), grid-point values are field-major
+    std::vector<double> scalar_spectra(nb_coeffs * nb_fields);
+    std::vector<double> gp_fields(nb_gp * nb_fields);
+
+    {
+        ATLAS_TRACE("pack spectral fields");
+        idx_t jfld0 = 0;
+        for (idx_t f = 0; f < spfields.size(); ++f) {
+            if (spfields[f].rank() == 1) {
+                const auto sp = array::make_view<double, 1>(spfields[f]);
+                atlas_omp_parallel_for (idx_t jc = 0; jc < nb_coeffs; ++jc) {
+                    scalar_spectra[jc * nb_fields + jfld0] = sp(jc);
+                }
+            }
+            else {
+                const auto sp    = array::make_view<double, 2>(spfields[f]);
+                const idx_t nlev = sp.shape(1);
+                atlas_omp_parallel_for (idx_t jc = 0; jc < nb_coeffs; ++jc) {
+                    for (idx_t jlev = 0; jlev < nlev; ++jlev) {
+                        scalar_spectra[jc * nb_fields + jfld0 + jlev] = sp(jc, jlev);
+                    }
+                }
+            }
+            jfld0 += nb_levels(spfields[f]);
+        }
+    }
+
+    invtrans(nb_fields, scalar_spectra.data(), gp_fields.data(), config);
+
+    {
+        ATLAS_TRACE("unpack grid-point fields");
+        idx_t jfld0 = 0;
+        for (idx_t f = 0; f < gpfields.size(); ++f) {
+            if (gpfields[f].rank() == 1) {
+                auto gp = array::make_view<double, 1>(gpfields[f]);
+                atlas_omp_parallel_for (idx_t jgp = 0; jgp < nb_gp; ++jgp) {
+                    gp(jgp) = gp_fields[jfld0 * nb_gp + jgp];
+                }
+            }
+            else {
+                auto gp          = array::make_view<double, 2>(gpfields[f]);
+                const idx_t nlev = gp.shape(1);
+                atlas_omp_parallel_for (idx_t jgp = 0; jgp < nb_gp; ++jgp) {
+                    for (idx_t jlev = 0; jlev < nlev; ++jlev) {
+                        gp(jgp, jlev) = gp_fields[(jfld0 + jlev) * nb_gp + jgp];
+                    }
+                }
+            }
+            jfld0 += nb_levels(gpfields[f]);
+        }
     }
 }
 
@@ -918,6 +1230,10 @@ void TransLocal::invtrans_vordiv2wind_adj(const Field& gpwind, Field& spvor, Fie
 
 void TransLocal::invtrans(const int nb_scalar_fields, const double scalar_spectra[], double gp_fields[],
                           const eckit::Configuration& config) const {
+    if (distributed_) {
+        distributed_->invtrans(nb_scalar_fields, scalar_spectra, gp_fields);
+        return;
+    }
     invtrans_uv(truncation_, nb_scalar_fields, 0, scalar_spectra, gp_fields, config);
 }
 
@@ -929,9 +1245,15 @@ void TransLocal::invtrans_legendre(const int truncation, const int nlats, const
                                    const eckit::Configuration&) const {
     // Legendre transform:
     {
-        Log::debug() << "TransLocal::invtrans_legendre: Legendre GEMM with \"" << detect_linalg_backend(linalg_backend_)
-                     << "\" using " << nlatsLegReduced_ - nlat0_[0] << " latitudes out of " << nlatsGlobal_ / 2
-                     << std::endl;
+        if (flt_) {
+            Log::debug() << "TransLocal::invtrans_legendre: Legendre butterfly using " << nlatsLegReduced_ - nlat0_[0]
+                         << " latitudes out of " << nlatsGlobal_ / 2 << std::endl;
+        }
+        else {
+            Log::debug() << "TransLocal::invtrans_legendre: Legendre GEMM with \""
+                         << detect_linalg_backend(linalg_backend_) << "\" using " << nlatsLegReduced_ - nlat0_[0]
+                         << " latitudes out of " << nlatsGlobal_ / 2 << std::endl;
+        }
         linalg::dense::Backend linalg_backend{linalg_backend_};
         ATLAS_TRACE("Inverse Legendre Transform (GEMM)");
         for (int jm = 0; jm <= truncation_; jm++) {
@@ -989,7 +1311,16 @@ void TransLocal::invtrans_legendre(const int truncation, const int nlats, const
                     ATLAS_ASSERT(size_t(ia) == n_imag * nb_fields * size_asym &&
                                  size_t(is) == n_imag * nb_fields * size_sym);
                 }
-                if (nlatsLegReduced_ - nlat0_[jm] > 0) {
+                if (nlatsLegReduced_ - nlat0_[jm] > 0 && flt_) {
+                    ATLAS_TRACE("butterfly multiply");
+                    legendre_sym_butterfly_[jm].multiply(scalar_sym, nb_fields * n_imag, scl_fourier_sym, nlat0_[jm],
+                                                         nlatsLegReduced_);
+                    if (size_asym > 0) {
+                        legendre_asym_butterfly_[jm].multiply(scalar_asym, nb_fields * n_imag, scl_fourier_asym,
+                                                              nlat0_[jm], nlatsLegReduced_);
+                    }
+                }
+                else if (nlatsLegReduced_ - nlat0_[jm] > 0) {
                     ATLAS_TRACE("matrix_multiply (" + std::string(linalg_backend) + ")");
                     {
                         linalg::Matrix A(scalar_sym, nb_fields * n_imag, size_sym);
@@ -1095,31 +1426,47 @@ void TransLocal::invtrans_fourier_regular(const int nlats, const int nlons, cons
             int num_complex = (nlonsMaxGlobal_ / 2) + 1;
             {
                 ATLAS_TRACE("Inverse Fourier Transform (FFTW, RegularGrid)");
-                for (int jfld = 0; jfld < nb_fields; jfld++) {
-                    int idx = 0;
-                    for (int jlat = 0; jlat < nlats; jlat++) {
-                        fftw_->in[idx++][0] = scl_fourier[posMethod(jfld, 0, jlat, 0, nb_fields, nlats)];
-                        for (int jm = 1; jm < num_complex; jm++, idx++) {
-                            for (int imag = 0; imag < 2; imag++) {
-                                if (jm <= truncation_) {
-                                    fftw_->in[idx][imag] =
-                                        scl_fourier[posMethod(jfld, imag, jlat, jm, nb_fields, nlats)];
-                                }
-                                else {
-                                    fftw_->in[idx][imag] = 0.;
-                                }
+                // All fields are transformed in a single execution of a plan over nb_fields * nlats latitudes
+                fftw_complex* in = fftw_->in;
+                double* out      = fftw_->out;
+                fftw_plan plan   = fftw_->plans[0];
+                if (nb_fields > 1) {
+                    if (fftw_->batch_nb_fields != nb_fields) {
+                        ATLAS_TRACE("FFTW planning");
+                        fftw_->reset_batch(nb_fields, size_t(nb_fields) * nlats * num_complex,
+                                           size_t(nb_fields) * nlats * nlonsMaxGlobal_, 1);
+                        fftw_->batch_plans[0] = fftw_plan_many_dft_c2r(
+                            1, &nlonsMaxGlobal_, nb_fields * nlats, fftw_->batch_in, nullptr, 1, num_complex,
+                            fftw_->batch_out, nullptr, 1, nlonsMaxGlobal_, FFTW_ESTIMATE);
+                    }
+                    in   = fftw_->batch_in;
+                    out  = fftw_->batch_out;
+                    plan = fftw_->batch_plans[0];
+                }
+                atlas_omp_parallel_for (int jfldlat = 0; jfldlat < nb_fields * nlats; jfldlat++) {
+                    const int jfld = jfldlat / nlats;
+                    const int jlat = jfldlat % nlats;
+                    int idx        = jfldlat * num_complex;
+                    in[idx++][0]   = scl_fourier[posMethod(jfld, 0, jlat, 0, nb_fields, nlats)];
+                    for (int jm = 1; jm < num_complex; jm++, idx++) {
+                        for (int imag = 0; imag < 2; imag++) {
+                            if (jm <= truncation_) {
+                                in[idx][imag] = scl_fourier[posMethod(jfld, imag, jlat, jm, nb_fields, nlats)];
+                            }
+                            else {
+                                in[idx][imag] = 0.;
                             }
                         }
                     }
-                    fftw_execute_dft_c2r(fftw_->plans[0], fftw_->in, fftw_->out);
-                    for (int jlat = 0; jlat < nlats; jlat++) {
-                        for (int jlon = 0; jlon < nlons; jlon++) {
-                            int j = jlon + jlonMin_[0];
-                            if (j >= nlonsMaxGlobal_) {
-                                j -= nlonsMaxGlobal_;
-                            }
-                            gp_fields[jlon + nlons * (jlat + nlats * jfld)] = fftw_->out[j + nlonsMaxGlobal_ * jlat];
+                }
+                fftw_execute_dft_c2r(plan, in, out);
+                atlas_omp_parallel_for (int jfldlat = 0; jfldlat < nb_fields * nlats; jfldlat++) {
+                    for (int jlon = 0; jlon < nlons; jlon++) {
+                        int j = jlon + jlonMin_[0];
+                        if (j >= nlonsMaxGlobal_) {
+                            j -= nlonsMaxGlobal_;
                         }
+                        gp_fields[jlon + nlons * jfldlat] = out[j + nlonsMaxGlobal_ * jfldlat];
                     }
                 }
             }
@@ -1182,44 +1529,64 @@ void TransLocal::invtrans_fourier_reduced(const int nlats, const StructuredGrid&
         {
             {
                 ATLAS_TRACE("Inverse Fourier Transform (FFTW, ReducedGrid)");
-                int jgp = 0;
-                for (int jfld = 0; jfld < nb_fields; jfld++) {
-                    for (int jlat = 0; jlat < nlats; jlat++) {
-                        int idx = 0;
-                        //Log::info() << jlat << "in:" << std::endl;
-                        int num_complex     = (nlonsGlobal_[jlat] / 2) + 1;
-                        fftw_->in[idx++][0] = scl_fourier[posMethod(jfld, 0, jlat, 0, nb_fields, nlats)];
-                        //Log::info() << fftw_->in[0][0] << " ";
+                // For every latitude, all fields are transformed in a single execution of a plan over nb_fields
+                const int num_complex_max = (nlonsMaxGlobal_ / 2) + 1;
+                if (nb_fields > 1 && fftw_->batch_nb_fields != nb_fields) {
+                    fftw_->reset_batch(nb_fields, size_t(nb_fields) * num_complex_max,
+                                       size_t(nb_fields) * nlonsMaxGlobal_, fftw_->plans.size());
+                }
+                std::vector<int> jgp_begin(nlats + 1, 0);
+                for (int jlat = 0; jlat < nlats; jlat++) {
+                    jgp_begin[jlat + 1] = jgp_begin[jlat] + g.nx(jlat);
+                }
+                const int nb_gp = jgp_begin[nlats];
+                for (int jlat = 0; jlat < nlats; jlat++) {
+                    int num_complex = (nlonsGlobal_[jlat] / 2) + 1;
+                    int jplan       = nlatsLegDomain_ - nlatsNH_ + jlat;
+                    if (jplan >= nlatsLegDomain_) {
+                        jplan = nlats - 1 + nlatsLegDomain_ - nlatsSH_ - jlat;
+                    };
+                    //ASSERT( jplan < nlatsLeg_ && jplan >= 0 );
+                    fftw_complex* in = fftw_->in;
+                    double* out      = fftw_->out;
+                    fftw_plan plan   = fftw_->plans[jplan];
+                    if (nb_fields > 1) {
+                        if (not fftw_->batch_plans[jplan]) {
+                            const int nlonsGlobalj = nlonsGlobal_[jlat];
+                            fftw_->batch_plans[jplan] =
+                                fftw_plan_many_dft_c2r(1, &nlonsGlobalj, nb_fields, fftw_->batch_in, nullptr, 1,
+                                                       num_complex_max, fftw_->batch_out, nullptr, 1,
+                                                       nlonsMaxGlobal_, FFTW_ESTIMATE);
+                        }
+                        in   = fftw_->batch_in;
+                        out  = fftw_->batch_out;
+                        plan = fftw_->batch_plans[jplan];
+                    }
+                    for (int jfld = 0; jfld < nb_fields; jfld++) {
+                        int idx      = jfld * num_complex_max;
+                        in[idx++][0] = scl_fourier[posMethod(jfld, 0, jlat, 0, nb_fields, nlats)];
                         for (int jm = 1; jm < num_complex; jm++, idx++) {
                             for (int imag = 0; imag < 2; imag++) {
                                 if (jm <= truncation_) {
-                                    fftw_->in[idx][imag] =
-                                        scl_fourier[posMethod(jfld, imag, jlat, jm, nb_fields, nlats)];
+                                    in[idx][imag] = scl_fourier[posMethod(jfld, imag, jlat, jm, nb_fields, nlats)];
                                 }
                                 else {
-                                    fftw_->in[idx][imag] = 0.;
+                                    in[idx][imag] = 0.;
                                 }
-                                //Log::info() << fftw_->in[idx][imag] << " ";
                             }
                         }
-                        //Log::info() << std::endl;
-                        //Log::info() << jlat << "out:" << std::endl;
-                        int jplan = nlatsLegDomain_ - nlatsNH_ + jlat;
-                        if (jplan >= nlatsLegDomain_) {
-                            jplan = nlats - 1 + nlatsLegDomain_ - nlatsSH_ - jlat;
-                        };
-                        //ASSERT( jplan < nlatsLeg_ && jplan >= 0 );
-                        fftw_execute_dft_c2r(fftw_->plans[jplan], fftw_->in, fftw_->out);
+                    }
+                    fftw_execute_dft_c2r(plan, in, out);
+                    for (int jfld = 0; jfld < nb_fields; jfld++) {
+                        int jgp = jgp_begin[jlat] + nb_gp * jfld;
                         for (int jlon = 0; jlon < g.nx(jlat); jlon++) {
                             int j = jlon + jlonMin_[jlat];
                             if (j >= nlonsGlobal_[jlat]) {
                                 j -= nlonsGlobal_[jlat];
                             }
-                            //Log::info() << fftw_->out[j] << " ";
                             ATLAS_ASSERT(j < nlonsMaxGlobal_);
-                            gp_fields[jgp++] = fftw_->out[j];
+                            gp_fields[jgp++] = out[j + nlonsMaxGlobal_ * jfld];
                         }
-                        //Log::info() << std::endl;
                     }
                 }
             }
@@ -1428,6 +1795,43 @@ void TransLocal::invtrans_unstructured(const int truncation, const int nb_fields
     free_aligned(zfn);
 }
 
+// --------------------------------------------------------------------------------------------------------------------
+
+void TransLocal::invtrans_unstructured_auxiliary(const int truncation, const int nb_fields, const int nb_vordiv_fields,
+                                                 const double scalar_spectra[], double gp_fields[],
+                                                 const eckit::Configuration& config) const {
+    ATLAS_TRACE("invtrans_unstructured_auxiliary");
+
+    // Deconvolve the interpolation kernel in longitude. Zonal wavenumbers beyond truncation_+1 are not resolved.
+    std::vector<double> spectra(size_t(nb_fields) * (truncation + 1) * (truncation + 2));
+    size_t idx = 0;
+    for (int m = 0; m <= truncation; ++m) {
+        const double factor = (m <= truncation_ + 1 ? auxiliary_grid_->zonal_deconvolution(m) : 0.);
+        for (size_t j = 0, size = size_t(2 * nb_fields) * size_t(truncation - m + 1); j < size; ++j, ++idx) {
+            spectra[idx] = factor * scalar_spectra[idx];
+        }
+    }
+
+    // Synthesis on the auxiliary grid, including the division of wind components by cos(latitude)
+    std::vector<double> gp_auxiliary(size_t(nb_fields) * size_t(auxiliary_grid_->grid().size()));
+    auxiliary_trans_->invtrans_uv(truncation, nb_fields, nb_vordiv_fields, spectra.data(), gp_auxiliary.data(),
+                                  config);
+
+    const int nb_wind_fields = std::min(2 * nb_vordiv_fields, nb_fields);
+    {
+        ATLAS_TRACE("deconvolve_meridional");
+        auxiliary_grid_->deconvolve_meridional(nb_fields, nb_wind_fields, gp_auxiliary.data());
+    }
+    {
+        ATLAS_TRACE("interpolate");
+        const idx_t nb_points = static_cast<idx_t>(auxiliary_points_.size());
+        atlas_omp_parallel_for(idx_t ip = 0; ip < nb_points; ++ip) {
+            auxiliary_grid_->interpolate(auxiliary_points_[ip], nb_fields, nb_wind_fields, gp_auxiliary.data(),
+                                         gp_fields + ip, size_t(nb_points));
+        }
+    }
+}
+
 //-----------------------------------------------------------------------------
 // Routine to compute the spectral transform by using a Local Fourier transformation
 // for a grid (same latitude for all longitudes, allows to compute Legendre functions
@@ -1508,7 +1912,11 @@ void TransLocal::invtrans_uv(const int truncation, const int nb_scalar_fields, c
             free_aligned(scl_fourier);
         }
         else {
-            if (unstruct_precomp_) {
+            if (auxiliary_grid_) {
+                invtrans_unstructured_auxiliary(truncation, nb_scalar_fields, nb_vordiv_fields, scalar_spectra,
+                                                gp_fields, config);
+            }
+            else if (unstruct_precomp_) {
                 invtrans_unstructured_precomp(truncation, nb_scalar_fields, nb_vordiv_fields, scalar_spectra, gp_fields,
                                               config);
             }
@@ -1554,6 +1962,14 @@ void extend_truncation(const int old_truncation, const int nb_fields, const doub
 void TransLocal::invtrans(const int nb_scalar_fields, const double scalar_spectra[], const int nb_vordiv_fields,
                           const double vorticity_spectra[], const double divergence_spectra[], double gp_fields[],
                           const eckit::Configuration& config) const {
+    if (distributed_) {
+        if (nb_vordiv_fields > 0) {
+            throw_NotImplemented("Transforms of vorticity and divergence with TransLocal on more than 1 MPI task",
+                                 Here());
+        }
+        invtrans(nb_scalar_fields, scalar_spectra, gp_fields, config);
+        return;
+    }
     int nb_gp = grid_.size();
     if (nb_vordiv_fields > 0) {
         // collect all spectral data into one array "all_spectra":
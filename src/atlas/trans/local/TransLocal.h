@@ -18,6 +18,8 @@
 #include "atlas/grid/Grid.h"
 #include "atlas/linalg/dense/Backend.h"
 #include "atlas/trans/detail/TransImpl.h"
+#include "atlas/trans/local/AuxiliaryGridInterpolation.h"
+#include "atlas/trans/local/ButterflyMatrix.h"
 
 #define TRANSLOCAL_DGEMM2 0
 
@@ -40,6 +42,7 @@ struct FFTW_Data;
 }
 
 class LegendreCacheCreatorLocal;
+class TransLocalDistributed;
 int fourier_truncation(const int truncation,  // truncation
                        const int nx,          // number of longitudes
                        const int nxmax,       // maximum nx
@@ -62,6 +65,21 @@ int fourier_truncation(const int truncation,  // truncation
 /// @note: Direct transforms are not implemented and cannot be unless
 ///        the grid is global. There are no plans to support this at the moment.
 ///
+/// @note: With more than 1 MPI task, only global structured grids are supported, and data is distributed
+///        (see TransLocalDistributed). Spectral fields are distributed per zonal wavenumber, as in spectral().
+///        Grid-point fields contain the points of this task in grid order, as partitioned with the
+///        "partitioner" option (default "equal_bands"). Only inverse transforms of scalar fields are supported.
+///
+/// @note: With option "flt" (fast Legendre transform), the Legendre coefficients of structured grids are compressed
+///        as butterfly matrices (see ButterflyMatrix), reducing memory and operations from O(T^3) to O(T^2 log T),
+///        with a relative accuracy of about "flt_threshold" (default 1.e-10). This only pays off for high truncations.
+///        Legendre caches then contain the compressed coefficients.
+///
+/// @note: With option "auxiliary_grid", transforms to unstructured grids (or grids with projections) synthesise the
+///        fields on an oversampled regular grid with the structured algorithm, followed by local interpolation with a
+///        relative accuracy of about "auxiliary_grid_tolerance" (default 1.e-10), see AuxiliaryGridInterpolation.
+///        This is much faster than the direct evaluation for large numbers of points.
+///
 /// @note: The matrix_multiply (GEMM) implementation can be configured within the Configuration argument in the constructor
 ///        using "matrix_multiply" key or if not given, it will use the atlas::linalg::dense::current_backend(),
 ///        evaluated at invocation time. To reset the current_backend at any time:
@@ -85,7 +103,7 @@ public:
 
     virtual int truncation() const override { return truncation_; }
 
-    virtual size_t nb_spectral_coefficients() const override { return (truncation_ + 1) * (truncation_ + 2); }
+    virtual size_t nb_spectral_coefficients() const override;
     virtual size_t nb_spectral_coefficients_global() const override { return (truncation_ + 1) * (truncation_ + 2); }
 
     virtual const Grid& grid() const override { return grid_; }
@@ -199,12 +217,26 @@ private:
                                const double scalar_spectra[], double gp_fields[],
                                const eckit::Configuration& config) const;
 
+    void invtrans_unstructured_auxiliary(const int truncation, const int nb_fields, const int nb_vordiv_fields,
+                                         const double scalar_spectra[], double gp_fields[],
+                                         const eckit::Configuration& config) const;
+
     void invtrans_uv(const int truncation, const int nb_scalar_fields, const int nb_vordiv_fields,
                      const double scalar_spectra[], double gp_fields[],
                      const eckit::Configuration& = util::NoConfig()) const;
 
     bool warning(const eckit::Configuration& = util::NoConfig()) const;
 
+    idx_t nb_gridpoints() const;
+
+    void compute_legendre_butterflies(const double lats[], const double threshold);
+
+    size_t legendre_butterflies_bytes() const;
+
+    void write_legendre_butterflies(char* buffer) const;
+
+    void read_legendre_butterflies(const void* cache, size_t size);
+
     friend class LegendreCacheCreatorLocal;
 
 private:
@@ -237,6 +269,9 @@ private:
     std::vector<size_t> legendre_begin_;
     std::vector<size_t> legendre_sym_begin_;
     std::vector<size_t> legendre_asym_begin_;
+    bool flt_{false};
+    std::vector<ButterflyMatrix> legendre_sym_butterfly_;
+    std::vector<ButterflyMatrix> legendre_asym_butterfly_;
 
     Cache cache_;
     Cache export_legendre_;
@@ -247,6 +282,12 @@ private:
 
     std::unique_ptr<detail::FFTW_Data> fftw_;
 
+    std::unique_ptr<TransLocalDistributed> distributed_;
+
+    std::unique_ptr<AuxiliaryGridInterpolation> auxiliary_grid_;
+    std::unique_ptr<TransLocal> auxiliary_trans_;
+    std::vector<PointLonLat> auxiliary_points_;
+
     std::string linalg_backend_;
     int warning_ = 0;
 };
@@ -0,0 +1,476 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#include "atlas/trans/local/TransLocalDistributed.h"
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+
+#include "eckit/log/Bytes.h"
+#include "eckit/types/FloatCompare.h"
+
+#include "atlas/grid/Partitioner.h"
+#include "atlas/library/defines.h"
+#include "atlas/linalg/dense.h"
+#include "atlas/parallel/mpi/Statistics.h"
+#include "atlas/parallel/mpi/mpi.h"
+#include "atlas/parallel/omp/omp.h"
+#include "atlas/runtime/Exception.h"
+#include "atlas/runtime/Log.h"
+#include "atlas/runtime/Trace.h"
+#include "atlas/trans/local/LegendrePolynomials.h"
+#include "atlas/trans/local/TransLocal.h"
+#include "atlas/util/Config.h"
+#include "atlas/util/Constants.h"
+
+#if ATLAS_HAVE_FFTW
+#include "fftw3.h"
+#endif
+
+namespace atlas {
+namespace trans {
+
+namespace {
+
+// Same treatment of latitudes at the poles as in TransLocal
+constexpr double latPole = 89.9999999;
+
+size_t num_n(const int truncation, const int m, const bool symmetric) {
+    int len = (truncation - m + (symmetric ? 2 : 1)) / 2;
+    ATLAS_ASSERT(len >= 0);
+    return size_t(len);
+}
+
+std::vector<int> displacements(const std::vector<int>& counts) {
+    std::vector<int> displs(counts.size(), 0);
+    for (size_t p = 1; p < counts.size(); ++p) {
+        displs[p] = displs[p - 1] + counts[p - 1];
+    }
+    return displs;
+}
+
+}  // namespace
+
+//-----------------------------------------------------------------------------
+
+TransLocalDistributed::TransLocalDistributed(const StructuredGrid& grid, int truncation, bool fft,
+                                             const std::string& linalg_backend, const eckit::Configuration& config):
+    grid_(grid),
+    truncation_(truncation),
+    fft_(fft),
+    linalg_backend_(linalg_backend),
+    spectral_(truncation, util::Config("distribution", "mpi")),
+    distribution_(grid, grid::Partitioner(config.getString("partitioner", "equal_bands"))) {
+    ATLAS_TRACE("TransLocalDistributed constructor");
+
+    const int nb_parts = static_cast<int>(mpi::size());
+    const int part     = static_cast<int>(mpi::rank());
+
+    nlats_      = grid_.ny();
+    nlats_half_ = (nlats_ + 1) / 2;
+    for (idx_t jlat = 0; jlat < nlats_half_; ++jlat) {
+        if (not eckit::types::is_approximately_equal(grid_.y(jlat), -grid_.y(nlats_ - 1 - jlat), 1.e-10)) {
+            throw_NotImplemented("Distributed TransLocal requires latitudes symmetric about the equator", Here());
+        }
+    }
+#if ATLAS_HAVE_FFTW
+    // The FFT requires equidistant longitudes over the full circle, possibly shifted
+    for (idx_t jlat = 0; jlat < nlats_ && fft_; ++jlat) {
+        const idx_t nx  = grid_.nx(jlat);
+        const double dx = (nx > 1 ? grid_.x(1, jlat) - grid_.x(0, jlat) : 360.);
+        if (not eckit::types::is_approximately_equal(dx, 360. / nx, 1.e-10)) {
+            fft_ = false;
+        }
+    }
+#else
+    fft_ = false;
+#endif
+
+    // Zonal wavenumbers of this task and of all tasks
+    {
+        const auto zonal_wavenumbers = spectral_.zonal_wavenumbers();
+        idx_t offset                 = 0;
+        for (idx_t jm = 0; jm < zonal_wavenumbers.size(); ++jm) {
+            const int m = zonal_wavenumbers(jm);
+            zonal_wavenumbers_.emplace_back(m);
+            spectral_begin_.emplace_back(offset);
+            offset += 2 * (truncation_ + 1 - m);
+        }
+        ATLAS_ASSERT(offset == spectral_.nb_spectral_coefficients());
+
+        eckit::mpi::Buffer<int> recv(nb_parts);
+        ATLAS_TRACE_MPI(ALLGATHER) {
+            mpi::comm().allGatherv(zonal_wavenumbers_.begin(), zonal_wavenumbers_.end(), recv);
+        }
+        part_zonal_wavenumbers_.assign(recv.buffer.begin(), recv.buffer.end());
+        part_zonal_wavenumbers_begin_.resize(nb_parts + 1);
+        for (int p = 0; p < nb_parts; ++p) {
+            part_zonal_wavenumbers_begin_[p] = recv.displs[p];
+        }
+        part_zonal_wavenumbers_begin_[nb_parts] = static_cast<idx_t>(part_zonal_wavenumbers_.size());
+    }
+
+    // Latitudes containing grid points of every task, and grid points of this task
+    {
+        std::vector<std::vector<idx_t>> lats(nb_parts);
+        std::vector<idx_t> last_lat(nb_parts, -1);
+        lons_begin_.emplace_back(0);
+        gidx_t n = 0;
+        for (idx_t jlat = 0; jlat < nlats_; ++jlat) {
+            for (idx_t jlon = 0; jlon < grid_.nx(jlat); ++jlon, ++n) {
+                const int p = distribution_.partition(n);
+                if (last_lat[p] != jlat) {
+                    lats[p].emplace_back(jlat);
+                    last_lat[p] = jlat;
+                }
+                if (p == part) {
+                    lons_.emplace_back(jlon);
+                }
+            }
+            if (last_lat[part] == jlat) {
+                lons_begin_.emplace_back(static_cast<idx_t>(lons_.size()));
+            }
+        }
+        nb_gridpoints_ = static_cast<idx_t>(lons_.size());
+
+        part_lats_begin_.resize(nb_parts + 1, 0);
+        for (int p = 0; p < nb_parts; ++p) {
+            part_lats_begin_[p + 1] = part_lats_begin_[p] + static_cast<idx_t>(lats[p].size());
+            part_lats_.insert(part_lats_.end(), lats[p].begin(), lats[p].end());
+        }
+    }
+
+    // Reduced truncation towards the poles: zonal wavenumber m only contributes from latitude nlat0[m]
+    std::vector<idx_t> nlat0(truncation_ + 1, nlats_half_);
+    {
+        int nmen0 = -1;
+        for (idx_t jlat = 0; jlat < nlats_ / 2; ++jlat) {
+            const double lat = grid_.y(jlat) * util::Constants::degreesToRadians();
+            int nmen = fourier_truncation(truncation_, grid_.nx(jlat), grid_.nxmax(), nlats_, lat, RegularGrid(grid_));
+            nmen     = std::max(nmen0, nmen);
+            for (int m = nmen0 + 1; m <= nmen; ++m) {
+                nlat0[m] = jlat;
+            }
+            nmen0 = nmen;
+        }
+    }
+
+    // Associated Legendre functions for the zonal wavenumbers of this task
+    {
+        const idx_t nb_zonal_wavenumbers = static_cast<idx_t>(zonal_wavenumbers_.size());
+        jlat_begin_.resize(nb_zonal_wavenumbers);
+        legendre_sym_begin_.resize(nb_zonal_wavenumbers + 1, 0);
+        legendre_asym_begin_.resize(nb_zonal_wavenumbers + 1, 0);
+        for (idx_t jm = 0; jm < nb_zonal_wavenumbers; ++jm) {
+            const int m                  = zonal_wavenumbers_[jm];
+            jlat_begin_[jm]              = nlat0[m];
+            const auto nl                = size_t(nlats_half_ - jlat_begin_[jm]);
+            legendre_sym_begin_[jm + 1]  = legendre_sym_begin_[jm] + num_n(truncation_, m, true) * nl;
+            legendre_asym_begin_[jm + 1] = legendre_asym_begin_[jm] + num_n(truncation_, m, false) * nl;
+        }
+        Log::debug() << "TransLocalDistributed: allocating Legendre coefficients: "
+                     << eckit::Bytes(sizeof(double) *
+                                     (legendre_sym_begin_.back() + legendre_asym_begin_.back()))
+                     << std::endl;
+        legendre_sym_.resize(legendre_sym_begin_.back());
+        legendre_asym_.resize(legendre_asym_begin_.back());
+
+        std::vector<double> lats(nlats_half_);
+        for (idx_t jlat = 0; jlat < nlats_half_; ++jlat) {
+            const double lat = std::max(-latPole, std::min(latPole, grid_.y(jlat)));
+            lats[jlat]       = lat * util::Constants::degreesToRadians();
+        }
+
+        ATLAS_TRACE("Legendre precomputations (distributed)");
+        const size_t trc = size_t(truncation_);
+        auto idxmn       = [trc](size_t jm, size_t jn) { return (2 * trc + 3 - jm) * jm / 2 + jn - jm; };
+        atlas_omp_parallel {
+            std::vector<double> legpol((trc + 2) * (trc + 1) / 2);
+            std::vector<double> zfn((trc + 1) * (trc + 1));
+            compute_zfn(truncation_, zfn.data());
+            atlas_omp_for(idx_t jlat = 0; jlat < nlats_half_; ++jlat) {
+                compute_legendre_polynomials_lat(truncation_, lats[jlat], legpol.data(), zfn.data());
+                for (idx_t jm = 0; jm < nb_zonal_wavenumbers; ++jm) {
+                    if (jlat < jlat_begin_[jm]) {
+                        continue;
+                    }
+                    const size_t m  = size_t(zonal_wavenumbers_[jm]);
+                    const size_t jl = size_t(jlat - jlat_begin_[jm]);
+                    size_t is       = legendre_sym_begin_[jm] + num_n(truncation_, m, true) * jl;
+                    size_t ia       = legendre_asym_begin_[jm] + num_n(truncation_, m, false) * jl;
+                    // descending order of total wavenumbers, as in TransLocal
+                    for (size_t jn = trc + 1; jn-- > m;) {
+                        if ((jn - m) % 2 == 0) {
+                            legendre_sym_[is++] = legpol[idxmn(m, jn)];
+                        }
+                        else {
+                            legendre_asym_[ia++] = legpol[idxmn(m, jn)];
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    Log::debug() << "TransLocalDistributed set up with:\n"
+                 << " - grid: " << grid_.name() << '\n'
+                 << " - truncation: " << truncation_ << '\n'
+                 << " - partitioner: " << distribution_.type() << '\n'
+                 << " - zonal wavenumbers: " << zonal_wavenumbers_.size() << '\n'
+                 << " - latitudes: " << lons_begin_.size() - 1 << '\n'
+                 << " - grid points: " << nb_gridpoints_ << '\n'
+                 << " - fft: " << std::boolalpha << fft_ << std::endl;
+}
+
+TransLocalDistributed::~TransLocalDistributed() = default;
+
+//-----------------------------------------------------------------------------
+
+void TransLocalDistributed::invtrans(const int nb_fields, const double scalar_spectra[], double gp_fields[]) const {
+    ATLAS_TRACE("TransLocalDistributed::invtrans");
+
+    // Fourier coefficients of the zonal wavenumbers of this task, for all latitudes: [jlat][jm][imag][jfld]
+    std::vector<double> fourier(size_t(nlats_) * zonal_wavenumbers_.size() * 2 * nb_fields, 0.);
+    invtrans_legendre(nb_fields, scalar_spectra, fourier.data());
+
+    // Fourier coefficients of all zonal wavenumbers, for the latitudes of this task: [jlat][m][imag][jfld]
+    std::vector<double> fourier_lats;
+    transpose(nb_fields, fourier.data(), fourier_lats);
+    fourier.clear();
+    fourier.shrink_to_fit();
+
+    invtrans_fourier(nb_fields, fourier_lats.data(), gp_fields);
+}
+
+//-----------------------------------------------------------------------------
+
+void TransLocalDistributed::invtrans_legendre(const int nb_fields, const double scalar_spectra[],
+                                              double fourier[]) const {
+    ATLAS_TRACE("Inverse Legendre Transform (distributed)");
+    linalg::dense::Backend linalg_backend{linalg_backend_};
+
+    const idx_t nb_zonal_wavenumbers = static_cast<idx_t>(zonal_wavenumbers_.size());
+    const size_t block               = 2 * size_t(nb_fields);
+    for (idx_t jm = 0; jm < nb_zonal_wavenumbers; ++jm) {
+        const int m    = zonal_wavenumbers_[jm];
+        const idx_t nl = nlats_half_ - jlat_begin_[jm];
+        if (nl <= 0) {
+            continue;
+        }
+        const size_t size_sym  = num_n(truncation_, m, true);
+        const size_t size_asym = num_n(truncation_, m, false);
+
+        std::vector<double> scalar_sym(block * size_sym);
+        std::vector<double> scalar_asym(block * size_asym);
+        std::vector<double> fourier_sym(block * nl);
+        std::vector<double> fourier_asym(block * nl, 0.);
+        {
+            size_t is = 0;
+            size_t ia = 0;
+            for (int jn = truncation_; jn >= m; --jn) {
+                const double* spectra = scalar_spectra + (spectral_begin_[jm] + 2 * (jn - m)) * nb_fields;
+                if ((jn - m) % 2 == 0) {
+                    std::copy_n(spectra, block, scalar_sym.data() + is);
+                    is += block;
+                }
+                else {
+                    std::copy_n(spectra, block, scalar_asym.data() + ia);
+                    ia += block;
+                }
+            }
+            ATLAS_ASSERT(is == scalar_sym.size() && ia == scalar_asym.size());
+        }
+        {
+            linalg::Matrix A(scalar_sym.data(), block, size_sym);
+            linalg::Matrix B(const_cast<double*>(legendre_sym_.data()) + legendre_sym_begin_[jm], size_sym, nl);
+            linalg::Matrix C(fourier_sym.data(), block, nl);
+            linalg::matrix_multiply(A, B, C, linalg_backend);
+        }
+        if (size_asym > 0) {
+            linalg::Matrix A(scalar_asym.data(), block, size_asym);
+            linalg::Matrix B(const_cast<double*>(legendre_asym_.data()) + legendre_asym_begin_[jm], size_asym, nl);
+            linalg::Matrix C(fourier_asym.data(), block, nl);
+            linalg::matrix_multiply(A, B, C, linalg_backend);
+        }
+
+        // merge hemispheres
+        for (idx_t jl = 0; jl < nl; ++jl) {
+            const idx_t jlat_north = jlat_begin_[jm] + jl;
+            const idx_t jlat_south = nlats_ - 1 - jlat_north;
+            const double* sym      = fourier_sym.data() + jl * block;
+            const double* asym     = fourier_asym.data() + jl * block;
+            double* north          = fourier + (jlat_north * nb_zonal_wavenumbers + jm) * block;
+            double* south          = fourier + (jlat_south * nb_zonal_wavenumbers + jm) * block;
+            for (size_t j = 0; j < block; ++j) {
+                north[j] = sym[j] + asym[j];
+            }
+            if (jlat_south != jlat_north) {
+                for (size_t j = 0; j < block; ++j) {
+                    south[j] = sym[j] - asym[j];
+                }
+            }
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void TransLocalDistributed::transpose(const int nb_fields, const double fourier[],
+                                      std::vector<double>& fourier_lats) const {
+    ATLAS_TRACE("Transposition Legendre to Fourier (distributed)");
+    const int nb_parts               = static_cast<int>(mpi::size());
+    const int part                   = static_cast<int>(mpi::rank());
+    const idx_t nb_zonal_wavenumbers = static_cast<idx_t>(zonal_wavenumbers_.size());
+    const idx_t nb_lats              = part_lats_begin_[part + 1] - part_lats_begin_[part];
+    const size_t block               = 2 * size_t(nb_fields);
+
+    std::vector<int> send_counts(nb_parts);
+    std::vector<int> recv_counts(nb_parts);
+    for (int p = 0; p < nb_parts; ++p) {
+        const idx_t nb_lats_p              = part_lats_begin_[p + 1] - part_lats_begin_[p];
+        const idx_t nb_zonal_wavenumbers_p = part_zonal_wavenumbers_begin_[p + 1] - part_zonal_wavenumbers_begin_[p];
+        send_counts[p]                     = static_cast<int>(nb_lats_p * nb_zonal_wavenumbers * block);
+        recv_counts[p]                     = static_cast<int>(nb_lats * nb_zonal_wavenumbers_p * block);
+    }
+    const std::vector<int> send_displs = displacements(send_counts);
+    const std::vector<int> recv_displs = displacements(recv_counts);
+
+    // Send, for every latitude of task p, the Fourier coefficients of all zonal wavenumbers of this task
+    std::vector<double> send_buffer(size_t(send_displs.back()) + send_counts.back());
+    std::vector<double> recv_buffer(size_t(recv_displs.back()) + recv_counts.back());
+    const size_t lat_block = nb_zonal_wavenumbers * block;
+    atlas_omp_parallel_for(idx_t j = 0; j < part_lats_begin_[nb_parts]; ++j) {
+        std::copy_n(fourier + part_lats_[j] * lat_block, lat_block, send_buffer.data() + j * lat_block);
+    }
+
+    ATLAS_TRACE_MPI(ALLTOALL) {
+        mpi::comm().allToAllv(send_buffer.data(), send_counts.data(), send_displs.data(), recv_buffer.data(),
+                              recv_counts.data(), recv_displs.data());
+    }
+
+    // Reorder received data by latitude and zonal wavenumber
+    fourier_lats.assign(size_t(nb_lats) * (truncation_ + 1) * block, 0.);
+    for (int p = 0; p < nb_parts; ++p) {
+        const idx_t begin_p                = part_zonal_wavenumbers_begin_[p];
+        const idx_t nb_zonal_wavenumbers_p = part_zonal_wavenumbers_begin_[p + 1] - begin_p;
+        atlas_omp_parallel_for(idx_t jlat = 0; jlat < nb_lats; ++jlat) {
+            for (idx_t jm = 0; jm < nb_zonal_wavenumbers_p; ++jm) {
+                const int m = part_zonal_wavenumbers_[begin_p + jm];
+                std::copy_n(recv_buffer.data() + recv_displs[p] + (jlat * nb_zonal_wavenumbers_p + jm) * block, block,
+                            fourier_lats.data() + (jlat * (truncation_ + 1) + m) * block);
+            }
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void TransLocalDistributed::invtrans_fourier(const int nb_fields, const double fourier_lats[],
+                                             double gp_fields[]) const {
+    const int part       = static_cast<int>(mpi::rank());
+    const idx_t nb_lats  = part_lats_begin_[part + 1] - part_lats_begin_[part];
+    const idx_t* lats    = part_lats_.data() + part_lats_begin_[part];
+    const size_t block   = 2 * size_t(nb_fields);
+    const size_t nb_gp   = size_t(nb_gridpoints_);
+    const double deg2rad = util::Constants::degreesToRadians();
+
+    if (fft_) {
+#if ATLAS_HAVE_FFTW
+        ATLAS_TRACE("Inverse Fourier Transform (FFTW, distributed)");
+        // One plan per number of longitudes, transforming all fields in one execution
+        std::map<int, fftw_plan> plans;
+        int nx_max = 0;
+        for (idx_t jlat = 0; jlat < nb_lats; ++jlat) {
+            nx_max = std::max<int>(nx_max, grid_.nx(lats[jlat]));
+        }
+        const int nc_max = nx_max / 2 + 1;
+        {
+            fftw_complex* in = fftw_alloc_complex(size_t(nb_fields) * nc_max);
+            double* out      = fftw_alloc_real(size_t(nb_fields) * nx_max);
+            for (idx_t jlat = 0; jlat < nb_lats; ++jlat) {
+                int nx = static_cast<int>(grid_.nx(lats[jlat]));
+                if (plans.find(nx) == plans.end()) {
+                    const int nc = nx / 2 + 1;
+                    plans[nx]    = fftw_plan_many_dft_c2r(1, &nx, nb_fields, in, nullptr, 1, nc, out, nullptr, 1, nx,
+                                                          FFTW_ESTIMATE);
+                }
+            }
+            fftw_free(in);
+            fftw_free(out);
+        }
+
+        atlas_omp_parallel {
+            fftw_complex* in = fftw_alloc_complex(size_t(nb_fields) * nc_max);
+            double* out      = fftw_alloc_real(size_t(nb_fields) * nx_max);
+            atlas_omp_for(idx_t jlat = 0; jlat < nb_lats; ++jlat) {
+                const idx_t j     = lats[jlat];
+                const int nx      = static_cast<int>(grid_.nx(j));
+                const int nc      = nx / 2 + 1;
+                const int mmax    = std::min(truncation_, nx / 2);
+                const double lon0 = grid_.x(0, j) * deg2rad;
+                std::fill_n(&in[0][0], 2 * size_t(nb_fields) * nc, 0.);
+                for (int m = 0; m <= mmax; ++m) {
+                    // shift from the first longitude of this latitude
+                    const double cosm     = std::cos(m * lon0);
+                    const double sinm     = std::sin(m * lon0);
+                    const double* fourier = fourier_lats + (jlat * (truncation_ + 1) + m) * block;
+                    for (int jfld = 0; jfld < nb_fields; ++jfld) {
+                        const double re      = fourier[jfld];
+                        const double im      = fourier[nb_fields + jfld];
+                        in[jfld * nc + m][0] = re * cosm - im * sinm;
+                        in[jfld * nc + m][1] = re * sinm + im * cosm;
+                    }
+                }
+                fftw_execute_dft_c2r(plans.at(nx), in, out);
+                for (idx_t jgp = lons_begin_[jlat]; jgp < lons_begin_[jlat + 1]; ++jgp) {
+                    const idx_t jlon = lons_[jgp];
+                    for (int jfld = 0; jfld < nb_fields; ++jfld) {
+                        gp_fields[jfld * nb_gp + jgp] = out[jfld * nx + jlon];
+                    }
+                }
+            }
+            fftw_free(in);
+            fftw_free(out);
+        }
+        for (auto& plan : plans) {
+            fftw_destroy_plan(plan.second);
+        }
+#endif
+    }
+    else {
+        ATLAS_TRACE("Inverse Fourier Transform (NoFFT, distributed)");
+        atlas_omp_parallel_for(idx_t jlat = 0; jlat < nb_lats; ++jlat) {
+            const idx_t j  = lats[jlat];
+            const int nx   = static_cast<int>(grid_.nx(j));
+            const int mmax = std::min(truncation_, nx / 2);
+            for (idx_t jgp = lons_begin_[jlat]; jgp < lons_begin_[jlat + 1]; ++jgp) {
+                const double lon = grid_.x(lons_[jgp], j) * deg2rad;
+                for (int jfld = 0; jfld < nb_fields; ++jfld) {
+                    gp_fields[jfld * nb_gp + jgp] = 0.;
+                }
+                for (int m = 0; m <= mmax; ++m) {
+                    const double factor   = (m == 0 || 2 * m == nx) ? 1. : 2.;
+                    const double cosm     = factor * std::cos(m * lon);
+                    const double sinm     = factor * std::sin(m * lon);
+                    const double* fourier = fourier_lats + (jlat * (truncation_ + 1) + m) * block;
+                    for (int jfld = 0; jfld < nb_fields; ++jfld) {
+                        gp_fields[jfld * nb_gp + jgp] += fourier[jfld] * cosm - fourier[nb_fields + jfld] * sinm;
+                    }
+                }
+            }
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+}  // namespace trans
+}  // namespace atlas
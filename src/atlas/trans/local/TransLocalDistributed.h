@@ -0,0 +1,107 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "atlas/functionspace/Spectral.h"
+#include "atlas/grid/Distribution.h"
+#include "atlas/grid/StructuredGrid.h"
+#include "atlas/library/config.h"
+
+namespace eckit {
+class Configuration;
+}
+
+namespace atlas {
+namespace trans {
+
+//-----------------------------------------------------------------------------
+
+/// @brief Inverse spectral transform of TransLocal with data distributed over MPI tasks
+///
+/// Spectral data is distributed per zonal wavenumber, as in functionspace::Spectral with distribution "mpi".
+/// Grid-point data is distributed with a grid::Partitioner (option "partitioner", default "equal_bands"),
+/// and contains the grid points of this task in the order of the grid.
+///
+/// Each task computes the Legendre transform of its zonal wavenumbers for all latitudes. A single all-to-all
+/// exchange then transposes the Fourier coefficients, so that each task holds all zonal wavenumbers of the
+/// latitudes containing its grid points, followed by the Fourier transform of these latitudes.
+class TransLocalDistributed {
+public:
+    TransLocalDistributed(const StructuredGrid&, int truncation, bool fft, const std::string& linalg_backend,
+                          const eckit::Configuration&);
+
+    ~TransLocalDistributed();
+
+    const functionspace::Spectral& spectral() const { return spectral_; }
+
+    const grid::Distribution& distribution() const { return distribution_; }
+
+    /// Number of spectral coefficients of this task
+    idx_t nb_spectral_coefficients() const { return spectral_.nb_spectral_coefficients(); }
+
+    /// Number of grid points of this task
+    idx_t nb_gridpoints() const { return nb_gridpoints_; }
+
+    /// Inverse transform of nb_fields scalar fields
+    /// @param scalar_spectra  [nb_spectral_coefficients][nb_fields]
+    /// @param gp_fields       [nb_fields][nb_gridpoints]
+    void invtrans(const int nb_fields, const double scalar_spectra[], double gp_fields[]) const;
+
+private:
+    void invtrans_legendre(const int nb_fields, const double scalar_spectra[], double fourier[]) const;
+
+    void transpose(const int nb_fields, const double fourier[], std::vector<double>& fourier_lats) const;
+
+    void invtrans_fourier(const int nb_fields, const double fourier_lats[], double gp_fields[]) const;
+
+private:
+    StructuredGrid grid_;
+    int truncation_;
+    bool fft_;
+    std::string linalg_backend_;
+    functionspace::Spectral spectral_;
+    grid::Distribution distribution_;
+
+    idx_t nlats_;       // number of latitudes
+    idx_t nlats_half_;  // number of latitudes in the northern hemisphere, including the equator
+    idx_t nb_gridpoints_;
+
+    // Zonal wavenumbers of this task, with offsets in spectral data, and the first latitude from the pole
+    // where they contribute (reduced truncation near the poles)
+    std::vector<int> zonal_wavenumbers_;
+    std::vector<idx_t> spectral_begin_;
+    std::vector<idx_t> jlat_begin_;
+
+    // Associated Legendre functions of zonal wavenumbers of this task in northern hemisphere,
+    // split in symmetric and antisymmetric parts
+    std::vector<double> legendre_sym_;
+    std::vector<double> legendre_asym_;
+    std::vector<size_t> legendre_sym_begin_;
+    std::vector<size_t> legendre_asym_begin_;
+
+    // Zonal wavenumbers and latitudes of every task, in compressed row format
+    std::vector<int> part_zonal_wavenumbers_;
+    std::vector<idx_t> part_zonal_wavenumbers_begin_;
+    std::vector<idx_t> part_lats_;
+    std::vector<idx_t> part_lats_begin_;
+
+    // Longitude indices of grid points of this task, per latitude of this task (in compressed row format)
+    std::vector<idx_t> lons_;
+    std::vector<idx_t> lons_begin_;
+};
+
+//-----------------------------------------------------------------------------
+
+}  // namespace trans
+}  // namespace atlas
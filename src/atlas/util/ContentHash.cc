@@ -0,0 +1,128 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#include "atlas/util/ContentHash.h"
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#include "atlas/parallel/omp/omp.h"
+
+namespace atlas {
+namespace util {
+
+namespace {
+
+// Reference: https://github.com/Cyan4973/xxHash/blob/dev/doc/xxhash_spec.md
+constexpr std::uint64_t prime1 = 0x9E3779B185EBCA87ULL;
+constexpr std::uint64_t prime2 = 0xC2B2AE3D27D4EB4FULL;
+constexpr std::uint64_t prime3 = 0x165667B19E3779F9ULL;
+constexpr std::uint64_t prime4 = 0x85EBCA77C2B2AE63ULL;
+constexpr std::uint64_t prime5 = 0x27D4EB2F165667C5ULL;
+
+inline std::uint64_t rotl(std::uint64_t x, int r) {
+    return (x << r) | (x >> (64 - r));
+}
+
+// Unaligned little-endian reads; the hash of the same bytes differs on big-endian platforms
+inline std::uint64_t read64(const unsigned char* p) {
+    std::uint64_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+inline std::uint32_t read32(const unsigned char* p) {
+    std::uint32_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+inline std::uint64_t xxh_round(std::uint64_t acc, std::uint64_t input) {
+    acc += input * prime2;
+    acc = rotl(acc, 31);
+    return acc * prime1;
+}
+
+inline std::uint64_t xxh_merge_round(std::uint64_t acc, std::uint64_t val) {
+    acc ^= xxh_round(0, val);
+    return acc * prime1 + prime4;
+}
+
+}  // namespace
+
+std::uint64_t xxhash64(const void* data, size_t bytes, std::uint64_t seed) {
+    const unsigned char* p   = static_cast<const unsigned char*>(data);
+    const unsigned char* end = p + bytes;
+    std::uint64_t h;
+
+    if (bytes >= 32) {
+        std::uint64_t v1 = seed + prime1 + prime2;
+        std::uint64_t v2 = seed + prime2;
+        std::uint64_t v3 = seed;
+        std::uint64_t v4 = seed - prime1;
+        for (; p + 32 <= end; p += 32) {
+            v1 = xxh_round(v1, read64(p));
+            v2 = xxh_round(v2, read64(p + 8));
+            v3 = xxh_round(v3, read64(p + 16));
+            v4 = xxh_round(v4, read64(p + 24));
+        }
+        h = rotl(v1, 1) + rotl(v2, 7) + rotl(v3, 12) + rotl(v4, 18);
+        h = xxh_merge_round(h, v1);
+        h = xxh_merge_round(h, v2);
+        h = xxh_merge_round(h, v3);
+        h = xxh_merge_round(h, v4);
+    }
+    else {
+        h = seed + prime5;
+    }
+
+    h += static_cast<std::uint64_t>(bytes);
+
+    for (; p + 8 <= end; p += 8) {
+        h ^= xxh_round(0, read64(p));
+        h = rotl(h, 27) * prime1 + prime4;
+    }
+    if (p + 4 <= end) {
+        h ^= static_cast<std::uint64_t>(read32(p)) * prime1;
+        h = rotl(h, 23) * prime2 + prime3;
+        p += 4;
+    }
+    for (; p < end; ++p) {
+        h ^= static_cast<std::uint64_t>(*p) * prime5;
+        h = rotl(h, 11) * prime1;
+    }
+
+    h ^= h >> 33;
+    h *= prime2;
+    h ^= h >> 29;
+    h *= prime3;
+    h ^= h >> 32;
+    return h;
+}
+
+std::uint64_t content_hash(const void* data, size_t bytes, std::uint64_t seed) {
+    const size_t nb_blocks = (bytes + content_hash_block_size - 1) / content_hash_block_size;
+    if (nb_blocks <= 1) {
+        return xxhash64(data, bytes, seed);
+    }
+
+    const unsigned char* p = static_cast<const unsigned char*>(data);
+    std::vector<std::uint64_t> digests(nb_blocks);
+    atlas_omp_parallel_for(size_t jblock = 0; jblock < nb_blocks; ++jblock) {
+        const size_t begin = jblock * content_hash_block_size;
+        const size_t size  = std::min(content_hash_block_size, bytes - begin);
+        digests[jblock]    = xxhash64(p + begin, size, seed);
+    }
+    return xxhash64(digests.data(), digests.size() * sizeof(std::uint64_t), seed);
+}
+
+}  // namespace util
+}  // namespace atlas
@@ -0,0 +1,32 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace atlas {
+namespace util {
+
+/// @brief Non-cryptographic 64-bit hash XXH64 of a buffer
+std::uint64_t xxhash64(const void* data, size_t bytes, std::uint64_t seed = 0);
+
+/// @brief 64-bit hash of a large buffer, computed in parallel
+///
+/// The buffer is split in blocks of content_hash_block_size bytes, which are hashed independently with xxhash64.
+/// The block digests are then hashed together. The result only depends on the contents, not on the number of
+/// threads. Buffers that fit in a single block have content_hash == xxhash64.
+std::uint64_t content_hash(const void* data, size_t bytes, std::uint64_t seed = 0);
+
+constexpr size_t content_hash_block_size = size_t(1) << 20;
+
+}  // namespace util
+}  // namespace atlas
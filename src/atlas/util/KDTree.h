@@ -10,9 +10,13 @@
 
 #pragma once
 
+#include <string>
+
+#include "atlas/util/Config.h"
 #include "atlas/util/Geometry.h"
 #include "atlas/util/ObjectHandle.h"
 #include "atlas/util/detail/KDTree.h"
+#include "atlas/util/detail/KDTreeFlat.h"
 
 namespace atlas {
 namespace util {
@@ -21,10 +25,15 @@ namespace util {
 
 /// @brief k-dimensional tree constructable both with 2D (lon,lat) points as with 3D (x,y,z) points
 ///
-/// The implementation is based on eckit::KDTreeMemory with 3D (x,y,z) points.
+/// The default implementation is based on eckit::KDTreeMemory with 3D (x,y,z) points.
 /// 2D points (lon,lat) are converted when needed to 3D during insertion, and during search, so that
 /// a search always happens with 3D cartesian points.
 ///
+/// The implementation can be selected with the configuration option "type":
+///   - "eckit" (default): eckit::KDTreeMemory, a pointer-based tree which allows insertion after build()
+///   - "flat": detail::KDTreeFlat, an implicit tree in flat arrays with threaded construction and batched searches.
+///     With option "single_precision" the coordinates are stored as float.
+///
 /// ### Example:
 ///
 /// Construct a KDTree, given a `list_of_lonlat_points` (e.g. `std::vector<PointLonLat>` or other container)
@@ -71,6 +80,12 @@ public:
     /// @brief Construct an empty kd-tree with custom geometry
     KDTree(const Geometry& geometry): Handle(new detail::KDTreeMemory<Payload, Point>(geometry)) {}
 
+    /// @brief Construct an empty kd-tree of given "type" with default geometry (Earth)
+    explicit KDTree(const eckit::Configuration& config): Handle(create(config, Geometry())) {}
+
+    /// @brief Construct an empty kd-tree of given "type" with custom geometry
+    KDTree(const eckit::Configuration& config, const Geometry& geometry): Handle(create(config, geometry)) {}
+
     /// @brief Construct a shared kd-tree with default geometry (Earth)
     template <typename Tree>
     KDTree(const std::shared_ptr<Tree>& kdtree): Handle(new detail::KDTree_eckit<Tree, Payload, Point>(kdtree)) {}
@@ -169,8 +184,40 @@ public:
         return get()->closestPointsWithinRadius(p, radius);
     }
 
+    /// @brief Find k closest points for each point in a random-access container of 3D cartesian points (x,y,z)
+    /// or 2D lonlat points (lon,lat). The search is threaded for the "flat" implementation.
+    /// @param[out] payloads   payloads of the k closest points of points[i], sorted by distance, at [i*k, (i+1)*k)
+    /// @param[out] distances  distances of the k closest points, with the same layout as payloads
+    template <typename Points>
+    void closestPoints(const Points& points, size_t k, PayloadList& payloads, std::vector<double>& distances) const {
+        get()->closestPoints(points, k, payloads, distances);
+    }
+
+    /// @brief Find all points within a distance of given radius for each point in a random-access container of
+    /// 3D cartesian points (x,y,z) or 2D lonlat points (lon,lat). The search is threaded for the "flat" implementation.
+    template <typename Points>
+    void closestPointsWithinRadius(const Points& points, double radius, std::vector<ValueList>& result) const {
+        get()->closestPointsWithinRadius(points, radius, result);
+    }
+
     /// @brief Return geometry used to convert (lon,lat) to (x,y,z) coordinates
     const Geometry& geometry() const { return get()->geometry(); }
+
+private:
+    static Implementation* create(const eckit::Configuration& config, const Geometry& geometry) {
+        std::string type = "eckit";
+        config.get("type", type);
+        if (type == "eckit") {
+            return new detail::KDTreeMemory<Payload, Point>(geometry);
+        }
+        if (type == "flat") {
+            if (config.getBool("single_precision", false)) {
+                return new detail::KDTreeFlat<Payload, Point, float>(geometry);
+            }
+            return new detail::KDTreeFlat<Payload, Point>(geometry);
+        }
+        throw_Exception("KDTree type '" + type + "' not recognised. Possible values: 'eckit', 'flat'", Here());
+    }
 };
 
 //------------------------------------------------------------------------------------------------------
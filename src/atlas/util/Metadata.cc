@@ -127,6 +127,7 @@ Metadata& Metadata::set(const eckit::LocalConfiguration& other) {
     for (auto& key : other_keys) {
         root[key] = other_root[key];
     }
+    ++modifications_;
     return *this;
 }
 
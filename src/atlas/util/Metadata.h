@@ -27,11 +27,17 @@ public:
     Metadata(const eckit::LocalConfiguration& p): eckit::LocalConfiguration(p) {}
     Metadata(const Metadata& p): eckit::LocalConfiguration(p) {}
 
-    using eckit::LocalConfiguration::set;
+    Metadata& operator=(const Metadata& p) {
+        eckit::LocalConfiguration::operator=(p);
+        ++modifications_;
+        return *this;
+    }
 
+    // All setters go through this template, so that every change is counted in modifications()
     template <typename ValueT>
     Metadata& set(const std::string& name, const ValueT& value) {
         eckit::LocalConfiguration::set(name, value);
+        ++modifications_;
         return *this;
     }
 
@@ -61,10 +67,16 @@ public:
 
     size_t footprint() const;
 
+    /// @brief Number of changes made through set() or assignment, which allows owners to cache values derived
+    /// from this metadata
+    size_t modifications() const { return modifications_; }
+
 private:
     [[noreturn]] void throw_not_found(const std::string&) const;
 
     Metadata(const eckit::Value&);
+
+    size_t modifications_{0};
 };
 
 // ------------------------------------------------------------------
@@ -210,5 +210,57 @@ void Rotation::unrotate(double crd[]) const {
     crd[LON] += angle_;
 }
 
+void Rotation::rotate(idx_t n, double lon[], double lat[], idx_t stride) const {
+    if (!rotated_) {
+        return;
+    }
+
+    for (idx_t i = 0; i < n; ++i) {
+        lon[i * stride] -= angle_;
+    }
+
+    if (!rotation_angle_only_) {
+        for (idx_t i = 0; i < n; ++i) {
+            const idx_t j = i * stride;
+            const PointLonLat L(wrap_latitude({lon[j], lat[j]}));
+            PointXYZ P;
+            UnitSphere::convertSphericalToCartesian(L, P);
+
+            const PointXYZ Pt = rotate_geocentric(P, rotate_);
+            PointLonLat Lt;
+            UnitSphere::convertCartesianToSpherical(Pt, Lt);
+
+            lon[j] = Lt.lon();
+            lat[j] = Lt.lat();
+        }
+    }
+}
+
+void Rotation::unrotate(idx_t n, double lon[], double lat[], idx_t stride) const {
+    if (!rotated_) {
+        return;
+    }
+
+    if (!rotation_angle_only_) {
+        for (idx_t i = 0; i < n; ++i) {
+            const idx_t j = i * stride;
+            const PointLonLat Lt(lon[j], lat[j]);
+            PointXYZ Pt;
+            UnitSphere::convertSphericalToCartesian(Lt, Pt);
+
+            const PointXYZ P = rotate_geocentric(Pt, unrotate_);
+            PointLonLat L;
+            UnitSphere::convertCartesianToSpherical(P, L);
+
+            lon[j] = L.lon();
+            lat[j] = L.lat();
+        }
+    }
+
+    for (idx_t i = 0; i < n; ++i) {
+        lon[i * stride] += angle_;
+    }
+}
+
 }  // namespace util
 }  // namespace atlas
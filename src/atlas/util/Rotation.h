@@ -13,6 +13,7 @@
 #include <array>
 #include <iosfwd>
 
+#include "atlas/library/config.h"
 #include "atlas/util/Point.h"
 
 namespace eckit {
@@ -40,6 +41,10 @@ public:
     void rotate(double crd[]) const;
     void unrotate(double crd[]) const;
 
+    // Rotate or unrotate n points in place, with point i stored at (lon[i*stride], lat[i*stride])
+    void rotate(idx_t n, double lon[], double lat[], idx_t stride = 1) const;
+    void unrotate(idx_t n, double lon[], double lat[], idx_t stride = 1) const;
+
 private:
     void precompute();
 
@@ -0,0 +1,108 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#include "atlas/util/SpaceFillingCurve.h"
+
+#include <algorithm>
+#include <limits>
+
+#include "atlas/parallel/omp/omp.h"
+#include "atlas/parallel/omp/sort.h"
+#include "atlas/runtime/Exception.h"
+
+namespace atlas {
+namespace util {
+
+namespace {
+
+constexpr int lattice_bits = 16;
+constexpr double max_cell  = double((std::uint32_t(1) << lattice_bits) - 1);
+
+// Spread the lower 16 bits of x to the even bits
+inline std::uint32_t spread_bits(std::uint32_t x) {
+    x &= 0x0000ffff;
+    x = (x | (x << 8)) & 0x00ff00ff;
+    x = (x | (x << 4)) & 0x0f0f0f0f;
+    x = (x | (x << 2)) & 0x33333333;
+    x = (x | (x << 1)) & 0x55555555;
+    return x;
+}
+
+}  // namespace
+
+std::uint32_t morton_key(std::uint32_t ix, std::uint32_t iy) {
+    return spread_bits(ix) | (spread_bits(iy) << 1);
+}
+
+std::uint32_t hilbert_key(std::uint32_t ix, std::uint32_t iy) {
+    // Reference: https://en.wikipedia.org/wiki/Hilbert_curve (xy2d)
+    constexpr std::uint32_t n = std::uint32_t(1) << lattice_bits;
+    std::uint32_t key         = 0;
+    for (std::uint32_t s = n / 2; s > 0; s /= 2) {
+        const std::uint32_t rx = (ix & s) ? 1 : 0;
+        const std::uint32_t ry = (iy & s) ? 1 : 0;
+        key += s * s * ((3 * rx) ^ ry);
+        // Rotate the quadrant, so that the curve enters and leaves it in the same orientation
+        if (ry == 0) {
+            if (rx == 1) {
+                ix = n - 1 - ix;
+                iy = n - 1 - iy;
+            }
+            std::swap(ix, iy);
+        }
+    }
+    return key;
+}
+
+bool space_filling_curve_ordering(const std::string& type) {
+    if (type == "none") {
+        return false;
+    }
+    if (type != "hilbert" && type != "morton") {
+        throw_Exception("Unknown ordering \"" + type + "\"; possible values are \"none\", \"hilbert\", \"morton\"",
+                        Here());
+    }
+    return true;
+}
+
+std::vector<idx_t> space_filling_curve_order(const std::string& type, const std::vector<PointXY>& points) {
+    ATLAS_ASSERT(space_filling_curve_ordering(type));
+    const idx_t size = static_cast<idx_t>(points.size());
+
+    double xmin = std::numeric_limits<double>::max();
+    double xmax = std::numeric_limits<double>::lowest();
+    double ymin = std::numeric_limits<double>::max();
+    double ymax = std::numeric_limits<double>::lowest();
+    for (const auto& p : points) {
+        xmin = std::min(xmin, p.x());
+        xmax = std::max(xmax, p.x());
+        ymin = std::min(ymin, p.y());
+        ymax = std::max(ymax, p.y());
+    }
+
+    const double scale_x = xmax > xmin ? max_cell / (xmax - xmin) : 0.;
+    const double scale_y = ymax > ymin ? max_cell / (ymax - ymin) : 0.;
+    auto cell            = [](double u) { return static_cast<std::uint32_t>(std::min(u, max_cell)); };
+
+    const bool hilbert = (type == "hilbert");
+    std::vector<std::uint32_t> keys(size);
+    atlas_omp_parallel_for(idx_t n = 0; n < size; ++n) {
+        const std::uint32_t ix = cell((points[n].x() - xmin) * scale_x);
+        const std::uint32_t iy = cell((points[n].y() - ymin) * scale_y);
+        keys[n]                = hilbert ? hilbert_key(ix, iy) : morton_key(ix, iy);
+    }
+
+    std::vector<idx_t> order(size);
+    omp::radix_argsort(keys.begin(), keys.end(), order.begin());
+    return order;
+}
+
+}  // namespace util
+}  // namespace atlas
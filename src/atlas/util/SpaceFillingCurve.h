@@ -0,0 +1,42 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "atlas/library/config.h"
+#include "atlas/util/Point.h"
+
+namespace atlas {
+namespace util {
+
+/// @brief Position of cell (ix,iy) of a 2^16 x 2^16 lattice along the Morton (Z-order) curve
+std::uint32_t morton_key(std::uint32_t ix, std::uint32_t iy);
+
+/// @brief Position of cell (ix,iy) of a 2^16 x 2^16 lattice along the Hilbert curve
+std::uint32_t hilbert_key(std::uint32_t ix, std::uint32_t iy);
+
+/// @brief Permutation that orders points along a space filling curve
+///
+/// The bounding box of the points is divided in a 2^16 x 2^16 lattice, and points are stably sorted by the key of
+/// their lattice cell, so that points in the same cell keep their relative order.
+///
+/// @param type  "hilbert" or "morton"
+/// @return order such that order[k] is the index in points of the k-th point along the curve
+std::vector<idx_t> space_filling_curve_order(const std::string& type, const std::vector<PointXY>& points);
+
+/// @brief Check that the ordering type is "none", "hilbert" or "morton", and return true unless it is "none"
+bool space_filling_curve_ordering(const std::string& type);
+
+}  // namespace util
+}  // namespace atlas
@@ -12,10 +12,12 @@
 
 #include <iosfwd>
 #include <memory>
+#include <vector>
 
 #include "eckit/container/KDTree.h"
 
 #include "atlas/library/config.h"
+#include "atlas/parallel/omp/omp.h"
 #include "atlas/runtime/Exception.h"
 #include "atlas/runtime/Log.h"
 #include "atlas/util/Geometry.h"
@@ -72,6 +74,8 @@ public:
 
     class ValueList : public std::vector<Value> {
     public:
+        ValueList() = default;
+
         PayloadList payloads() const {
             PayloadList list;
             list.reserve(this->size());
@@ -214,6 +218,48 @@ public:
         return do_closestPointsWithinRadius(p, radius);
     }
 
+    /// @brief Find k nearest neighbours for each point in a random-access container of 3D cartesian points (x,y,z)
+    /// or 2D lonlat points (lon,lat). Depending on the implementation, the search is threaded.
+    /// @param[out] payloads   neighbours of points[i], sorted by shortest distance, at [i*k, (i+1)*k)
+    /// @param[out] distances  distances of the neighbours, with the same layout as payloads
+    template <typename Points>
+    void closestPoints(const Points& points, size_t k, PayloadList& payloads, std::vector<double>& distances) const {
+        ATLAS_ASSERT(k <= static_cast<size_t>(size()));
+        do_batchClosestPoints(make_Points(points), k, payloads, distances);
+    }
+
+    /// @brief Find all points within a distance of given radius for each point in a random-access container of
+    /// 3D cartesian points (x,y,z) or 2D lonlat points (lon,lat). Depending on the implementation, the search is
+    /// threaded.
+    template <typename Points>
+    void closestPointsWithinRadius(const Points& points, double radius, std::vector<ValueList>& result) const {
+        do_batchClosestPointsWithinRadius(make_Points(points), radius, result);
+    }
+
+protected:
+    /// @brief Find k nearest neighbours of many 3D cartesian points (x,y,z); not threaded by default
+    virtual void do_batchClosestPoints(const std::vector<Point>& points, size_t k, PayloadList& payloads,
+                                       std::vector<double>& distances) const {
+        payloads.resize(points.size() * k);
+        distances.resize(points.size() * k);
+        for (size_t i = 0; i < points.size(); ++i) {
+            auto list = do_closestPoints(points[i], k);
+            for (size_t j = 0; j < k; ++j) {
+                payloads[i * k + j]  = list[j].payload();
+                distances[i * k + j] = list[j].distance();
+            }
+        }
+    }
+
+    /// @brief Find all points within given radius of many 3D cartesian points (x,y,z); not threaded by default
+    virtual void do_batchClosestPointsWithinRadius(const std::vector<Point>& points, double radius,
+                                                   std::vector<ValueList>& result) const {
+        result.resize(points.size());
+        for (size_t i = 0; i < points.size(); ++i) {
+            result[i] = do_closestPointsWithinRadius(points[i], radius);
+        }
+    }
+
 private:
     /// @brief Insert spherical point (lon,lat)
     /// If memory has been reserved with reserve(), insertion will be delayed until build() is called.
@@ -263,6 +309,17 @@ private:
         geometry().lonlat2xyz(lonlat, xyz);
         return xyz;
     }
+
+    const Point& make_Point(const Point& p) const { return p; }
+
+    template <typename Points>
+    std::vector<Point> make_Points(const Points& points) const {
+        std::vector<Point> converted(points.size());
+        atlas_omp_parallel_for(size_t i = 0; i < converted.size(); ++i) {
+            converted[i] = make_Point(points[i]);
+        }
+        return converted;
+    }
 #undef ENABLE_IF_3D_AND_IS_LONLAT
 };
 
@@ -0,0 +1,431 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <numeric>
+#include <vector>
+
+#include "atlas/library/config.h"
+#include "atlas/parallel/omp/omp.h"
+#include "atlas/runtime/Exception.h"
+#include "atlas/util/detail/KDTree.h"
+
+namespace atlas {
+namespace util {
+namespace detail {
+
+//------------------------------------------------------------------------------------------------------
+
+/// @brief Implicit kd-tree stored in flat arrays, built in one shot
+///
+/// Points are reordered so that each node of the tree is a contiguous range of points, split in two halves at
+/// the median of the coordinate with largest extent. Only the split dimension and value of each node are stored,
+/// in breadth-first order, and child ranges follow from the parent range. Leaves hold at most `leaf_size` points,
+/// whose coordinates are stored per dimension so that the distances of a leaf are computed in one vectorised loop.
+///
+/// With CoordT = float the coordinates take half the memory, and distances are accurate to single precision.
+///
+/// Unlike KDTree_eckit, inserted points are always buffered until build() is called, which is required before
+/// searching. Construction and batched searches are threaded.
+template <typename PayloadT, typename PointT = Point3, typename CoordT = double>
+class KDTreeFlat : public KDTreeBase<PayloadT, PointT> {
+    using Base = KDTreeBase<PayloadT, PointT>;
+
+public:
+    using Point       = typename Base::Point;
+    using Payload     = typename Base::Payload;
+    using PayloadList = typename Base::PayloadList;
+    using Value       = typename Base::Value;
+    using ValueList   = typename Base::ValueList;
+
+    using Base::build;
+    using Base::closestPoint;
+    using Base::closestPoints;
+    using Base::closestPointsWithinRadius;
+    using Base::insert;
+    using Base::reserve;
+
+    static constexpr int DIMS        = Point::DIMS;
+    static constexpr idx_t leaf_size = 16;
+
+public:
+    KDTreeFlat() = default;
+
+    KDTreeFlat(const Geometry& geometry): Base(geometry) {}
+
+    idx_t size() const override { return static_cast<idx_t>(payloads_.size()); }
+
+    size_t footprint() const override {
+        return size() * (DIMS * sizeof(CoordT) + sizeof(Payload) + sizeof(idx_t)) +
+               split_value_.size() * (sizeof(CoordT) + sizeof(unsigned char));
+    }
+
+    void reserve(idx_t size) override { tmp_.reserve(size); }
+
+    void build() override;
+
+    void build(std::vector<Value>&) override;
+
+    /// @brief Insert 3D cartesian point (x,y,z)
+    /// Insertion is delayed until build() is called.
+    void insert(const Value& value) override { tmp_.emplace_back(value); }
+
+private:
+    struct Neighbour {
+        double distance2;
+        idx_t order;  // insertion order, to break ties in distance
+        idx_t index;  // index in tree order
+        bool operator<(const Neighbour& other) const {
+            return distance2 < other.distance2 || (distance2 == other.distance2 && order < other.order);
+        }
+    };
+
+    /// @brief Find k nearest neighbours given a 3D cartesian point (x,y,z)
+    ValueList do_closestPoints(const Point&, size_t k) const override;
+
+    /// @brief Find nearest neighbour given a 3D cartesian point (x,y,z)
+    Value do_closestPoint(const Point&) const override;
+
+    /// @brief Find all points within a distance of given radius from a given point (x,y,z)
+    ValueList do_closestPointsWithinRadius(const Point&, double radius) const override;
+
+    void do_batchClosestPoints(const std::vector<Point>&, size_t k, PayloadList&,
+                               std::vector<double>&) const override;
+
+    void do_batchClosestPointsWithinRadius(const std::vector<Point>&, double radius,
+                                           std::vector<ValueList>&) const override;
+
+    void build_node(idx_t node, idx_t level, idx_t begin, idx_t end, idx_t* permutation,
+                    std::array<const CoordT*, DIMS> coords);
+
+    /// @brief Search k nearest neighbours; neighbours is a max-heap of at most k entries
+    void search_nearest(const Point&, size_t k, std::vector<Neighbour>& neighbours) const;
+
+    void search_nearest(idx_t node, idx_t level, idx_t begin, idx_t end, const Point&, size_t k,
+                        std::vector<Neighbour>& neighbours) const;
+
+    void search_radius(idx_t node, idx_t level, idx_t begin, idx_t end, const Point&, double radius2,
+                       std::vector<Neighbour>& neighbours) const;
+
+    /// @brief Squared distances of points [begin,end) of a leaf to p
+    void leaf_distances(idx_t begin, idx_t end, const Point& p, double distance2[]) const {
+        for (idx_t i = 0; i < end - begin; ++i) {
+            distance2[i] = 0.;
+        }
+        for (int d = 0; d < DIMS; ++d) {
+            const CoordT* x = coords_[d].data() + begin;
+            const double pd = p[d];
+            atlas_omp_pragma(omp simd)
+            for (idx_t i = 0; i < end - begin; ++i) {
+                const double dx = double(x[i]) - pd;
+                distance2[i] += dx * dx;
+            }
+        }
+    }
+
+    Point point(idx_t i) const {
+        Point p;
+        for (int d = 0; d < DIMS; ++d) {
+            p[d] = coords_[d][i];
+        }
+        return p;
+    }
+
+    Value value(const Neighbour& neighbour) const {
+        return Value(point(neighbour.index), payloads_[neighbour.index], std::sqrt(neighbour.distance2));
+    }
+
+    void assert_built() const {
+        if (tmp_.capacity()) {
+            throw_AssertionFailed("KDTree was used before calling build()");
+        }
+    }
+
+private:
+    std::vector<Value> tmp_;
+    idx_t depth_{0};
+    std::array<std::vector<CoordT>, DIMS> coords_;  // coordinates in tree order, per dimension
+    std::vector<Payload> payloads_;                 // payloads in tree order
+    std::vector<idx_t> order_;                      // insertion order of points in tree order
+    std::vector<unsigned char> split_dim_;          // per node, in breadth-first order
+    std::vector<CoordT> split_value_;               // per node, in breadth-first order
+};
+
+//------------------------------------------------------------------------------------------------------
+
+template <typename PayloadT, typename PointT, typename CoordT>
+void KDTreeFlat<PayloadT, PointT, CoordT>::build() {
+    if (tmp_.size()) {
+        build(tmp_);
+        tmp_.clear();
+        tmp_.shrink_to_fit();
+    }
+}
+
+template <typename PayloadT, typename PointT, typename CoordT>
+void KDTreeFlat<PayloadT, PointT, CoordT>::build(std::vector<Value>& values) {
+    const idx_t n = static_cast<idx_t>(values.size());
+
+    // Smallest depth for which leaves, of size ceil(n/2^depth), hold at most leaf_size points
+    depth_ = 0;
+    while (n > 0 && ((n - 1) >> depth_) + 1 > leaf_size) {
+        ++depth_;
+    }
+    const idx_t nb_nodes = (idx_t(1) << depth_) - 1;
+    split_dim_.assign(nb_nodes, 0);
+    split_value_.assign(nb_nodes, 0);
+
+    std::array<std::vector<CoordT>, DIMS> coords;
+    std::array<const CoordT*, DIMS> coords_ptr;
+    for (int d = 0; d < DIMS; ++d) {
+        coords[d].resize(n);
+        coords_ptr[d] = coords[d].data();
+    }
+    atlas_omp_parallel_for(idx_t i = 0; i < n; ++i) {
+        for (int d = 0; d < DIMS; ++d) {
+            coords[d][i] = static_cast<CoordT>(values[i].point()[d]);
+        }
+    }
+
+    std::vector<idx_t> permutation(n);
+    std::iota(permutation.begin(), permutation.end(), 0);
+    atlas_omp_parallel {
+        atlas_omp_pragma(omp single)
+        build_node(0, 0, 0, n, permutation.data(), coords_ptr);
+    }
+
+    payloads_.resize(n);
+    order_.resize(n);
+    for (int d = 0; d < DIMS; ++d) {
+        coords_[d].resize(n);
+    }
+    atlas_omp_parallel_for(idx_t i = 0; i < n; ++i) {
+        const idx_t j = permutation[i];
+        payloads_[i]  = values[j].payload();
+        order_[i]     = j;
+        for (int d = 0; d < DIMS; ++d) {
+            coords_[d][i] = coords[d][j];
+        }
+    }
+}
+
+template <typename PayloadT, typename PointT, typename CoordT>
+void KDTreeFlat<PayloadT, PointT, CoordT>::build_node(idx_t node, idx_t level, idx_t begin, idx_t end,
+                                                      idx_t* permutation, std::array<const CoordT*, DIMS> coords) {
+    if (level == depth_) {
+        return;
+    }
+
+    // Split the dimension with largest extent
+    std::array<CoordT, DIMS> min, max;
+    for (int d = 0; d < DIMS; ++d) {
+        min[d] = max[d] = coords[d][permutation[begin]];
+    }
+    for (idx_t i = begin + 1; i < end; ++i) {
+        for (int d = 0; d < DIMS; ++d) {
+            const CoordT x = coords[d][permutation[i]];
+            min[d]         = std::min(min[d], x);
+            max[d]         = std::max(max[d], x);
+        }
+    }
+    int dim = 0;
+    for (int d = 1; d < DIMS; ++d) {
+        if (max[d] - min[d] > max[dim] - min[dim]) {
+            dim = d;
+        }
+    }
+
+    const idx_t mid  = begin + (end - begin) / 2;
+    const CoordT* x  = coords[dim];
+    std::nth_element(permutation + begin, permutation + mid, permutation + end,
+                     [x](idx_t i, idx_t j) { return x[i] < x[j]; });
+    split_dim_[node]   = static_cast<unsigned char>(dim);
+    split_value_[node] = x[permutation[mid]];
+
+    ATLAS_MAYBE_UNUSED const bool spawn = (end - begin) > (1 << 15);
+    atlas_omp_pragma(omp task if (spawn))
+    build_node(2 * node + 1, level + 1, begin, mid, permutation, coords);
+    atlas_omp_pragma(omp task if (spawn))
+    build_node(2 * node + 2, level + 1, mid, end, permutation, coords);
+    atlas_omp_pragma(omp taskwait)
+}
+
+//------------------------------------------------------------------------------------------------------
+
+template <typename PayloadT, typename PointT, typename CoordT>
+void KDTreeFlat<PayloadT, PointT, CoordT>::search_nearest(const Point& p, size_t k,
+                                                          std::vector<Neighbour>& neighbours) const {
+    neighbours.clear();
+    if (k > 0 && size() > 0) {
+        search_nearest(0, 0, 0, size(), p, k, neighbours);
+    }
+}
+
+template <typename PayloadT, typename PointT, typename CoordT>
+void KDTreeFlat<PayloadT, PointT, CoordT>::search_nearest(idx_t node, idx_t level, idx_t begin, idx_t end,
+                                                          const Point& p, size_t k,
+                                                          std::vector<Neighbour>& neighbours) const {
+    if (level == depth_) {
+        double distance2[leaf_size];
+        leaf_distances(begin, end, p, distance2);
+        for (idx_t i = begin; i < end; ++i) {
+            Neighbour candidate{distance2[i - begin], order_[i], i};
+            if (neighbours.size() < k) {
+                neighbours.emplace_back(candidate);
+                std::push_heap(neighbours.begin(), neighbours.end());
+            }
+            else if (candidate < neighbours.front()) {
+                std::pop_heap(neighbours.begin(), neighbours.end());
+                neighbours.back() = candidate;
+                std::push_heap(neighbours.begin(), neighbours.end());
+            }
+        }
+        return;
+    }
+    const idx_t mid   = begin + (end - begin) / 2;
+    const double diff = p[split_dim_[node]] - double(split_value_[node]);
+    if (diff < 0.) {
+        search_nearest(2 * node + 1, level + 1, begin, mid, p, k, neighbours);
+        if (neighbours.size() < k || diff * diff <= neighbours.front().distance2) {
+            search_nearest(2 * node + 2, level + 1, mid, end, p, k, neighbours);
+        }
+    }
+    else {
+        search_nearest(2 * node + 2, level + 1, mid, end, p, k, neighbours);
+        if (neighbours.size() < k || diff * diff <= neighbours.front().distance2) {
+            search_nearest(2 * node + 1, level + 1, begin, mid, p, k, neighbours);
+        }
+    }
+}
+
+template <typename PayloadT, typename PointT, typename CoordT>
+void KDTreeFlat<PayloadT, PointT, CoordT>::search_radius(idx_t node, idx_t level, idx_t begin, idx_t end,
+                                                         const Point& p, double radius2,
+                                                         std::vector<Neighbour>& neighbours) const {
+    if (level == depth_) {
+        double distance2[leaf_size];
+        leaf_distances(begin, end, p, distance2);
+        for (idx_t i = begin; i < end; ++i) {
+            if (distance2[i - begin] <= radius2) {
+                neighbours.emplace_back(Neighbour{distance2[i - begin], order_[i], i});
+            }
+        }
+        return;
+    }
+    const idx_t mid   = begin + (end - begin) / 2;
+    const double diff = p[split_dim_[node]] - double(split_value_[node]);
+    if (diff < 0. || diff * diff <= radius2) {
+        search_radius(2 * node + 1, level + 1, begin, mid, p, radius2, neighbours);
+    }
+    if (diff >= 0. || diff * diff <= radius2) {
+        search_radius(2 * node + 2, level + 1, mid, end, p, radius2, neighbours);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------
+
+template <typename PayloadT, typename PointT, typename CoordT>
+typename KDTreeFlat<PayloadT, PointT, CoordT>::ValueList KDTreeFlat<PayloadT, PointT, CoordT>::do_closestPoints(
+    const Point& p, size_t k) const {
+    assert_built();
+    std::vector<Neighbour> neighbours;
+    search_nearest(p, k, neighbours);
+    std::sort_heap(neighbours.begin(), neighbours.end());
+    ValueList list;
+    list.reserve(neighbours.size());
+    for (const auto& neighbour : neighbours) {
+        list.emplace_back(value(neighbour));
+    }
+    return list;
+}
+
+template <typename PayloadT, typename PointT, typename CoordT>
+typename KDTreeFlat<PayloadT, PointT, CoordT>::Value KDTreeFlat<PayloadT, PointT, CoordT>::do_closestPoint(
+    const Point& p) const {
+    assert_built();
+    std::vector<Neighbour> neighbours;
+    search_nearest(p, 1, neighbours);
+    ATLAS_ASSERT(neighbours.size() == 1, "KDTree is empty");
+    return value(neighbours.front());
+}
+
+template <typename PayloadT, typename PointT, typename CoordT>
+typename KDTreeFlat<PayloadT, PointT, CoordT>::ValueList
+KDTreeFlat<PayloadT, PointT, CoordT>::do_closestPointsWithinRadius(const Point& p, double radius) const {
+    assert_built();
+    std::vector<Neighbour> neighbours;
+    if (size() > 0) {
+        search_radius(0, 0, 0, size(), p, radius * radius, neighbours);
+    }
+    std::sort(neighbours.begin(), neighbours.end());
+    ValueList list;
+    list.reserve(neighbours.size());
+    for (const auto& neighbour : neighbours) {
+        list.emplace_back(value(neighbour));
+    }
+    return list;
+}
+
+template <typename PayloadT, typename PointT, typename CoordT>
+void KDTreeFlat<PayloadT, PointT, CoordT>::do_batchClosestPoints(const std::vector<Point>& points, size_t k,
+                                                                 PayloadList& payloads,
+                                                                 std::vector<double>& distances) const {
+    assert_built();
+    const idx_t n = static_cast<idx_t>(points.size());
+    payloads.resize(n * k);
+    distances.resize(n * k);
+    atlas_omp_parallel {
+        std::vector<Neighbour> neighbours;
+        neighbours.reserve(k);
+        atlas_omp_for(idx_t i = 0; i < n; ++i) {
+            search_nearest(points[i], k, neighbours);
+            std::sort_heap(neighbours.begin(), neighbours.end());
+            for (size_t j = 0; j < k; ++j) {
+                payloads[i * k + j]  = payloads_[neighbours[j].index];
+                distances[i * k + j] = std::sqrt(neighbours[j].distance2);
+            }
+        }
+    }
+}
+
+template <typename PayloadT, typename PointT, typename CoordT>
+void KDTreeFlat<PayloadT, PointT, CoordT>::do_batchClosestPointsWithinRadius(const std::vector<Point>& points,
+                                                                             double radius,
+                                                                             std::vector<ValueList>& result) const {
+    assert_built();
+    const idx_t n = static_cast<idx_t>(points.size());
+    result.resize(n);
+    atlas_omp_parallel {
+        std::vector<Neighbour> neighbours;
+        atlas_omp_for(idx_t i = 0; i < n; ++i) {
+            neighbours.clear();
+            if (size() > 0) {
+                search_radius(0, 0, 0, size(), points[i], radius * radius, neighbours);
+            }
+            std::sort(neighbours.begin(), neighbours.end());
+            ValueList& list = result[i];
+            list.clear();
+            list.reserve(neighbours.size());
+            for (const auto& neighbour : neighbours) {
+                list.emplace_back(value(neighbour));
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------------------------------------
+
+}  // namespace detail
+}  // namespace util
+}  // namespace atlas
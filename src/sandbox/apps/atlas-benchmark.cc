@@ -29,12 +29,15 @@
  *
  */
 
+#include <algorithm>
 #include <cmath>
+#include <functional>
 #include <iomanip>
 #include <iostream>
 #include <limits>
 #include <memory>
 #include <sstream>
+#include <string>
 #include <vector>
 
 #include "atlas/functionspace.h"
@@ -48,7 +51,10 @@
 #include "atlas/mesh/actions/BuildParallelFields.h"
 #include "atlas/mesh/actions/BuildPeriodicBoundaries.h"
 #include "atlas/mesh/actions/Reorder.h"
+#include "atlas/mesh/detail/AccumulateFacets.h"
 #include "atlas/meshgenerator.h"
+#include "atlas/numerics/Nabla.h"
+#include "atlas/numerics/fvm/Method.h"
 #include "atlas/output/Gmsh.h"
 #include "atlas/parallel/Checksum.h"
 #include "atlas/parallel/HaloExchange.h"
@@ -141,10 +147,16 @@ public:
         add_option(new SimpleOption<bool>("details", "Show detailed timers (default=false)"));
         add_option(new SimpleOption<std::string>("reorder", "Reorder mesh (default=none)"));
         add_option(new SimpleOption<bool>("sort_edges", "Sort edges by lowest node local index"));
+        add_option(new SimpleOption<bool>("benchmark_facets", "Compare timings of facet accumulation (default=false)"));
+        add_option(new SimpleOption<bool>("benchmark_nabla", "Time fvm Nabla in double, float and mixed precision"));
     }
 
     void setup();
 
+    void benchmark_facets();
+
+    void benchmark_nabla();
+
     void iteration();
 
     double result();
@@ -176,6 +188,8 @@ private:
     std::string gridname;
     std::string reorder{"none"};
     bool sort_edges{false};
+    bool compare_facets{false};
+    bool compare_nabla{false};
 
     TimerStats iteration_timer;
     TimerStats haloexchange_timer;
@@ -205,6 +219,8 @@ int AtlasBenchmark::execute(const Args& args) {
     args.get("output", output);
     args.get("reorder", reorder);
     args.get("sort_edges", sort_edges);
+    args.get("benchmark_facets", compare_facets);
+    args.get("benchmark_nabla", compare_nabla);
     bool help(false);
     args.get("help", help);
 
@@ -321,6 +337,12 @@ void AtlasBenchmark::setup() {
     ATLAS_TRACE_SCOPE("Create edges_fs") {
         edges_fs = functionspace::EdgeColumns(mesh, option::halo(halo) | util::Config("sort_edges", sort_edges));
     }
+    if (compare_facets) {
+        benchmark_facets();
+    }
+    if (compare_nabla) {
+        benchmark_nabla();
+    }
 
     // mesh.polygon(0).outputPythonScript("plot_polygon.py");
     //  atlas::output::Output gmsh = atlas::output::Gmsh( "edges.msh",
@@ -406,6 +428,93 @@ void AtlasBenchmark::setup() {
 
 //----------------------------------------------------------------------------------------------------------------------
 
+void AtlasBenchmark::benchmark_facets() {
+    // Accumulate facets of the cells including halo, as done in build_edges
+    struct Facets {
+        std::vector<idx_t> nodes;
+        std::vector<idx_t> to_elem;
+        std::vector<idx_t> halo_offsets;
+        idx_t nb_facets;
+        idx_t nb_inner_facets;
+        idx_t missing_value;
+        bool operator==(const Facets& other) const {
+            return nodes == other.nodes && to_elem == other.to_elem && halo_offsets == other.halo_offsets &&
+                   nb_facets == other.nb_facets && nb_inner_facets == other.nb_inner_facets &&
+                   missing_value == other.missing_value;
+        }
+    };
+    size_t nrepeat = 5;
+    auto run       = [&](const std::string& name, decltype(&mesh::detail::accumulate_facets_ordered_by_halo) f) {
+        Facets facets;
+        Trace t(Here(), name);
+        for (size_t j = 0; j < nrepeat; ++j) {
+            facets = Facets();
+            f(mesh.cells(), mesh.nodes(), facets.nodes, facets.to_elem, facets.nb_facets, facets.nb_inner_facets,
+              facets.missing_value, facets.halo_offsets);
+        }
+        t.stop();
+        Log::info() << "  " << std::setw(20) << std::left << name << " : " << std::fixed << std::setprecision(5)
+                    << t.elapsed() / double(nrepeat) << " s" << std::endl;
+        return facets;
+    };
+    Log::info() << "Facet accumulation of " << mesh.cells().size() << " cells, " << atlas_omp_get_max_threads()
+                << " threads" << std::endl;
+    auto sorted        = run("sorted", &mesh::detail::accumulate_facets_ordered_by_halo);
+    auto node_to_facet = run("node-to-facet", &mesh::detail::accumulate_facets_ordered_by_halo_node_to_facet);
+    if (not(sorted == node_to_facet)) {
+        throw_Exception("Sorted facet accumulation differs from node-to-facet search", Here());
+    }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+void AtlasBenchmark::benchmark_nabla() {
+    // The mesh of the benchmark iterations is modified in place (radians, scaled dual volumes), so use a fresh one
+    Mesh fvm_mesh = MeshGenerator("structured", util::Config("partitioner", "equal_regions")).generate(Grid(gridname));
+    numerics::fvm::Method fvm(fvm_mesh, util::Config("levels", nlev));
+    numerics::Nabla nabla(fvm);
+    const auto& fs = fvm.node_columns();
+
+    size_t nrepeat = 10;
+    auto run       = [&](const std::string& name, array::DataType value, array::DataType result) {
+        Field scalar = fs.createField(option::name("scalar") | option::datatype(value));
+        Field vector = fs.createField(option::name("vector") | option::variables(2) | option::datatype(value));
+        Field grad   = fs.createField(option::name("grad") | option::variables(2) | option::datatype(result));
+        Field div    = fs.createField(option::name("div") | option::datatype(result));
+        Field lapl   = fs.createField(option::name("lapl") | option::datatype(result));
+        for (Field field : {scalar, vector}) {
+            if (field.datatype() == array::DataType::kind<float>()) {
+                std::fill_n(field.array().host_data<float>(), field.size(), 1.f);
+            }
+            else {
+                std::fill_n(field.array().host_data<double>(), field.size(), 1.);
+            }
+        }
+
+        auto time = [&](const std::string& op, const std::function<void()>& f) {
+            f();  // warm-up, includes allocation of the laplacian workspace
+            Trace t(Here(), "nabla " + op + " " + name);
+            for (size_t j = 0; j < nrepeat; ++j) {
+                f();
+            }
+            t.stop();
+            Log::info() << "  " << std::setw(12) << std::left << op << std::setw(16) << name << " : " << std::fixed
+                        << std::setprecision(5) << t.elapsed() / double(nrepeat) << " s" << std::endl;
+        };
+        time("gradient", [&] { nabla.gradient(scalar, grad); });
+        time("divergence", [&] { nabla.divergence(vector, div); });
+        time("curl", [&] { nabla.curl(vector, div); });
+        time("laplacian", [&] { nabla.laplacian(scalar, lapl); });
+    };
+    Log::info() << "fvm Nabla operators on " << fs.nb_nodes() << " nodes, " << nlev << " levels, "
+                << atlas_omp_get_max_threads() << " threads" << std::endl;
+    run("double", array::make_datatype<double>(), array::make_datatype<double>());
+    run("float", array::make_datatype<float>(), array::make_datatype<float>());
+    run("float->double", array::make_datatype<float>(), array::make_datatype<double>());
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
 void AtlasBenchmark::iteration() {
     Trace t(Here());
     Trace compute(Here(), "compute");
@@ -0,0 +1,155 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+/**
+ * @file atlas-benchmark-contiguous-view.cc
+ *
+ * Benchmark of multi-level kernels accessed through an ArrayView (runtime strides in every dimension)
+ * versus a ContiguousView (unit stride of the innermost dimension known at compile time).
+ * The kernels are a level-wise axpy, a column sum, and a sparse-matrix-like gather of neighbouring columns.
+ *
+ * Typical usage:
+ *     OMP_NUM_THREADS=8 atlas-benchmark-contiguous-view --npts=100000 --nlev=137 --niter=20
+ */
+
+#include <iomanip>
+#include <string>
+
+#include "atlas/array.h"
+#include "atlas/array/ContiguousView.h"
+#include "atlas/field.h"
+#include "atlas/parallel/omp/omp.h"
+#include "atlas/runtime/AtlasTool.h"
+#include "atlas/runtime/Log.h"
+#include "atlas/runtime/Trace.h"
+
+using namespace atlas;
+
+//------------------------------------------------------------------------------
+
+class Tool : public AtlasTool {
+    int execute(const Args& args) override;
+    std::string briefDescription() override {
+        return "Benchmark multi-level kernels through ArrayView versus ContiguousView";
+    }
+    std::string usage() override { return name() + " [--npts=N] [--nlev=N] [--niter=N] [--help]"; }
+
+public:
+    Tool(int argc, char** argv): AtlasTool(argc, argv) {
+        add_option(new SimpleOption<long>("npts", "Number of columns (default=100000)"));
+        add_option(new SimpleOption<long>("nlev", "Number of levels (default=137)"));
+        add_option(new SimpleOption<long>("niter", "Number of iterations (default=20)"));
+    }
+};
+
+//------------------------------------------------------------------------------
+
+namespace {
+
+template <typename SourceView, typename TargetView>
+void axpy(double a, const SourceView& x, TargetView& y) {
+    const idx_t npts = x.shape(0);
+    const idx_t nlev = x.shape(1);
+    atlas_omp_parallel_for(idx_t n = 0; n < npts; ++n) {
+        for (idx_t k = 0; k < nlev; ++k) {
+            y(n, k) += a * x(n, k);
+        }
+    }
+}
+
+template <typename SourceView>
+double column_sum(const SourceView& x) {
+    const idx_t npts = x.shape(0);
+    const idx_t nlev = x.shape(1);
+    double sum       = 0.;
+    atlas_omp_pragma(omp parallel for schedule(static) reduction(+ : sum))
+    for (idx_t n = 0; n < npts; ++n) {
+        for (idx_t k = 0; k < nlev; ++k) {
+            sum += x(n, k);
+        }
+    }
+    return sum;
+}
+
+// Each target column is a weighted sum of 4 source columns, like an interpolation matrix
+template <typename SourceView, typename TargetView>
+void gather(const SourceView& x, TargetView& y) {
+    const idx_t npts = x.shape(0);
+    const idx_t nlev = x.shape(1);
+    atlas_omp_parallel_for(idx_t n = 0; n < npts; ++n) {
+        for (idx_t k = 0; k < nlev; ++k) {
+            y(n, k) = 0.;
+        }
+        for (idx_t j = 0; j < 4; ++j) {
+            const idx_t m = (n * 7 + j * 13) % npts;
+            for (idx_t k = 0; k < nlev; ++k) {
+                y(n, k) += 0.25 * x(m, k);
+            }
+        }
+    }
+}
+
+template <typename SourceView, typename TargetView>
+double run(const std::string& label, const SourceView& x, TargetView& y, long niter) {
+    double checksum = 0.;
+    Trace t(Here(), label);
+    for (long i = 0; i < niter; ++i) {
+        axpy(0.5, x, y);
+        checksum += column_sum(y);
+        gather(x, y);
+    }
+    t.stop();
+    Log::info() << "  " << std::setw(16) << std::left << label << std::right << std::fixed << std::setprecision(4)
+                << t.elapsed() / double(niter) << " s/iteration" << std::endl;
+    return checksum;
+}
+
+}  // namespace
+
+//------------------------------------------------------------------------------
+
+int Tool::execute(const Args& args) {
+    long npts  = args.getLong("npts", 100000);
+    long nlev  = args.getLong("nlev", 137);
+    long niter = args.getLong("niter", 20);
+
+    Log::info() << "atlas-benchmark-contiguous-view\n"
+                << "  npts: " << npts << "\n"
+                << "  nlev: " << nlev << "\n"
+                << "  niter: " << niter << "\n"
+                << "  threads: " << atlas_omp_get_max_threads() << std::endl;
+
+    Field source("x", array::make_datatype<double>(), array::make_shape(npts, nlev));
+    Field target("y", array::make_datatype<double>(), array::make_shape(npts, nlev));
+    array::make_view<double, 2>(source).assign(1.);
+    array::make_view<double, 2>(target).assign(0.);
+
+    double checksum = 0.;
+    {
+        auto x = array::make_view<const double, 2>(source);
+        auto y = array::make_view<double, 2>(target);
+        checksum += run("ArrayView", x, y, niter);
+    }
+    {
+        auto x = array::make_view<double, 2, array::Contiguous>(source.array());
+        auto y = array::make_view<double, 2, array::Contiguous>(target.array());
+        checksum += run("ContiguousView", x, y, niter);
+    }
+
+    Log::debug() << "checksum: " << checksum << std::endl;
+    return success();
+}
+
+//------------------------------------------------------------------------------
+
+int main(int argc, char** argv) {
+    Tool tool(argc, argv);
+    return tool.start();
+}
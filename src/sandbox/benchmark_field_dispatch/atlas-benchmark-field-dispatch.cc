@@ -0,0 +1,159 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+/**
+ * @file atlas-benchmark-field-dispatch.cc
+ *
+ * Benchmark of the per-field overhead of dispatching on structural attributes of a Field
+ * (levels, variables, horizontal_dimension, dirty, name) for workloads with many small fields.
+ * The cached typed attributes are compared with string-keyed lookups in the Field metadata.
+ * The per-field cost of a halo exchange of a FieldSet of small fields is reported as well.
+ *
+ * Typical usage:
+ *     atlas-benchmark-field-dispatch --nfields=1000 --npts=16 --niter=1000
+ */
+
+#include <algorithm>
+#include <iomanip>
+#include <string>
+#include <vector>
+
+#include "atlas/array.h"
+#include "atlas/field.h"
+#include "atlas/functionspace/StructuredColumns.h"
+#include "atlas/grid.h"
+#include "atlas/option.h"
+#include "atlas/runtime/AtlasTool.h"
+#include "atlas/runtime/Log.h"
+#include "atlas/runtime/Trace.h"
+
+using namespace atlas;
+
+//------------------------------------------------------------------------------
+
+class Tool : public AtlasTool {
+    int execute(const Args& args) override;
+    std::string briefDescription() override {
+        return "Benchmark per-field dispatch overhead of Field attributes for many small fields";
+    }
+    std::string usage() override {
+        return name() + " [--nfields=N] [--npts=N] [--niter=N] [--grid=name] [--help]";
+    }
+
+public:
+    Tool(int argc, char** argv): AtlasTool(argc, argv) {
+        add_option(new SimpleOption<long>("nfields", "Number of fields (default=1000)"));
+        add_option(new SimpleOption<long>("npts", "Number of points per field (default=16)"));
+        add_option(new SimpleOption<long>("niter", "Number of iterations (default=1000)"));
+        add_option(new SimpleOption<std::string>("grid", "Grid for halo exchange of small fields (default=O8)"));
+    }
+};
+
+//------------------------------------------------------------------------------
+
+namespace {
+
+// Mimics the per-field work of e.g. interpolation or statistics: dispatch on attributes, then a tiny kernel
+double kernel(const Field& field, idx_t levels, idx_t variables, idx_t hdim, bool dirty) {
+    auto view  = array::make_view<const double, 1>(field);
+    double sum = levels + variables + hdim + (dirty ? 1. : 0.);
+    for (idx_t i = 0; i < view.size(); ++i) {
+        sum += view(i);
+    }
+    return sum;
+}
+
+void report(const std::string& label, double seconds, long ncalls) {
+    Log::info() << "  " << std::setw(28) << std::left << label << std::right << std::fixed << std::setprecision(1)
+                << 1.e9 * seconds / double(ncalls) << " ns/field" << std::endl;
+}
+
+}  // namespace
+
+//------------------------------------------------------------------------------
+
+int Tool::execute(const Args& args) {
+    long nfields         = args.getLong("nfields", 1000);
+    long npts            = args.getLong("npts", 16);
+    long niter           = args.getLong("niter", 1000);
+    std::string gridname = args.getString("grid", "O8");
+
+    Log::info() << "atlas-benchmark-field-dispatch\n"
+                << "  nfields: " << nfields << "\n"
+                << "  npts: " << npts << "\n"
+                << "  niter: " << niter << "\n"
+                << "  grid: " << gridname << std::endl;
+
+    FieldSet fieldset;
+    for (long f = 0; f < nfields; ++f) {
+        Field field("f" + std::to_string(f), array::make_datatype<double>(), array::make_shape(npts));
+        array::make_view<double, 1>(field).assign(1.);
+        fieldset.add(field);
+    }
+    const FieldSet& fields = fieldset;
+    const long ncalls      = nfields * niter;
+
+    Log::info() << "Per-field dispatch overhead:" << std::endl;
+    double checksum = 0.;
+    {
+        Trace t(Here(), "cached attributes");
+        for (long i = 0; i < niter; ++i) {
+            for (const Field& field : fields) {
+                checksum += kernel(field, field.levels(), field.variables(), field.horizontal_dimension().size(),
+                                   field.dirty()) +
+                            field.name().size();
+            }
+        }
+        t.stop();
+        report("cached attributes", t.elapsed(), ncalls);
+    }
+    {
+        Trace t(Here(), "metadata lookups");
+        for (long i = 0; i < niter; ++i) {
+            for (const Field& field : fields) {
+                const auto& metadata = field.metadata();
+                std::vector<idx_t> hdim{0};
+                metadata.get("horizontal_dimension", hdim);
+                checksum += kernel(field, metadata.get<idx_t>("levels"), metadata.get<idx_t>("variables"),
+                                   hdim.size(), metadata.getBool("dirty", true)) +
+                            metadata.getString("name").size();
+            }
+        }
+        t.stop();
+        report("metadata lookups", t.elapsed(), ncalls);
+    }
+
+    // Halo exchange of many small fields, dominated by per-field overhead
+    functionspace::StructuredColumns fs(Grid(gridname), option::halo(1));
+    FieldSet small_fields;
+    for (long f = 0; f < nfields; ++f) {
+        small_fields.add(fs.createField<double>(option::name("f" + std::to_string(f))));
+    }
+    long nexchanges = std::max(1L, niter / 100);
+    {
+        Trace t(Here(), "halo exchange");
+        for (long i = 0; i < nexchanges; ++i) {
+            small_fields.set_dirty(true);
+            fs.haloExchange(small_fields);
+        }
+        t.stop();
+        report("halo exchange (" + gridname + ")", t.elapsed(), nfields * nexchanges);
+    }
+
+    Log::debug() << "checksum: " << checksum << std::endl;
+    return success();
+}
+
+//------------------------------------------------------------------------------
+
+int main(int argc, char** argv) {
+    Tool tool(argc, argv);
+    return tool.start();
+}
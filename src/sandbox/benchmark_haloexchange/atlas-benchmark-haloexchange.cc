@@ -0,0 +1,147 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+/**
+ * @file atlas-benchmark-haloexchange.cc
+ *
+ * Benchmark of halo-exchange and gather of multi-level fields on StructuredColumns,
+ * comparing serial packing/unpacking of the communication buffers with OpenMP threaded packing.
+ *
+ * Typical hybrid usage:
+ *     OMP_NUM_THREADS=16 mpirun -np 4 atlas-benchmark-haloexchange --grid=O1280 --nlev=137
+ */
+
+#include <iomanip>
+#include <limits>
+#include <string>
+
+#include "atlas/field.h"
+#include "atlas/functionspace/StructuredColumns.h"
+#include "atlas/grid.h"
+#include "atlas/option.h"
+#include "atlas/parallel/Packing.h"
+#include "atlas/parallel/mpi/mpi.h"
+#include "atlas/parallel/omp/omp.h"
+#include "atlas/runtime/AtlasTool.h"
+#include "atlas/runtime/Log.h"
+#include "atlas/runtime/Trace.h"
+
+using namespace atlas;
+
+//------------------------------------------------------------------------------
+
+class Tool : public AtlasTool {
+    int execute(const Args& args) override;
+    std::string briefDescription() override {
+        return "Benchmark serial versus OpenMP threaded packing in halo-exchange and gather";
+    }
+    std::string usage() override { return name() + " [--grid=name] [--nlev=N] [--niter=N] [--halo=N] [--help]"; }
+
+public:
+    Tool(int argc, char** argv): AtlasTool(argc, argv) {
+        add_option(new SimpleOption<std::string>("grid", "Grid unique identifier (default=O320)"));
+        add_option(new SimpleOption<long>("nlev", "Number of levels (default=137)"));
+        add_option(new SimpleOption<long>("niter", "Number of iterations (default=20)"));
+        add_option(new SimpleOption<long>("halo", "Halo size (default=2)"));
+        add_option(new SimpleOption<bool>("gather", "Also benchmark gather (default=true)"));
+    }
+
+private:
+    struct Timings {
+        double halo_exchange{0};
+        double gather{0};
+    };
+    Timings run(const functionspace::StructuredColumns&, Field& field, Field& global, bool gather, long niter);
+};
+
+//------------------------------------------------------------------------------
+
+Tool::Timings Tool::run(const functionspace::StructuredColumns& fs, Field& field, Field& global, bool gather,
+                        long niter) {
+    Timings timings;
+    // warm-up
+    fs.haloExchange(field);
+    for (long i = 0; i < niter; ++i) {
+        mpi::comm().barrier();
+        Trace t(Here(), "halo-exchange");
+        field.set_dirty();
+        fs.haloExchange(field);
+        t.stop();
+        timings.halo_exchange += t.elapsed() / double(niter);
+    }
+    if (gather) {
+        for (long i = 0; i < niter; ++i) {
+            mpi::comm().barrier();
+            Trace t(Here(), "gather");
+            fs.gather(field, global);
+            t.stop();
+            timings.gather += t.elapsed() / double(niter);
+        }
+    }
+    mpi::comm().allReduceInPlace(timings.halo_exchange, eckit::mpi::max());
+    mpi::comm().allReduceInPlace(timings.gather, eckit::mpi::max());
+    return timings;
+}
+
+//------------------------------------------------------------------------------
+
+int Tool::execute(const Args& args) {
+    std::string gridname = args.getString("grid", "O320");
+    long nlev            = args.getLong("nlev", 137);
+    long niter           = args.getLong("niter", 20);
+    long halo            = args.getLong("halo", 2);
+    bool gather          = args.getBool("gather", true);
+
+    Log::info() << "atlas-benchmark-haloexchange\n"
+                << "  grid: " << gridname << "\n"
+                << "  nlev: " << nlev << "\n"
+                << "  halo: " << halo << "\n"
+                << "  MPI tasks: " << mpi::comm().size() << "\n"
+                << "  OpenMP threads per MPI task: " << atlas_omp_get_max_threads() << "\n"
+                << "  packing threshold: " << parallel::packing_omp_threshold() << std::endl;
+
+    functionspace::StructuredColumns fs(Grid(gridname), option::halo(halo) | option::levels(nlev));
+    Field field  = fs.createField<double>(option::name("field"));
+    Field global = fs.createField<double>(option::name("global") | option::global());
+
+    auto view = array::make_view<double, 2>(field);
+    for (idx_t j = 0; j < fs.sizeOwned(); ++j) {
+        for (idx_t k = 0; k < nlev; ++k) {
+            view(j, k) = double(j + k);
+        }
+    }
+
+    const size_t threshold = parallel::packing_omp_threshold();
+
+    parallel::packing_omp_threshold(std::numeric_limits<size_t>::max());
+    Timings serial = run(fs, field, global, gather, niter);
+
+    parallel::packing_omp_threshold(threshold);
+    Timings threaded = run(fs, field, global, gather, niter);
+
+    auto report = [](const std::string& what, double t_serial, double t_threaded) {
+        Log::info() << "  " << std::setw(14) << std::left << what << std::right << std::fixed << std::setprecision(5)
+                    << "serial: " << t_serial << " s    threaded: " << t_threaded << " s    speedup: "
+                    << std::setprecision(2) << t_serial / t_threaded << std::endl;
+    };
+    Log::info() << "Average timings (max over MPI tasks):" << std::endl;
+    report("halo-exchange", serial.halo_exchange, threaded.halo_exchange);
+    if (gather) {
+        report("gather", serial.gather, threaded.gather);
+    }
+    return success();
+}
+
+//------------------------------------------------------------------------------
+
+int main(int argc, char** argv) {
+    Tool tool(argc, argv);
+    return tool.start();
+}
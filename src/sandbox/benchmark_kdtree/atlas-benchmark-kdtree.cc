@@ -0,0 +1,157 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+/**
+ * @file atlas-benchmark-kdtree.cc
+ *
+ * Benchmark of build and search throughput of the kd-tree implementations behind util::IndexKDTree:
+ * the pointer-based eckit::KDTreeMemory ("eckit"), and the implicit tree in flat arrays ("flat"),
+ * with double or single precision coordinates. Searches are timed one point at a time, and batched.
+ *
+ * Typical usage:
+ *     OMP_NUM_THREADS=8 atlas-benchmark-kdtree --source=O1280 --target=O640 --k=4
+ */
+
+#include <iomanip>
+#include <string>
+#include <vector>
+
+#include "atlas/grid.h"
+#include "atlas/parallel/omp/omp.h"
+#include "atlas/runtime/AtlasTool.h"
+#include "atlas/runtime/Log.h"
+#include "atlas/runtime/Trace.h"
+#include "atlas/util/Config.h"
+#include "atlas/util/KDTree.h"
+
+using namespace atlas;
+
+//------------------------------------------------------------------------------
+
+class Tool : public AtlasTool {
+    int execute(const Args& args) override;
+    std::string briefDescription() override { return "Benchmark build and search throughput of kd-trees"; }
+    std::string usage() override {
+        return name() + " [--source=name] [--target=name] [--k=N] [--radius=km] [--help]";
+    }
+
+public:
+    Tool(int argc, char** argv): AtlasTool(argc, argv) {
+        add_option(new SimpleOption<std::string>("source", "Grid of points in the tree (default=O640)"));
+        add_option(new SimpleOption<std::string>("target", "Grid of points to search (default=O320)"));
+        add_option(new SimpleOption<long>("k", "Number of nearest neighbours (default=4)"));
+        add_option(new SimpleOption<double>("radius", "Search radius in km (default=100)"));
+    }
+};
+
+//------------------------------------------------------------------------------
+
+namespace {
+
+void report(const std::string& label, double seconds, size_t n) {
+    Log::info() << "    " << std::setw(20) << std::left << label << std::right << std::fixed << std::setprecision(3)
+                << std::setw(10) << seconds << " s" << std::setw(14) << std::setprecision(0) << double(n) / seconds
+                << " points/s" << std::endl;
+}
+
+}  // namespace
+
+//------------------------------------------------------------------------------
+
+int Tool::execute(const Args& args) {
+    Grid source(args.getString("source", "O640"));
+    Grid target(args.getString("target", "O320"));
+    size_t k      = args.getLong("k", 4);
+    double radius = 1000. * args.getDouble("radius", 100.);
+
+    Log::info() << "atlas-benchmark-kdtree\n"
+                << "  source: " << source.name() << " (" << source.size() << " points)\n"
+                << "  target: " << target.name() << " (" << target.size() << " points)\n"
+                << "  k: " << k << "\n"
+                << "  radius: " << radius / 1000. << " km\n"
+                << "  threads: " << atlas_omp_get_max_threads() << std::endl;
+
+    std::vector<PointLonLat> source_points;
+    std::vector<PointLonLat> target_points;
+    std::vector<idx_t> payloads;
+    source_points.reserve(source.size());
+    target_points.reserve(target.size());
+    payloads.reserve(source.size());
+    for (const auto& p : source.lonlat()) {
+        payloads.emplace_back(source_points.size());
+        source_points.emplace_back(p);
+    }
+    for (const auto& p : target.lonlat()) {
+        target_points.emplace_back(p);
+    }
+
+    auto benchmark = [&](const std::string& label, const util::Config& config) {
+        Log::info() << "  " << label << std::endl;
+        util::IndexKDTree tree(config);
+        {
+            Trace t(Here(), label + " build");
+            tree.build(source_points, payloads);
+            t.stop();
+            report("build", t.elapsed(), source_points.size());
+        }
+        Log::info() << "    footprint: " << tree.footprint() / (1024 * 1024) << " MB" << std::endl;
+
+        double checksum = 0.;
+        {
+            Trace t(Here(), label + " closestPoints");
+            for (const auto& p : target_points) {
+                checksum += tree.closestPoints(p, k).front().distance();
+            }
+            t.stop();
+            report("closestPoints", t.elapsed(), target_points.size());
+        }
+        {
+            Trace t(Here(), label + " closestPoints batch");
+            util::IndexKDTree::PayloadList neighbours;
+            std::vector<double> distances;
+            tree.closestPoints(target_points, k, neighbours, distances);
+            t.stop();
+            report("closestPoints batch", t.elapsed(), target_points.size());
+            checksum += distances.front();
+        }
+        {
+            Trace t(Here(), label + " withinRadius");
+            size_t found = 0;
+            for (const auto& p : target_points) {
+                found += tree.closestPointsWithinRadius(p, radius).size();
+            }
+            t.stop();
+            report("withinRadius", t.elapsed(), target_points.size());
+            checksum += found;
+        }
+        {
+            Trace t(Here(), label + " withinRadius batch");
+            std::vector<util::IndexKDTree::ValueList> within;
+            tree.closestPointsWithinRadius(target_points, radius, within);
+            t.stop();
+            report("withinRadius batch", t.elapsed(), target_points.size());
+            checksum += within.front().size();
+        }
+        Log::debug() << "checksum: " << checksum << std::endl;
+    };
+
+    benchmark("eckit", util::Config("type", "eckit"));
+    benchmark("flat", util::Config("type", "flat"));
+    benchmark("flat (float)", util::Config("type", "flat")("single_precision", true));
+
+    return success();
+}
+
+//------------------------------------------------------------------------------
+
+int main(int argc, char** argv) {
+    Tool tool(argc, argv);
+    return tool.start();
+}
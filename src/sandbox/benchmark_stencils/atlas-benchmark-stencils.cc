@@ -0,0 +1,140 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+/**
+ * @file atlas-benchmark-stencils.cc
+ *
+ * Benchmark of the computation of horizontal interpolation stencils and weights for departure points,
+ * comparing the point-by-point API with the batched API of the Linear, Cubic and QuasiCubic kernels.
+ * Results are reported in points per second.
+ *
+ * Typical usage (single MPI task, as departure points may be anywhere on the globe):
+ *     atlas-benchmark-stencils --grid=O1280 --npts=1000000
+ */
+
+#include <cmath>
+#include <iomanip>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "atlas/functionspace/StructuredColumns.h"
+#include "atlas/grid.h"
+#include "atlas/interpolation/method/structured/kernels/CubicHorizontalKernel.h"
+#include "atlas/interpolation/method/structured/kernels/LinearHorizontalKernel.h"
+#include "atlas/interpolation/method/structured/kernels/QuasiCubicHorizontalKernel.h"
+#include "atlas/option.h"
+#include "atlas/runtime/AtlasTool.h"
+#include "atlas/runtime/Log.h"
+#include "atlas/runtime/Trace.h"
+
+using namespace atlas;
+using namespace atlas::interpolation::method;
+
+//------------------------------------------------------------------------------
+
+class Tool : public AtlasTool {
+    int execute(const Args& args) override;
+    std::string briefDescription() override {
+        return "Benchmark point-by-point versus batched computation of interpolation stencils and weights";
+    }
+    std::string usage() override { return name() + " [--grid=name] [--npts=N] [--niter=N] [--help]"; }
+
+public:
+    Tool(int argc, char** argv): AtlasTool(argc, argv) {
+        add_option(new SimpleOption<std::string>("grid", "Grid unique identifier (default=O320)"));
+        add_option(new SimpleOption<long>("npts", "Number of departure points (default=1000000)"));
+        add_option(new SimpleOption<long>("niter", "Number of iterations (default=10)"));
+    }
+
+private:
+    template <typename Kernel>
+    void run(const std::string& label, const functionspace::StructuredColumns&, const std::vector<double>& x,
+             const std::vector<double>& y, long niter);
+};
+
+//------------------------------------------------------------------------------
+
+template <typename Kernel>
+void Tool::run(const std::string& label, const functionspace::StructuredColumns& fs, const std::vector<double>& x,
+               const std::vector<double>& y, long niter) {
+    Kernel kernel(fs);
+    const idx_t npts = static_cast<idx_t>(x.size());
+
+    std::vector<typename Kernel::Stencil> stencils(npts);
+    std::vector<typename Kernel::Weights> weights(npts);
+    std::vector<double> xp(npts);
+
+    double t_scalar  = 0.;
+    double t_batched = 0.;
+    for (long i = 0; i < niter; ++i) {
+        xp = x;
+        Trace t(Here(), label + " scalar");
+        for (idx_t p = 0; p < npts; ++p) {
+            kernel.compute_stencil(xp[p], y[p], stencils[p]);
+            kernel.compute_weights(xp[p], y[p], stencils[p], weights[p]);
+        }
+        t.stop();
+        t_scalar += t.elapsed();
+    }
+    for (long i = 0; i < niter; ++i) {
+        xp = x;
+        Trace t(Here(), label + " batched");
+        kernel.compute_stencils(npts, xp.data(), y.data(), stencils.data());
+        kernel.compute_weights(npts, xp.data(), y.data(), stencils.data(), weights.data());
+        t.stop();
+        t_batched += t.elapsed();
+    }
+
+    const double points = double(npts) * double(niter);
+    Log::info() << "  " << std::setw(12) << std::left << label << std::right << std::scientific
+                << std::setprecision(3) << "scalar: " << points / t_scalar << " points/s    batched: "
+                << points / t_batched << " points/s    speedup: " << std::fixed << std::setprecision(2)
+                << t_scalar / t_batched << std::endl;
+}
+
+//------------------------------------------------------------------------------
+
+int Tool::execute(const Args& args) {
+    std::string gridname = args.getString("grid", "O320");
+    long npts            = args.getLong("npts", 1000000);
+    long niter           = args.getLong("niter", 10);
+
+    Log::info() << "atlas-benchmark-stencils\n"
+                << "  grid: " << gridname << "\n"
+                << "  npts: " << npts << "\n"
+                << "  niter: " << niter << std::endl;
+
+    functionspace::StructuredColumns fs(Grid(gridname), option::halo(2));
+
+    // Random departure points, reproducible
+    std::mt19937 generator(7);
+    std::uniform_real_distribution<double> lon(0., 360.);
+    std::uniform_real_distribution<double> lat(-90., 90.);
+    std::vector<double> x(npts);
+    std::vector<double> y(npts);
+    for (long p = 0; p < npts; ++p) {
+        x[p] = lon(generator);
+        y[p] = lat(generator);
+    }
+
+    Log::info() << "Throughput of stencil and weight computation:" << std::endl;
+    run<LinearHorizontalKernel>("linear", fs, x, y, niter);
+    run<CubicHorizontalKernel>("cubic", fs, x, y, niter);
+    run<QuasiCubicHorizontalKernel>("quasicubic", fs, x, y, niter);
+    return success();
+}
+
+//------------------------------------------------------------------------------
+
+int main(int argc, char** argv) {
+    Tool tool(argc, argv);
+    return tool.start();
+}
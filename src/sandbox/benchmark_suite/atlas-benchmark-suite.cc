@@ -0,0 +1,545 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+/**
+ * @file atlas-benchmark-suite.cc
+ *
+ * Reproducible performance scenarios, reported as JSON so that results can be compared between releases.
+ *
+ * Scenarios (select with --scenarios=a,b,...):
+ *   grid            grid construction and uid
+ *   functionspace   StructuredColumns setup, mesh generation and NodeColumns setup
+ *   mesh            mesh actions on a freshly generated mesh
+ *   halo-exchange   halo-exchange of a multi-level field, StructuredColumns and NodeColumns
+ *   gather-scatter  gather and scatter of a multi-level field on StructuredColumns
+ *   interpolation   setup and execute of the interpolation methods, from --grid to --target
+ *   trans           inverse spectral transform with the "local" backend
+ *   io              atlas_io write and read of the local part of a multi-level field
+ *
+ * For every measurement the JSON report contains, per iteration, the maximum time over MPI tasks, the number of
+ * bytes moved summed over MPI tasks (payload of the operation: halo values received, field values gathered or
+ * interpolated, bytes written, ...), and the memory high-water mark (maximum resident set size) of the most
+ * demanding MPI task after the measurement.
+ *
+ * Defaults are small so that the suite runs in seconds, e.g.
+ *     mpirun -np 4 atlas-benchmark-suite --output=benchmark.json
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <numeric>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "eckit/system/ResourceUsage.h"
+
+#include "atlas/array.h"
+#include "atlas/field.h"
+#include "atlas/functionspace/NodeColumns.h"
+#include "atlas/functionspace/PointCloud.h"
+#include "atlas/functionspace/Spectral.h"
+#include "atlas/functionspace/StructuredColumns.h"
+#include "atlas/grid.h"
+#include "atlas/grid/Distribution.h"
+#include "atlas/grid/Partitioner.h"
+#include "atlas/grid/Vertical.h"
+#include "atlas/interpolation.h"
+#include "atlas/io/atlas-io.h"
+#include "atlas/library/Library.h"
+#include "atlas/mesh.h"
+#include "atlas/mesh/actions/BuildDualMesh.h"
+#include "atlas/mesh/actions/BuildEdges.h"
+#include "atlas/mesh/actions/BuildHalo.h"
+#include "atlas/mesh/actions/BuildParallelFields.h"
+#include "atlas/mesh/actions/BuildPeriodicBoundaries.h"
+#include "atlas/meshgenerator.h"
+#include "atlas/option.h"
+#include "atlas/parallel/mpi/mpi.h"
+#include "atlas/parallel/omp/omp.h"
+#include "atlas/runtime/AtlasTool.h"
+#include "atlas/runtime/Log.h"
+#include "atlas/runtime/Trace.h"
+#include "atlas/trans/Trans.h"
+#include "atlas/util/Config.h"
+#include "atlas/util/CoordinateEnums.h"
+
+using namespace atlas;
+
+namespace {
+
+//------------------------------------------------------------------------------
+
+/// Collects timings of named measurements, grouped in scenarios
+class Measurements {
+public:
+    /// Time one execution of f, between barriers, and add it to measurement (scenario, name).
+    /// bytes is the payload moved by this MPI task during f.
+    template <typename Function>
+    void time(const std::string& scenario, const std::string& name, double bytes, Function&& f) {
+        Entry& entry = find(scenario, name);
+        mpi::comm().barrier();
+        ATLAS_TRACE(scenario + ": " + name);
+        auto start = std::chrono::steady_clock::now();
+        f();
+        mpi::comm().barrier();
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        entry.seconds.push_back(elapsed.count());
+        entry.bytes.push_back(bytes);
+        entry.memory_high_water = eckit::system::ResourceUsage().maxResidentSetSize();
+    }
+
+    /// Report reduced over MPI tasks; must be called by all MPI tasks
+    std::vector<util::Config> report() const;
+
+    /// Human readable summary of report()
+    static void print(std::ostream&, const std::vector<util::Config>& report);
+
+private:
+    struct Entry {
+        std::string scenario;
+        std::string name;
+        std::vector<double> seconds;
+        std::vector<double> bytes;
+        size_t memory_high_water{0};
+    };
+
+    Entry& find(const std::string& scenario, const std::string& name) {
+        for (auto& entry : entries_) {
+            if (entry.scenario == scenario && entry.name == name) {
+                return entry;
+            }
+        }
+        entries_.emplace_back();
+        entries_.back().scenario = scenario;
+        entries_.back().name     = name;
+        return entries_.back();
+    }
+
+    std::vector<Entry> entries_;
+};
+
+std::vector<util::Config> Measurements::report() const {
+    std::vector<util::Config> report;
+    for (const auto& entry : entries_) {
+        std::vector<double> seconds = entry.seconds;
+        std::vector<double> bytes   = entry.bytes;
+        size_t memory               = entry.memory_high_water;
+        mpi::comm().allReduceInPlace(seconds.data(), seconds.size(), eckit::mpi::max());
+        mpi::comm().allReduceInPlace(bytes.data(), bytes.size(), eckit::mpi::sum());
+        mpi::comm().allReduceInPlace(memory, eckit::mpi::max());
+
+        const double min  = *std::min_element(seconds.begin(), seconds.end());
+        const double max  = *std::max_element(seconds.begin(), seconds.end());
+        const double mean = std::accumulate(seconds.begin(), seconds.end(), 0.) / seconds.size();
+
+        util::Config timings;
+        timings.set("min", min);
+        timings.set("mean", mean);
+        timings.set("max", max);
+        timings.set("iterations", seconds);
+
+        util::Config result;
+        result.set("scenario", entry.scenario);
+        result.set("name", entry.name);
+        result.set("seconds", timings);
+        result.set("bytes", bytes.front());
+        result.set("bandwidth", min > 0. ? bytes.front() / min : 0.);
+        result.set("memory_high_water", memory);
+        report.emplace_back(result);
+    }
+    return report;
+}
+
+void Measurements::print(std::ostream& out, const std::vector<util::Config>& report) {
+    out << std::left << std::setw(16) << "scenario" << std::setw(44) << "name" << std::right << std::setw(12)
+        << "min [s]" << std::setw(12) << "mean [s]" << std::setw(12) << "GB/s" << std::setw(12) << "RSS [MB]"
+        << std::endl;
+    for (const auto& result : report) {
+        util::Config timings = result.getSubConfiguration("seconds");
+        out << std::left << std::setw(16) << result.getString("scenario") << std::setw(44) << result.getString("name")
+            << std::right << std::fixed << std::setprecision(5) << std::setw(12) << timings.getDouble("min")
+            << std::setw(12) << timings.getDouble("mean") << std::setprecision(2) << std::setw(12)
+            << result.getDouble("bandwidth") * 1.e-9 << std::setw(12)
+            << double(result.getUnsigned("memory_high_water")) / (1024. * 1024.) << std::endl;
+    }
+}
+
+//------------------------------------------------------------------------------
+
+void initialise(const FunctionSpace& fs, Field& field) {
+    auto xy    = array::make_view<double, 2>(fs.lonlat());
+    auto value = [&](idx_t n, idx_t k) {
+        return std::cos(xy(n, 0) * M_PI / 180.) * std::cos(xy(n, 1) * M_PI / 180.) + k;
+    };
+    if (field.rank() == 1) {
+        auto view = array::make_view<double, 1>(field);
+        atlas_omp_parallel_for(idx_t n = 0; n < view.shape(0); ++n) { view(n) = value(n, 0); }
+        return;
+    }
+    auto view  = array::make_view<double, 2>(field);
+    idx_t size = view.shape(0);
+    idx_t nlev = view.shape(1);
+    atlas_omp_parallel_for(idx_t n = 0; n < size; ++n) {
+        for (idx_t k = 0; k < nlev; ++k) {
+            view(n, k) = value(n, k);
+        }
+    }
+}
+
+idx_t nb_ghost(const FunctionSpace& fs) {
+    auto ghost  = array::make_view<int, 1>(fs.ghost());
+    idx_t count = 0;
+    for (idx_t n = 0; n < ghost.size(); ++n) {
+        count += ghost(n) ? 1 : 0;
+    }
+    return count;
+}
+
+}  // namespace
+
+//------------------------------------------------------------------------------
+
+class Tool : public AtlasTool {
+    int execute(const Args& args) override;
+    std::string briefDescription() override { return "Suite of performance benchmarks, reported as JSON"; }
+    std::string usage() override {
+        return name() + " [--grid=name] [--target=name] [--nlev=N] [--niter=N] [--scenarios=a,b,...] [--output=file]" +
+               " [--help]";
+    }
+
+public:
+    Tool(int argc, char** argv): AtlasTool(argc, argv) {
+        add_option(new SimpleOption<std::string>("grid", "Grid unique identifier (default=O32)"));
+        add_option(new SimpleOption<std::string>(
+            "target", "Target grid unique identifier for the interpolation scenario (default=O48)"));
+        add_option(new SimpleOption<long>("nlev", "Number of levels (default=10)"));
+        add_option(new SimpleOption<long>("niter", "Number of iterations of each measurement (default=5)"));
+        add_option(new SimpleOption<long>("halo", "Halo size of StructuredColumns (default=2)"));
+        add_option(new SimpleOption<long>("truncation", "Spectral truncation of the trans scenario (default=31)"));
+        add_option(new SimpleOption<std::string>(
+            "scenarios", "Comma separated list of scenarios (default=grid,functionspace,mesh,halo-exchange,"
+                         "gather-scatter,interpolation,trans,io)"));
+        add_option(new SimpleOption<std::string>("output", "JSON output file (default=atlas-benchmark-suite.json)"));
+    }
+
+private:
+    void scenario_grid(Measurements&);
+    void scenario_functionspace(Measurements&);
+    void scenario_mesh(Measurements&);
+    void scenario_halo_exchange(Measurements&);
+    void scenario_gather_scatter(Measurements&);
+    void scenario_interpolation(Measurements&);
+    void scenario_trans(Measurements&);
+    void scenario_io(Measurements&);
+
+    std::string gridname_;
+    std::string targetname_;
+    idx_t nlev_;
+    long niter_;
+    idx_t halo_;
+    int truncation_;
+};
+
+//------------------------------------------------------------------------------
+
+void Tool::scenario_grid(Measurements& measurements) {
+    for (long i = 0; i < niter_; ++i) {
+        measurements.time("grid", "create " + gridname_ + " and uid", 0., [&] { Grid(gridname_).uid(); });
+    }
+    Grid grid(gridname_);
+    std::vector<PointXY> points;
+    points.reserve(grid.size());
+    for (auto p : grid.xy()) {
+        points.emplace_back(p);
+    }
+    const double bytes = mpi::comm().rank() == 0 ? points.size() * sizeof(PointXY) : 0.;
+    for (long i = 0; i < niter_; ++i) {
+        measurements.time("grid", "unstructured uid", bytes, [&] { UnstructuredGrid(points).uid(); });
+    }
+}
+
+void Tool::scenario_functionspace(Measurements& measurements) {
+    Grid grid(gridname_);
+    for (long i = 0; i < niter_; ++i) {
+        measurements.time("functionspace", "StructuredColumns halo=" + std::to_string(halo_), 0.,
+                          [&] { functionspace::StructuredColumns fs(grid, option::halo(halo_)); });
+    }
+    for (long i = 0; i < niter_; ++i) {
+        Mesh mesh;
+        measurements.time("functionspace", "generate mesh", 0.,
+                          [&] { mesh = MeshGenerator("structured").generate(grid); });
+        measurements.time("functionspace", "NodeColumns halo=1", 0.,
+                          [&] { functionspace::NodeColumns fs(mesh, option::halo(1)); });
+    }
+}
+
+void Tool::scenario_mesh(Measurements& measurements) {
+    Grid grid(gridname_);
+    for (long i = 0; i < niter_; ++i) {
+        Mesh mesh = MeshGenerator("structured").generate(grid);
+        measurements.time("mesh", "build_nodes_parallel_fields", 0.,
+                          [&] { mesh::actions::build_nodes_parallel_fields(mesh.nodes()); });
+        measurements.time("mesh", "build_periodic_boundaries", 0.,
+                          [&] { mesh::actions::build_periodic_boundaries(mesh); });
+        measurements.time("mesh", "build_halo", 0., [&] { mesh::actions::build_halo(mesh, 1); });
+        measurements.time("mesh", "build_edges", 0., [&] { mesh::actions::build_edges(mesh); });
+        measurements.time("mesh", "build_median_dual_mesh", 0., [&] { mesh::actions::build_median_dual_mesh(mesh); });
+    }
+}
+
+void Tool::scenario_halo_exchange(Measurements& measurements) {
+    Grid grid(gridname_);
+    auto exchange = [&](const FunctionSpace& fs, const std::string& name) {
+        Field field        = fs.createField<double>(option::levels(nlev_));
+        const double bytes = double(nb_ghost(fs)) * nlev_ * sizeof(double);
+        initialise(fs, field);
+        fs.haloExchange(field);  // warm-up
+        for (long i = 0; i < niter_; ++i) {
+            field.set_dirty();
+            measurements.time("halo-exchange", name, bytes, [&] { fs.haloExchange(field); });
+        }
+    };
+    exchange(functionspace::StructuredColumns(grid, option::halo(halo_)),
+             "StructuredColumns halo=" + std::to_string(halo_));
+    exchange(functionspace::NodeColumns(MeshGenerator("structured").generate(grid), option::halo(1)),
+             "NodeColumns halo=1");
+}
+
+void Tool::scenario_gather_scatter(Measurements& measurements) {
+    functionspace::StructuredColumns fs(Grid(gridname_), option::halo(halo_));
+    Field field        = fs.createField<double>(option::levels(nlev_));
+    Field global       = fs.createField<double>(option::levels(nlev_) | option::global());
+    const double bytes = double(fs.sizeOwned()) * nlev_ * sizeof(double);
+    initialise(fs, field);
+    for (long i = 0; i < niter_; ++i) {
+        measurements.time("gather-scatter", "StructuredColumns gather", bytes, [&] { fs.gather(field, global); });
+    }
+    for (long i = 0; i < niter_; ++i) {
+        measurements.time("gather-scatter", "StructuredColumns scatter", bytes, [&] { fs.scatter(global, field); });
+    }
+}
+
+void Tool::scenario_interpolation(Measurements& measurements) {
+    Grid source_grid(gridname_);
+    Grid target_grid(targetname_);
+
+    // Times setup and execute of interpolation, with fields created on its source and target function spaces,
+    // with given number of levels (0 for single-level fields)
+    auto run = [&](const util::Config& config, const std::function<Interpolation()>& setup, idx_t source_levels,
+                   idx_t target_levels) {
+        const std::string name = config.getString("type") + " " + gridname_ + " to " + targetname_;
+        Interpolation interpolation;
+        for (long i = 0; i < niter_; ++i) {
+            measurements.time("interpolation", name + " setup", 0., [&] { interpolation = setup(); });
+        }
+        Field source_field = interpolation.source().createField<double>(option::levels(source_levels));
+        Field target_field = interpolation.target().createField<double>(option::levels(target_levels));
+        initialise(interpolation.source(), source_field);
+        source_field.haloExchange();
+
+        const double bytes = double(source_field.size() + target_field.size()) * sizeof(double);
+        for (long i = 0; i < niter_; ++i) {
+            measurements.time("interpolation", name + " execute", bytes,
+                              [&] { interpolation.execute(source_field, target_field); });
+        }
+    };
+    functionspace::StructuredColumns source(source_grid, option::halo(2));
+    functionspace::StructuredColumns target(target_grid, grid::MatchingPartitioner(source), option::halo(0));
+    for (std::string method : {"structured-linear2D", "structured-cubic2D", "structured-quasicubic2D"}) {
+        run(option::type(method), [&] { return Interpolation(option::type(method), source, target); }, nlev_,
+            nlev_);
+    }
+
+    // 3D methods interpolate a multi-level field to departure points slightly displaced from each owned point
+    // and level, as in a semi-Lagrangian advection step
+    std::vector<double> z(nlev_);
+    for (idx_t k = 0; k < nlev_; ++k) {
+        z[k] = nlev_ > 1 ? double(k) / double(nlev_ - 1) : 0.;
+    }
+    Vertical vertical(nlev_, z);
+    functionspace::StructuredColumns source_3d(source_grid, vertical, grid::Partitioner("equal_regions"),
+                                               option::halo(2) | util::Config("periodic_points", true));
+    std::vector<PointXYZ> departure_points;
+    departure_points.reserve(size_t(source_3d.sizeOwned()) * nlev_);
+    {
+        auto xy = array::make_view<double, 2>(source_3d.xy());
+        for (idx_t n = 0; n < source_3d.sizeOwned(); ++n) {
+            for (idx_t k = 0; k < nlev_; ++k) {
+                departure_points.emplace_back(xy(n, XX) + 0.1, xy(n, YY), 0.9 * vertical(k) + 0.05);
+            }
+        }
+    }
+    functionspace::PointCloud target_3d(departure_points);
+    for (std::string method : {"structured-linear3D", "structured-cubic3D", "structured-quasicubic3D"}) {
+        auto config = option::type(method) | util::Config("matrix_free", true);
+        run(config, [&] { return Interpolation(config, source_3d, target_3d); }, nlev_, 0);
+    }
+
+    Mesh source_mesh         = MeshGenerator("structured").generate(source_grid);
+    auto target_distribution = grid::MatchingMeshPartitioner(source_mesh).partition(target_grid);
+    Mesh target_mesh         = MeshGenerator("structured").generate(target_grid, target_distribution);
+    functionspace::NodeColumns source_nodes(source_mesh, option::halo(1));
+    functionspace::NodeColumns target_nodes(target_mesh);
+    for (std::string method :
+         {"finite-element", "unstructured-bilinear-lonlat", "nearest-neighbour", "k-nearest-neighbours"}) {
+        run(option::type(method), [&] { return Interpolation(option::type(method), source_nodes, target_nodes); },
+            nlev_, nlev_);
+    }
+
+    // Conservative remapping between the cells of meshes generated from the grids, for single-level fields
+    {
+        auto config = option::type("conservative-spherical-polygon");
+        run(config, [&] { return Interpolation(config, source_grid, target_grid); }, 0, 0);
+    }
+
+    // Grid-box methods are not implemented for more than one MPI task, and only support single-level fields
+    if (mpi::size() == 1) {
+        for (std::string method : {"grid-box-average", "grid-box-maximum"}) {
+            run(option::type(method), [&] { return Interpolation(option::type(method), source_grid, target_grid); },
+                0, 0);
+        }
+    }
+    else {
+        Log::warning() << "Skipping grid-box-average and grid-box-maximum: not implemented for more than one "
+                          "MPI task"
+                       << std::endl;
+    }
+}
+
+void Tool::scenario_trans(Measurements& measurements) {
+    if (not trans::Trans::hasBackend("local")) {
+        Log::warning() << "Skipping scenario trans: backend \"local\" is not available" << std::endl;
+        return;
+    }
+    Grid grid(gridname_);
+    const std::string partitioner = "equal_bands";
+    trans::Trans trans(grid, truncation_, option::type("local") | util::Config("partitioner", partitioner));
+
+    // Spectral and grid-point data of this MPI task, as distributed by the transform
+    const idx_t nb_gridpoints = grid::Distribution(grid, grid::Partitioner(partitioner)).nb_pts()[mpi::rank()];
+    std::vector<double> sp(size_t(trans.spectral().nb_spectral_coefficients()) * nlev_);
+    std::vector<double> gp(size_t(nb_gridpoints) * nlev_);
+    for (size_t i = 0; i < sp.size(); ++i) {
+        sp[i] = std::sin(0.1 * i);
+    }
+    const double bytes = double(sp.size() + gp.size()) * sizeof(double);
+    for (long i = 0; i < niter_; ++i) {
+        measurements.time("trans", "invtrans local T" + std::to_string(truncation_), bytes,
+                          [&] { trans.invtrans(nlev_, sp.data(), gp.data()); });
+    }
+}
+
+void Tool::scenario_io(Measurements& measurements) {
+    functionspace::StructuredColumns fs(Grid(gridname_));
+    std::vector<double> values(size_t(fs.sizeOwned()) * nlev_);
+    std::iota(values.begin(), values.end(), 0.);
+    std::vector<double> read;
+    const double bytes = double(values.size()) * sizeof(double);
+
+    const std::string path = "atlas-benchmark-suite.p" + std::to_string(mpi::comm().rank()) + ".atlas";
+    for (long i = 0; i < niter_; ++i) {
+        measurements.time("io", "write", bytes, [&] {
+            atlas::io::RecordWriter record;
+            record.set("values", atlas::io::ref(values), util::Config("compression", "none"));
+            record.write(path);
+        });
+        measurements.time("io", "read", bytes, [&] {
+            atlas::io::RecordReader record(path);
+            record.read("values", read).wait();
+        });
+    }
+    ATLAS_ASSERT(read == values);
+    std::remove(path.c_str());
+}
+
+//------------------------------------------------------------------------------
+
+int Tool::execute(const Args& args) {
+    gridname_   = args.getString("grid", "O32");
+    targetname_ = args.getString("target", "O48");
+    nlev_       = args.getLong("nlev", 10);
+    niter_      = args.getLong("niter", 5);
+    halo_       = args.getLong("halo", 2);
+    truncation_ = args.getLong("truncation", 31);
+
+    std::vector<std::string> scenarios;
+    {
+        std::stringstream list(
+            args.getString("scenarios", "grid,functionspace,mesh,halo-exchange,gather-scatter,interpolation,trans,io"));
+        std::string scenario;
+        while (std::getline(list, scenario, ',')) {
+            scenarios.emplace_back(scenario);
+        }
+    }
+
+    using Scenario = void (Tool::*)(Measurements&);
+    const std::vector<std::pair<std::string, Scenario>> available{
+        {"grid", &Tool::scenario_grid},
+        {"functionspace", &Tool::scenario_functionspace},
+        {"mesh", &Tool::scenario_mesh},
+        {"halo-exchange", &Tool::scenario_halo_exchange},
+        {"gather-scatter", &Tool::scenario_gather_scatter},
+        {"interpolation", &Tool::scenario_interpolation},
+        {"trans", &Tool::scenario_trans},
+        {"io", &Tool::scenario_io},
+    };
+
+    Measurements measurements;
+    for (const auto& scenario : scenarios) {
+        auto it = std::find_if(available.begin(), available.end(),
+                               [&](const std::pair<std::string, Scenario>& s) { return s.first == scenario; });
+        if (it == available.end()) {
+            Log::error() << "Unknown scenario \"" << scenario << "\"" << std::endl;
+            return failed();
+        }
+        Log::info() << "Running scenario " << scenario << std::endl;
+        (this->*(it->second))(measurements);
+    }
+
+    auto results = measurements.report();
+
+    util::Config configuration;
+    configuration.set("grid", gridname_);
+    configuration.set("target", targetname_);
+    configuration.set("nlev", nlev_);
+    configuration.set("niter", niter_);
+    configuration.set("halo", halo_);
+    configuration.set("truncation", truncation_);
+    configuration.set("mpi_tasks", mpi::comm().size());
+    configuration.set("omp_threads", atlas_omp_get_max_threads());
+
+    util::Config report;
+    report.set("atlas_version", atlas::Library::instance().version());
+    report.set("atlas_git_sha1", atlas::Library::instance().gitsha1());
+    report.set("configuration", configuration);
+    report.set("results", results);
+
+    if (mpi::comm().rank() == 0) {
+        std::string output = args.getString("output", "atlas-benchmark-suite.json");
+        std::ofstream file(output);
+        file << report.json() << std::endl;
+        Log::info() << "Results written to " << output << std::endl;
+    }
+    Measurements::print(Log::info(), results);
+    return success();
+}
+
+//------------------------------------------------------------------------------
+
+int main(int argc, char** argv) {
+    Tool tool(argc, argv);
+    return tool.start();
+}
@@ -73,6 +73,8 @@ Tool::Tool(int argc, char** argv): AtlasTool(argc, argv) {
     add_option(new SimpleOption<std::string>("matrix_multiply", "backend to use in local trans type"));
     add_option(new SimpleOption<bool>("caching", "caching"));
     add_option(new SimpleOption<long>("niter", "number of iterations"));
+    add_option(new SimpleOption<bool>("flt", "also run local trans type with fast (butterfly) Legendre transform"));
+    add_option(new SimpleOption<double>("flt_threshold", "accuracy threshold of fast Legendre transform"));
 }
 
 //-----------------------------------------------------------------------------
@@ -148,6 +150,8 @@ int Tool::execute(const Args& args) {
     args.get("nvordiv", nb_vordiv);
     args.get("niter", niter);
     args.get("caching", caching);
+    bool flt             = args.getBool("flt", false);
+    double flt_threshold = args.getDouble("flt_threshold", 1.e-10);
     int nb_all = nb_scalar + 2 * nb_vordiv;
 
 
@@ -161,6 +165,9 @@ int Tool::execute(const Args& args) {
     Log::info() << "  vor/div fields : " << nb_vordiv << std::endl;
     Log::info() << "  niter          : " << niter << std::endl;
     Log::info() << "  caching        : " << std::boolalpha << caching << std::endl;
+    if (flt) {
+        Log::info() << "  flt threshold  : " << flt_threshold << std::endl;
+    }
     if (caching) {
         Log::info() << "  cache path     : " << atlas::Library::instance().cachePath() << std::endl;
     }
@@ -196,6 +203,12 @@ int Tool::execute(const Args& args) {
     for (size_t i = 0; i < nb_scalar; ++i) {
         sp_scalar[i] = 1.;
     }
+    if (flt) {
+        // all coefficients contribute, so that the accuracy of the fast Legendre transform can be assessed
+        for (size_t i = 0; i < sp_scalar.size(); ++i) {
+            sp_scalar[i] = std::sin(0.1 * i);
+        }
+    }
     for (size_t i = 0; i < nb_vordiv; ++i) {
         sp_vorticity[i]  = 1.;
         sp_divergence[i] = 1.;
@@ -204,25 +217,27 @@ int Tool::execute(const Args& args) {
     for (auto& type : types) {
         ATLAS_TRACE(type);
 
-        trans::Cache cache;
-
-        if (args.getBool("caching", false)) {
-            trans::LegendreCacheCreator cache_creator(grid, truncation, option::type(type));
-            if (cache_creator.supported()) {
-                auto cachefile =
-                    eckit::PathName(atlas::Library::instance().cachePath() + "/leg_" + cache_creator.uid() + ".bin");
-                if (not cachefile.exists()) {
-                    Log::debug() << "Creating cache: " << cachefile
-                                 << " estimated size: " << eckit::Bytes(cache_creator.estimate()) << std::endl;
-                    cache_creator.create(cachefile);
+        auto create_cache = [&](const eckit::Configuration& config) {
+            trans::Cache cache;
+            if (args.getBool("caching", false)) {
+                trans::LegendreCacheCreator cache_creator(grid, truncation, config);
+                if (cache_creator.supported()) {
+                    auto cachefile = eckit::PathName(atlas::Library::instance().cachePath() + "/leg_" +
+                                                     cache_creator.uid() + ".bin");
+                    if (not cachefile.exists()) {
+                        Log::debug() << "Creating cache: " << cachefile
+                                     << " estimated size: " << eckit::Bytes(cache_creator.estimate()) << std::endl;
+                        cache_creator.create(cachefile);
+                    }
+                    Log::debug() << "Reading cache " << cachefile << " size: " << eckit::Bytes(cachefile.size())
+                                 << std::endl;
+                    cache = trans::LegendreCache(cachefile);
                 }
-                Log::debug() << "Reading cache " << cachefile << " size: " << eckit::Bytes(cachefile.size())
-                             << std::endl;
-                cache = trans::LegendreCache(cachefile);
             }
-        }
+            return cache;
+        };
 
-        trans::Trans trans(cache, grid, domain, truncation, option::type(type));
+        trans::Trans trans(create_cache(option::type(type)), grid, domain, truncation, option::type(type));
 
         for (auto backend : linalg_backends.at(type)) {
             linalg::dense::current_backend(backend);
@@ -255,6 +270,33 @@ int Tool::execute(const Args& args) {
                 print("max", max);
             }
         }
+
+        if (type == "local" && flt) {
+            ATLAS_TRACE("local (flt)");
+            util::Config config = option::type(type) | option::flt(true) | option::flt_threshold(flt_threshold);
+            trans::Trans trans_flt(create_cache(config), grid, domain, truncation, config);
+            std::vector<double> gp_flt(gp.size());
+            auto min = std::numeric_limits<double>::max();
+            for (size_t n = 0; n < niter; ++n) {
+                ATLAS_TRACE("invtrans [flt]");
+                auto start = std::chrono::system_clock::now();
+                trans_flt.invtrans(nb_scalar, sp_scalar.data(), nb_vordiv, sp_vorticity.data(), sp_divergence.data(),
+                                   gp_flt.data());
+                std::chrono::duration<double> elapsed_seconds = std::chrono::system_clock::now() - start;
+                min = std::min(min, elapsed_seconds.count());
+            }
+            // compare with the last result of the dense Legendre transform
+            double max_error = 0.;
+            double max_value = 0.;
+            for (size_t j = 0; j < gp.size(); ++j) {
+                max_error = std::max(max_error, std::abs(gp_flt[j] - gp[j]));
+                max_value = std::max(max_value, std::abs(gp[j]));
+            }
+            Log::info() << "type=" << std::setw(6) << std::left << type;
+            Log::info() << "      backend=" << std::setw(24) << std::left << "flt";
+            Log::info() << "      invtrans[min]: " << min << " s"
+                        << "      relative error: " << max_error / max_value << std::endl;
+        }
     }
 
     timer.stop();
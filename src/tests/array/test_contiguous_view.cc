@@ -0,0 +1,101 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#include <memory>
+
+#include "atlas/array.h"
+#include "atlas/array/ContiguousView.h"
+#include "atlas/array/MakeView.h"
+
+#include "tests/AtlasTestEnvironment.h"
+
+using namespace atlas::array;
+
+namespace atlas {
+namespace test {
+
+//-----------------------------------------------------------------------------
+
+CASE("test_make_contiguous_view") {
+    std::unique_ptr<Array> ds{Array::create<double>(4, 5, 7)};
+    auto view = make_view<double, 3>(*ds);
+    for (idx_t i = 0; i < 4; ++i) {
+        for (idx_t j = 0; j < 5; ++j) {
+            for (idx_t k = 0; k < 7; ++k) {
+                view(i, j, k) = 100 * i + 10 * j + k;
+            }
+        }
+    }
+
+    auto cview = make_view<double, 3, Contiguous>(*ds);
+    EXPECT_EQ(cview.rank(), 3);
+    EXPECT_EQ(cview.size(), ds->size());
+    EXPECT(cview.contiguous());
+    for (idx_t d = 0; d < 3; ++d) {
+        EXPECT_EQ(cview.shape(d), view.shape(d));
+        EXPECT_EQ(cview.stride(d), view.stride(d));
+    }
+    EXPECT_EQ(cview.stride<2>(), 1);
+    EXPECT_EQ(cview(3, 4, 6), 346.);
+
+    cview(2, 1, 5) = -1.;
+    EXPECT_EQ(view(2, 1, 5), -1.);
+
+    const Array& const_ds = *ds;
+    auto const_cview      = make_view<double, 3, Contiguous>(const_ds);
+    EXPECT_EQ(const_cview(1, 2, 3), 123.);
+
+    auto from_view = make_contiguous_view(view);
+    EXPECT_EQ(from_view.data(), view.data());
+    EXPECT_EQ(from_view(0, 4, 2), 42.);
+}
+
+CASE("test_contiguous_view_strided_outer_dimensions") {
+    std::unique_ptr<Array> ds{Array::create<double>(4, 5, 7)};
+    auto view = make_view<double, 3>(*ds);
+    for (idx_t i = 0; i < 4; ++i) {
+        for (idx_t j = 0; j < 5; ++j) {
+            for (idx_t k = 0; k < 7; ++k) {
+                view(i, j, k) = 100 * i + 10 * j + k;
+            }
+        }
+    }
+
+    // Slicing the middle dimension keeps unit stride in the innermost dimension
+    auto slice = view.slice(Range::all(), 3, Range::all());
+    EXPECT(is_contiguous_innermost(slice));
+    auto cslice = make_contiguous_view(slice);
+    EXPECT(not cslice.contiguous());
+    EXPECT_EQ(cslice.stride(0), 35);
+    for (idx_t i = 0; i < 4; ++i) {
+        for (idx_t k = 0; k < 7; ++k) {
+            EXPECT_EQ(cslice(i, k), 100 * i + 30 + k);
+        }
+    }
+
+    // Slicing the innermost dimension does not
+    auto strided = view.slice(Range::all(), Range::all(), 2);
+    EXPECT(not is_contiguous_innermost(strided));
+    EXPECT_THROWS(make_contiguous_view(strided));
+
+    // A single value in the innermost dimension does not need unit stride
+    auto single = view.slice(Range::all(), Range::all(), Range(2, 3));
+    EXPECT(is_contiguous_innermost(single));
+    EXPECT_EQ(make_contiguous_view(single)(3, 1, 0), 312.);
+}
+
+//-----------------------------------------------------------------------------
+
+}  // namespace test
+}  // namespace atlas
+
+int main(int argc, char** argv) {
+    return atlas::test::run(argc, argv);
+}
@@ -0,0 +1,106 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#include <string>
+#include <vector>
+
+#include "atlas/field/Field.h"
+#include "atlas/util/Metadata.h"
+
+#include "tests/AtlasTestEnvironment.h"
+
+namespace atlas {
+namespace test {
+
+//-----------------------------------------------------------------------------
+
+CASE("test_field_attributes_defaults") {
+    Field field("field", array::make_datatype<double>(), array::make_shape(10, 3));
+    EXPECT_EQ(field.name(), std::string("field"));
+    EXPECT_EQ(field.levels(), 0);
+    EXPECT_EQ(field.variables(), 0);
+    EXPECT_EQ(field.horizontal_dimension(), (std::vector<idx_t>{0}));
+    EXPECT(field.dirty());
+}
+
+CASE("test_field_attributes_setters_update_metadata") {
+    Field field("field", array::make_datatype<double>(), array::make_shape(10, 3, 2));
+    field.set_levels(3);
+    field.set_variables(2);
+    field.set_horizontal_dimension({0, 2});
+    field.set_dirty(false);
+    field.rename("renamed");
+
+    const Field& f = field;
+    EXPECT_EQ(f.levels(), 3);
+    EXPECT_EQ(f.variables(), 2);
+    EXPECT_EQ(f.horizontal_dimension(), (std::vector<idx_t>{0, 2}));
+    EXPECT(not f.dirty());
+    EXPECT_EQ(f.name(), std::string("renamed"));
+
+    EXPECT_EQ(f.metadata().get<idx_t>("levels"), 3);
+    EXPECT_EQ(f.metadata().get<idx_t>("variables"), 2);
+    EXPECT_EQ(f.metadata().get<std::vector<idx_t>>("horizontal_dimension"), (std::vector<idx_t>{0, 2}));
+    EXPECT(not f.metadata().getBool("dirty"));
+    EXPECT_EQ(f.metadata().getString("name"), std::string("renamed"));
+}
+
+CASE("test_field_attributes_follow_metadata") {
+    Field field("field", array::make_datatype<double>(), array::make_shape(10, 3));
+    EXPECT_EQ(field.levels(), 0);
+    EXPECT(field.dirty());
+
+    field.metadata().set("levels", 3);
+    field.metadata().set("dirty", false);
+    field.metadata().set("name", "other");
+    EXPECT_EQ(field.levels(), 3);
+    EXPECT(not field.dirty());
+    EXPECT_EQ(field.name(), std::string("other"));
+
+    util::Metadata metadata;
+    metadata.set("name", "copy");
+    metadata.set("levels", 5);
+    metadata.set("variables", 4);
+    metadata.set("horizontal_dimension", std::vector<idx_t>{0, 3});
+    field.metadata() = metadata;
+    EXPECT_EQ(field.name(), std::string("copy"));
+    EXPECT_EQ(field.levels(), 5);
+    EXPECT_EQ(field.variables(), 4);
+    EXPECT_EQ(field.horizontal_dimension(), (std::vector<idx_t>{0, 3}));
+    EXPECT(field.dirty());
+}
+
+CASE("test_field_attributes_follow_metadata_through_held_reference") {
+    Field field("field", array::make_datatype<double>(), array::make_shape(10, 3));
+    util::Metadata& metadata = field.metadata();
+    EXPECT_EQ(field.levels(), 0);
+    field.set_dirty(false);
+
+    // Changes made after the reference was handed out are seen by the cached attributes
+    metadata.set("levels", 4);
+    metadata.set("dirty", true);
+    EXPECT_EQ(field.levels(), 4);
+    EXPECT(field.dirty());
+
+    // Reading metadata through non-const access leaves the attributes unchanged
+    EXPECT(not field.metadata().has("missing_value"));
+    field.set_levels(2);
+    EXPECT_EQ(metadata.get<idx_t>("levels"), 2);
+    EXPECT_EQ(field.levels(), 2);
+}
+
+//-----------------------------------------------------------------------------
+
+}  // namespace test
+}  // namespace atlas
+
+int main(int argc, char** argv) {
+    return atlas::test::run(argc, argv);
+}
@@ -0,0 +1,218 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#include <string>
+#include <vector>
+
+#include "atlas/array/ArrayView.h"
+#include "atlas/array/MakeView.h"
+#include "atlas/field/MultiField.h"
+#include "atlas/functionspace/BlockStructuredColumns.h"
+#include "atlas/grid/StructuredGrid.h"
+#include "atlas/option.h"
+#include "atlas/parallel/mpi/mpi.h"
+#include "atlas/util/Config.h"
+
+#include "tests/AtlasTestEnvironment.h"
+
+using atlas::util::Config;
+
+namespace atlas {
+namespace test {
+
+//-----------------------------------------------------------------------------
+
+CASE("test_multifield_ifs") {
+    const idx_t ngptot = 25;
+    const idx_t nproma = 8;
+    const idx_t nlev   = 3;
+    const idx_t nblk   = 4;
+    const std::vector<std::string> names{"temperature", "pressure", "density"};
+    const idx_t nvar = names.size();
+
+    MultiField multifield(Config("creator", "IFS")("ngptot", ngptot)("nproma", nproma)("nlev", nlev)("fields", names)(
+        "datatype", array::make_datatype<double>().str()));
+
+    EXPECT_EQ(multifield.size(), nvar);
+    EXPECT(multifield.has("pressure"));
+    EXPECT(not multifield.has("humidity"));
+    EXPECT(multifield.field_names() == names);
+
+    const Field& combined = multifield.combined();
+    EXPECT_EQ(combined.rank(), 4);
+    EXPECT_EQ(combined.shape(0), nblk);
+    EXPECT_EQ(combined.shape(1), nvar);
+    EXPECT_EQ(combined.shape(2), nlev);
+    EXPECT_EQ(combined.shape(3), nproma);
+    EXPECT_EQ(combined.variables(), nvar);
+    EXPECT_EQ(combined.levels(), nlev);
+    EXPECT_EQ(combined.horizontal_dimension(), (std::vector<idx_t>{0, 3}));
+
+    for (idx_t jvar = 0; jvar < nvar; ++jvar) {
+        Field field = multifield[names[jvar]];
+        EXPECT_EQ(field.name(), names[jvar]);
+        EXPECT_EQ(field.rank(), 3);
+        EXPECT_EQ(field.shape(0), nblk);
+        EXPECT_EQ(field.shape(1), nlev);
+        EXPECT_EQ(field.shape(2), nproma);
+        EXPECT_EQ(field.stride(0), nvar * nlev * nproma);
+        EXPECT_EQ(field.levels(), nlev);
+        EXPECT_EQ(field.horizontal_dimension(), (std::vector<idx_t>{0, 2}));
+        EXPECT(not field.contiguous());
+    }
+
+    // Write through the variables, read through the combined storage
+    for (idx_t jvar = 0; jvar < nvar; ++jvar) {
+        auto view = array::make_view<double, 3>(multifield[jvar]);
+        for (idx_t jblk = 0; jblk < nblk; ++jblk) {
+            for (idx_t jlev = 0; jlev < nlev; ++jlev) {
+                for (idx_t jrof = 0; jrof < nproma; ++jrof) {
+                    view(jblk, jlev, jrof) = 1000 * jvar + 100 * jblk + 10 * jlev + jrof;
+                }
+            }
+        }
+    }
+    auto combined_view = array::make_view<double, 4>(combined);
+    for (idx_t jblk = 0; jblk < nblk; ++jblk) {
+        for (idx_t jvar = 0; jvar < nvar; ++jvar) {
+            for (idx_t jlev = 0; jlev < nlev; ++jlev) {
+                for (idx_t jrof = 0; jrof < nproma; ++jrof) {
+                    EXPECT_EQ(combined_view(jblk, jvar, jlev, jrof), 1000 * jvar + 100 * jblk + 10 * jlev + jrof);
+                }
+            }
+        }
+    }
+
+    // Variables are accessible as a regular FieldSet
+    const FieldSet& fieldset = multifield;
+    EXPECT_EQ(fieldset.size(), nvar);
+    EXPECT_EQ(array::make_view<double, 3>(fieldset["density"])(1, 2, 3), 2000 + 100 + 20 + 3);
+}
+
+CASE("test_multifield_ifs_fortran") {
+    const idx_t nproma = 4;
+    const idx_t nlev   = 2;
+    const idx_t nblk   = 3;
+    const std::vector<std::string> names{"u", "v"};
+
+    MultiField multifield(Config("creator", "IFS")("ngptot", nblk * nproma)("nproma", nproma)("nlev", nlev)(
+        "fields", names)("fortran", true)("kind", 4));
+
+    EXPECT(multifield.combined().datatype() == array::make_datatype<float>());
+    EXPECT(multifield.combined().shape() == array::make_shape(nproma, nlev, 2, nblk));
+
+    auto v = array::make_view<float, 3>(multifield["v"]);
+    EXPECT_EQ(v.shape(0), nproma);
+    EXPECT_EQ(v.shape(1), nlev);
+    EXPECT_EQ(v.shape(2), nblk);
+    v(3, 1, 2) = 42.f;
+    EXPECT_EQ((array::make_view<float, 4>(multifield.combined())(3, 1, 1, 2)), 42.f);
+}
+
+CASE("test_multifield_array") {
+    const idx_t ngptot = 10;
+    const idx_t nlev   = 4;
+    const std::vector<std::string> names{"a", "b", "c"};
+
+    SECTION("with levels") {
+        MultiField multifield(Config("creator", "Array")("ngptot", ngptot)("nlev", nlev)("fields", names));
+        EXPECT(multifield.combined().shape() == array::make_shape(ngptot, nlev, 3));
+        auto b = array::make_view<double, 2>(multifield["b"]);
+        EXPECT_EQ(b.shape(0), ngptot);
+        EXPECT_EQ(b.shape(1), nlev);
+        b(7, 2) = 3.;
+        EXPECT_EQ((array::make_view<double, 3>(multifield.combined())(7, 2, 1)), 3.);
+    }
+    SECTION("without levels") {
+        MultiField multifield(Config("creator", "Array")("ngptot", ngptot)("fields", names));
+        EXPECT(multifield.combined().shape() == array::make_shape(ngptot, 3));
+        EXPECT_EQ(multifield.combined().levels(), 0);
+        auto c = array::make_view<double, 1>(multifield["c"]);
+        EXPECT_EQ(c.shape(0), ngptot);
+        c(5) = 4.;
+        EXPECT_EQ((array::make_view<double, 2>(multifield.combined())(5, 2)), 4.);
+    }
+}
+
+CASE("test_multifield_blockstructuredcolumns") {
+    const idx_t nlev = 5;
+    const std::vector<std::string> names{"u", "v", "t"};
+    const idx_t nvar = names.size();
+
+    auto grid = StructuredGrid("O16");
+    functionspace::BlockStructuredColumns fs(grid, Config("halo", 1)("nproma", 10)("levels", nlev));
+
+    MultiField multifield(Config("creator", "IFS")("ngptot", fs.size())("nproma", fs.nproma())("nlev", nlev)(
+        "fields", names));
+    multifield.set_functionspace(fs);
+    EXPECT_EQ(multifield.combined().shape(0), fs.nblks());
+    EXPECT(multifield["t"].functionspace());
+
+    auto gidx  = array::make_view<gidx_t, 1>(fs.global_index());
+    auto ghost = array::make_view<int, 1>(fs.ghost());
+    auto value = [](gidx_t g, idx_t jvar, idx_t jlev) { return double(1000 * g + 10 * jvar + jlev); };
+
+    // Fill owned points only, through the per-variable views
+    for (idx_t jvar = 0; jvar < nvar; ++jvar) {
+        auto view = array::make_view<double, 3>(multifield[jvar]);
+        for (idx_t jblk = 0; jblk < fs.nblks(); ++jblk) {
+            auto blk = fs.block(jblk);
+            for (idx_t jlev = 0; jlev < nlev; ++jlev) {
+                for (idx_t jrof = 0; jrof < blk.size(); ++jrof) {
+                    idx_t n                = blk.index(jrof);
+                    view(jblk, jlev, jrof) = ghost(n) ? 0. : value(gidx(n), jvar, jlev);
+                }
+            }
+        }
+    }
+
+    // One halo exchange for all variables
+    fs.haloExchange(multifield.combined());
+    for (idx_t jvar = 0; jvar < nvar; ++jvar) {
+        auto view = array::make_view<double, 3>(multifield[jvar]);
+        for (idx_t jblk = 0; jblk < fs.nblks(); ++jblk) {
+            auto blk = fs.block(jblk);
+            for (idx_t jlev = 0; jlev < nlev; ++jlev) {
+                for (idx_t jrof = 0; jrof < blk.size(); ++jrof) {
+                    EXPECT_EQ(view(jblk, jlev, jrof), value(gidx(blk.index(jrof)), jvar, jlev));
+                }
+            }
+        }
+    }
+
+    // One gather for all variables
+    Field global = fs.createField(multifield.combined(), option::global());
+    fs.gather(multifield.combined(), global);
+    if (mpi::rank() == 0) {
+        auto global_view = array::make_view<double, 3>(global);
+        EXPECT_EQ(global_view.shape(0), grid.size());
+        for (idx_t p = 0; p < global_view.shape(0); ++p) {
+            for (idx_t jlev = 0; jlev < nlev; ++jlev) {
+                for (idx_t jvar = 0; jvar < nvar; ++jvar) {
+                    EXPECT_EQ(global_view(p, jlev, jvar), value(p + 1, jvar, jlev));
+                }
+            }
+        }
+    }
+
+    // Checksum of all variables matches that of an independently allocated copy
+    Field copy = fs.createField(multifield.combined());
+    array::make_view<double, 4>(copy).assign(array::make_view<double, 4>(multifield.combined()));
+    EXPECT_EQ(fs.checksum(multifield.combined()), fs.checksum(copy));
+}
+
+//-----------------------------------------------------------------------------
+
+}  // namespace test
+}  // namespace atlas
+
+int main(int argc, char** argv) {
+    return atlas::test::run(argc, argv);
+}
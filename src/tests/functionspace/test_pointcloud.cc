@@ -8,6 +8,8 @@
  */
 
 
+#include <algorithm>
+#include <string>
 #include <vector>
 
 #include "atlas/array.h"
@@ -124,6 +126,62 @@ CASE("test_functionspace_PointCloud create from 3D initializer list") {
 }
 
 
+//-----------------------------------------------------------------------------
+
+CASE("test_functionspace_PointCloud ordering") {
+    std::vector<PointXYZ> points;
+    for (int j = 0; j < 8; ++j) {
+        for (int i = 0; i < 16; ++i) {
+            points.emplace_back(22.5 * i, 70. - 20. * j, 100. * j + i);
+        }
+    }
+    EXPECT(functionspace::PointCloud(points).order().empty());
+
+    for (std::string ordering : {"hilbert", "morton"}) {
+        functionspace::PointCloud pointcloud(points, util::Config("ordering", ordering));
+        EXPECT_EQ(pointcloud.size(), static_cast<idx_t>(points.size()));
+
+        const auto& order = pointcloud.order();
+        EXPECT_EQ(order.size(), points.size());
+        EXPECT(not std::is_sorted(order.begin(), order.end()));
+
+        std::vector<bool> found(points.size(), false);
+        idx_t n = 0;
+        for (const auto& p : pointcloud.iterate().xyz()) {
+            EXPECT(p == points[order[n]]);
+            found[order[n]] = true;
+            ++n;
+        }
+        EXPECT(std::all_of(found.begin(), found.end(), [](bool f) { return f; }));
+    }
+}
+
+CASE("test_functionspace_PointCloud ordering with ghost points") {
+    Field lonlat("lonlat", array::make_datatype<double>(), array::make_shape(5, 2));
+    Field ghost("ghost", array::make_datatype<int>(), array::make_shape(5));
+    array::make_view<double, 2>(lonlat).assign({0., 0., 30., 10., 20., 0., 30., 10., 10., 10.});
+    array::make_view<int, 1>(ghost).assign({0, 0, 0, 1, 0});
+
+    functionspace::PointCloud pointcloud(lonlat, ghost, util::Config("ordering", "hilbert"));
+
+    // Owned points come first along the curve, followed by the ghost point
+    const auto& order = pointcloud.order();
+    EXPECT(order == (std::vector<idx_t>{0, 4, 1, 2, 3}));
+    auto g = array::make_view<int, 1>(pointcloud.ghost());
+    for (idx_t n = 0; n < pointcloud.size(); ++n) {
+        EXPECT_EQ(g(n), n == 4 ? 1 : 0);
+    }
+
+    // The ghost point receives the value of the owned point with the same coordinates
+    Field field = pointcloud.createField<double>(option::name("field"));
+    auto value  = array::make_view<double, 1>(field);
+    for (idx_t n = 0; n < pointcloud.size(); ++n) {
+        value(n) = g(n) ? -1. : order[n];
+    }
+    pointcloud.haloExchange(field);
+    EXPECT_EQ(value(4), 1.);
+}
+
 //-----------------------------------------------------------------------------
 
 CASE("test_createField") {
@@ -427,6 +427,109 @@ CASE("test_functionspace_StructuredColumns halo exchange adjoint test 1") {
 }
 
 
+CASE("test_functionspace_StructuredColumns ordering") {
+    StructuredGrid grid("O16");
+
+    util::Config config;
+    config.set("halo", 2);
+    config.set("levels", 2);
+    functionspace::StructuredColumns fs_ref(grid, grid::Partitioner("equal_regions"), config);
+    EXPECT_EQ(fs_ref.ordering(), std::string("none"));
+
+    Field field_ref = fs_ref.createField<double>(option::name("field"));
+    {
+        auto value = array::make_view<double, 2>(field_ref);
+        auto glb   = array::make_view<gidx_t, 1>(fs_ref.global_index());
+        for (idx_t n = 0; n < fs_ref.sizeOwned(); ++n) {
+            for (idx_t k = 0; k < fs_ref.levels(); ++k) {
+                value(n, k) = 10. * glb(n) + k;
+            }
+        }
+    }
+    fs_ref.haloExchange(field_ref);
+    Field global_ref = fs_ref.createField(field_ref, option::global());
+    fs_ref.gather(field_ref, global_ref);
+
+    for (std::string ordering : {"hilbert", "morton"}) {
+        Log::info() << "ordering = " << ordering << std::endl;
+        config.set("ordering", ordering);
+        functionspace::StructuredColumns fs(grid, grid::Partitioner("equal_regions"), config);
+        EXPECT_EQ(fs.ordering(), ordering);
+        EXPECT_EQ(fs.sizeOwned(), fs_ref.sizeOwned());
+        EXPECT_EQ(fs.sizeHalo(), fs_ref.sizeHalo());
+
+        Field field = fs.createField<double>(option::name("field"));
+        auto value  = array::make_view<double, 2>(field);
+        auto glb    = array::make_view<gidx_t, 1>(fs.global_index());
+        for (idx_t n = 0; n < fs.sizeOwned(); ++n) {
+            for (idx_t k = 0; k < fs.levels(); ++k) {
+                value(n, k) = 10. * glb(n) + k;
+            }
+        }
+        fs.haloExchange(field);
+
+        // index(i,j) is consistent with the point fields, and halo exchange gives the same values as with the
+        // default ordering; halo points keep their (j,i) order
+        auto index_i   = array::make_indexview<idx_t, 1>(fs.index_i());
+        auto index_j   = array::make_indexview<idx_t, 1>(fs.index_j());
+        auto ghost     = array::make_view<int, 1>(fs.ghost());
+        auto part      = array::make_view<int, 1>(fs.partition());
+        auto glb_ref   = array::make_view<gidx_t, 1>(fs_ref.global_index());
+        auto ghost_ref = array::make_view<int, 1>(fs_ref.ghost());
+        auto part_ref  = array::make_view<int, 1>(fs_ref.partition());
+        auto value_ref = array::make_view<double, 2>(field_ref);
+        idx_t reordered{0};
+        for (idx_t j = fs.j_begin_halo(); j < fs.j_end_halo(); ++j) {
+            for (idx_t i = fs.i_begin_halo(j); i < fs.i_end_halo(j); ++i) {
+                const idx_t n     = fs.index(i, j);
+                const idx_t n_ref = fs_ref.index(i, j);
+                EXPECT_EQ(index_i(n), i);
+                EXPECT_EQ(index_j(n), j);
+                EXPECT_EQ(glb(n), glb_ref(n_ref));
+                EXPECT_EQ(ghost(n), ghost_ref(n_ref));
+                EXPECT_EQ(part(n), part_ref(n_ref));
+                EXPECT_EQ(n < fs.sizeOwned(), n_ref < fs_ref.sizeOwned());
+                if (n >= fs.sizeOwned()) {
+                    EXPECT_EQ(n, n_ref);
+                }
+                reordered += (n != n_ref);
+                for (idx_t k = 0; k < fs.levels(); ++k) {
+                    EXPECT_EQ(value(n, k), value_ref(n_ref, k));
+                }
+            }
+        }
+        if (fs.sizeOwned() > 2) {
+            EXPECT(reordered > 0);
+        }
+
+        // gather gives the same global field, and scatter gives back the owned values
+        Field global = fs.createField(field, option::global());
+        fs.gather(field, global);
+        auto valueg     = array::make_view<double, 2>(global);
+        auto valueg_ref = array::make_view<double, 2>(global_ref);
+        EXPECT_EQ(valueg.shape(0), valueg_ref.shape(0));
+        for (idx_t n = 0; n < valueg.shape(0); ++n) {
+            for (idx_t k = 0; k < fs.levels(); ++k) {
+                EXPECT_EQ(valueg(n, k), valueg_ref(n, k));
+            }
+        }
+
+        Field scattered = fs.createField(field);
+        fs.scatter(global, scattered);
+        auto values = array::make_view<double, 2>(scattered);
+        for (idx_t n = 0; n < fs.sizeOwned(); ++n) {
+            for (idx_t k = 0; k < fs.levels(); ++k) {
+                EXPECT_EQ(values(n, k), value(n, k));
+            }
+        }
+    }
+
+    config.set("ordering", "peano");
+    EXPECT_THROWS_AS(functionspace::StructuredColumns{grid, config}, eckit::Exception);
+}
+
+//-----------------------------------------------------------------------------
+
 CASE("create_aligned_field") {
     std::string gridname = eckit::Resource<std::string>("--grid", "S20x3");
     Grid grid(gridname);
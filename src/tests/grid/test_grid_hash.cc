@@ -11,9 +11,12 @@
 #include <algorithm>
 #include <iomanip>
 #include <sstream>
+#include <vector>
 
 #include "atlas/domain.h"
 #include "atlas/grid/Grid.h"
+#include "atlas/grid/Iterator.h"
+#include "atlas/grid/UnstructuredGrid.h"
 #include "atlas/runtime/Log.h"
 #include "atlas/util/Config.h"
 
@@ -53,6 +56,24 @@ CASE("test_global") {
 
 //-----------------------------------------------------------------------------
 
+CASE("test_unstructured") {
+    Grid structured("O32");
+    std::vector<PointXY> points;
+    for (auto p : structured.xy()) {
+        points.emplace_back(p);
+    }
+    UnstructuredGrid grid(points);
+    EXPECT(grid.uid() == UnstructuredGrid(points).uid());
+
+    // Any change of a coordinate, or of the number of points, changes the uid
+    points.back() = PointXY{points.back().x() + 1.e-12, points.back().y()};
+    EXPECT(grid.uid() != UnstructuredGrid(points).uid());
+    points.pop_back();
+    EXPECT(grid.uid() != UnstructuredGrid(points).uid());
+}
+
+//-----------------------------------------------------------------------------
+
 }  // namespace test
 }  // namespace atlas
 
@@ -11,10 +11,12 @@
 #include <algorithm>
 #include <iomanip>
 #include <sstream>
+#include <vector>
 
 #include "atlas/grid/Iterator.h"
 #include "atlas/grid/StructuredGrid.h"
 #include "atlas/grid/UnstructuredGrid.h"
+#include "atlas/projection/Projection.h"
 #include "atlas/runtime/Log.h"
 #include "atlas/util/Config.h"
 
@@ -88,6 +90,61 @@ CASE("test_iterator") {
     }
 }
 
+CASE("test_fill") {
+    std::vector<Grid> grids;
+
+    grids.emplace_back("L4x3");
+    grids.emplace_back("O16");
+    grids.emplace_back("CS-LFR-4");
+    grids.emplace_back("O16", Projection(Config("type", "rotated_lonlat") |
+                                         Config("north_pole", std::vector<double>{-176., 40.})));
+    grids.emplace_back(UnstructuredGrid{{0, 90}, {90, 45}, {180, 0}, {270, -45}, {0, -90}});
+
+    for (auto grid : grids) {
+        Log::debug() << "grid : " << grid.name() << std::endl;
+
+        std::vector<PointXY> points_xy;
+        std::vector<PointLonLat> points_lonlat;
+        for (const PointXY& p : grid.xy()) {
+            points_xy.push_back(p);
+        }
+        for (const PointLonLat& p : grid.lonlat()) {
+            points_lonlat.push_back(p);
+        }
+
+        auto check = [&](idx_t begin, idx_t end) {
+            std::vector<double> xy(2 * (end - begin));
+            std::vector<double> lonlat(2 * (end - begin));
+            grid.fill_xy(begin, end, xy.data());
+            grid.fill_lonlat(begin, end, lonlat.data());
+            for (idx_t n = begin; n < end; ++n) {
+                EXPECT_EQ(xy[2 * (n - begin) + 0], points_xy[n].x());
+                EXPECT_EQ(xy[2 * (n - begin) + 1], points_xy[n].y());
+                EXPECT_APPROX_EQ(lonlat[2 * (n - begin) + 0], points_lonlat[n].lon(), 1.e-12);
+                EXPECT_APPROX_EQ(lonlat[2 * (n - begin) + 1], points_lonlat[n].lat(), 1.e-12);
+            }
+        };
+
+        // Full range, and ranges starting and ending halfway a row of structured grids
+        check(0, grid.size());
+        check(1, grid.size() / 2 + 1);
+        check(grid.size() / 3, grid.size() - 1);
+        check(grid.size(), grid.size());
+
+        // Parallel fill of all points
+        std::vector<double> xy(2 * grid.size());
+        std::vector<double> lonlat(2 * grid.size());
+        grid.fill_xy(xy.data());
+        grid.fill_lonlat(lonlat.data());
+        for (idx_t n = 0; n < grid.size(); ++n) {
+            EXPECT_EQ(xy[2 * n + 0], points_xy[n].x());
+            EXPECT_EQ(xy[2 * n + 1], points_xy[n].y());
+            EXPECT_APPROX_EQ(lonlat[2 * n + 0], points_lonlat[n].lon(), 1.e-12);
+            EXPECT_APPROX_EQ(lonlat[2 * n + 1], points_lonlat[n].lat(), 1.e-12);
+        }
+    }
+}
+
 //-----------------------------------------------------------------------------
 
 }  // namespace test
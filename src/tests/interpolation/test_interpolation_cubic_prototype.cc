@@ -9,6 +9,7 @@
  */
 
 #include <algorithm>
+#include <cmath>
 #include <iomanip>
 
 #include "atlas/array.h"
@@ -19,6 +20,9 @@
 #include "atlas/grid/Partitioner.h"
 #include "atlas/grid/StructuredGrid.h"
 #include "atlas/interpolation.h"
+#include "atlas/interpolation/method/structured/kernels/CubicHorizontalKernel.h"
+#include "atlas/interpolation/method/structured/kernels/LinearHorizontalKernel.h"
+#include "atlas/interpolation/method/structured/kernels/QuasiCubicHorizontalKernel.h"
 #include "atlas/mesh/Mesh.h"
 #include "atlas/meshgenerator.h"
 #include "atlas/output/Gmsh.h"
@@ -249,6 +253,64 @@ CASE("test horizontal cubic interpolation triplets") {
 
 //-----------------------------------------------------------------------------
 
+template <typename Kernel>
+void check_batched_stencils_and_weights(const StructuredColumns& fs, const Field& field) {
+    Log::info() << "check_batched_stencils_and_weights<" << Kernel::className() << ">" << std::endl;
+    Kernel kernel(fs);
+    auto f = array::make_view<double, 1>(field);
+
+    // Number of points deliberately not a multiple of the batch size
+    const idx_t npts = 101;
+    std::vector<double> x(npts);
+    std::vector<double> y(npts);
+    for (idx_t p = 0; p < npts; ++p) {
+        x[p] = std::fmod(37.3 * p, 360.);
+        y[p] = -90. + std::fmod(17.9 * p, 180.);
+    }
+    x[0] = 0.;
+    x[1] = 360.;
+    y[2] = 90.;
+    y[3] = -90.;
+
+    std::vector<typename Kernel::Stencil> stencils(npts);
+    std::vector<typename Kernel::Weights> weights(npts);
+    std::vector<double> x_batched = x;
+    kernel.compute_stencils(npts, x_batched.data(), y.data(), stencils.data());
+    kernel.compute_weights(npts, x_batched.data(), y.data(), stencils.data(), weights.data());
+
+    for (idx_t p = 0; p < npts; ++p) {
+        typename Kernel::Stencil stencil;
+        typename Kernel::Weights weight;
+        kernel.compute_stencil(x[p], y[p], stencil);
+        kernel.compute_weights(x[p], y[p], stencil, weight);
+        EXPECT_EQ(x_batched[p], x[p]);
+        for (idx_t j = 0; j < Kernel::stencil_width(); ++j) {
+            EXPECT_EQ(stencils[p].j(j), stencil.j(j));
+            EXPECT_EQ(stencils[p].i(0, j), stencil.i(0, j));
+        }
+        EXPECT_EQ(kernel.interpolate(stencils[p], weights[p], f), kernel.interpolate(stencil, weight, f));
+    }
+}
+
+CASE("test horizontal stencils and weights in batches") {
+    if (mpi::comm().size() == 1) {
+        StructuredColumns fs(StructuredGrid("O16"), option::halo(2));
+
+        Field field = fs.createField<double>();
+        auto f      = array::make_view<double, 1>(field);
+        auto xy     = array::make_view<double, 2>(fs.xy());
+        for (idx_t j = 0; j < fs.size(); ++j) {
+            f(j) = std::cos(xy(j, XX) * M_PI / 180.) * std::sin(xy(j, YY) * M_PI / 180.);
+        }
+
+        check_batched_stencils_and_weights<interpolation::method::LinearHorizontalKernel>(fs, field);
+        check_batched_stencils_and_weights<interpolation::method::CubicHorizontalKernel>(fs, field);
+        check_batched_stencils_and_weights<interpolation::method::QuasiCubicHorizontalKernel>(fs, field);
+    }
+}
+
+//-----------------------------------------------------------------------------
+
 CASE("test 3d cubic interpolation") {
     const double tolerance = 1.e-15;
 
@@ -393,6 +455,46 @@ CASE("test 3d cubic interpolation") {
             }
         }
     }
+
+    SECTION("SL-like with precomputed stencils and weights") {
+        auto dp_field = fs.createField<double>(option::variables(3));
+        {
+            auto iterator     = departure_points.iterate().xyz().begin();
+            auto iterator_end = departure_points.iterate().xyz().end();
+            auto dp           = array::make_view<double, 3>(dp_field);
+            for (idx_t n = 0; n < dp.shape(0); ++n) {
+                for (idx_t k = 0; k < dp.shape(1); ++k) {
+                    PointXYZ p{0, 0, 0};
+                    if (iterator != iterator_end) {
+                        p = *iterator;
+                        ++iterator;
+                    }
+                    dp(n, k, LON) = p.x();
+                    dp(n, k, LAT) = p.y();
+                    dp(n, k, ZZ)  = p.z();
+                }
+            }
+        }
+        Interpolation matrix_free(option::type("tricubic") | Config("matrix_free", true), fs, dp_field);
+        Interpolation precomputed(option::type("tricubic") | Config("matrix_free", false), fs, dp_field);
+
+        Field output_matrix_free = fs.createField<double>();
+        matrix_free.execute(input, output_matrix_free);
+
+        // Apply the same stencils and weights several times, as done for several fields
+        for (int i = 0; i < 2; ++i) {
+            Field output = fs.createField<double>();
+            precomputed.execute(input, output);
+
+            auto expected = array::make_view<double, 2>(output_matrix_free);
+            auto computed = array::make_view<double, 2>(output);
+            for (idx_t n = 0; n < computed.shape(0); ++n) {
+                for (idx_t k = 0; k < computed.shape(1); ++k) {
+                    EXPECT_EQ(computed(n, k), expected(n, k));
+                }
+            }
+        }
+    }
 }
 
 }  // namespace test
@@ -205,6 +205,70 @@ CASE("Interpolation of rank 2 field with MissingValue") {
 }
 
 
+CASE("Interpolation of rank 3 field with level-dependent MissingValue") {
+    RectangularDomain domain({0, 2}, {0, 2}, "degrees");
+    Grid gridA("L90", domain);
+
+    Mesh meshA = MeshGenerator("structured").generate(gridA);
+
+    int nlevels    = 3;
+    int nvariables = 2;
+    functionspace::NodeColumns fsA(meshA);
+    Field fieldA =
+        fsA.createField<double>(option::name("A") | option::levels(nlevels) | option::variables(nvariables));
+
+    fieldA.metadata().set("missing_value", missingValue);
+    fieldA.metadata().set("missing_value_epsilon", missingValueEps);
+    fieldA.metadata().set("missing_value_type", "equals");
+
+    // level 0: centre node missing, level 1: nothing missing, level 2: everything missing
+    auto viewA = array::make_view<double, 3>(fieldA);
+    for (idx_t j = 0; j < viewA.shape(0); ++j) {
+        for (idx_t v = 0; v < nvariables; ++v) {
+            viewA(j, 0, v) = j == 4 ? missingValue : 1. + 10. * v;
+            viewA(j, 1, v) = 2. + 10. * v;
+            viewA(j, 2, v) = missingValue;
+        }
+    }
+
+    functionspace::PointCloud fsB({PointLonLat{0.1, 0.1}, PointLonLat{0.9, 0.9}});
+
+    auto check = [&](const std::string& non_linear, bool expect_missing_at_0_0, bool expect_missing_at_1_0) {
+        Interpolation interpolation(Config("type", "finite-element").set("non_linear", non_linear), fsA, fsB);
+
+        // Execute twice: the shared interpolation matrix must not be modified by the non-linear corrections
+        for (int repeat = 0; repeat < 2; ++repeat) {
+            Field fieldB =
+                fsB.createField<double>(option::name("B") | option::levels(nlevels) | option::variables(nvariables));
+            auto viewB = array::make_view<double, 3>(fieldB);
+
+            interpolation.execute(fieldA, fieldB);
+
+            MissingValue mv(fieldB);
+            EXPECT(mv);
+            for (idx_t v = 0; v < nvariables; ++v) {
+                EXPECT(mv(viewB(0, 0, v)) == expect_missing_at_0_0);
+                EXPECT(mv(viewB(1, 0, v)) == expect_missing_at_1_0);
+                if (not expect_missing_at_0_0) {
+                    EXPECT_APPROX_EQ(viewB(0, 0, v), 1. + 10. * v, 1.e-12);
+                }
+                if (not expect_missing_at_1_0) {
+                    EXPECT_APPROX_EQ(viewB(1, 0, v), 1. + 10. * v, 1.e-12);
+                }
+                EXPECT_APPROX_EQ(viewB(0, 1, v), 2. + 10. * v, 1.e-12);
+                EXPECT_APPROX_EQ(viewB(1, 1, v), 2. + 10. * v, 1.e-12);
+                EXPECT(mv(viewB(0, 2, v)));
+                EXPECT(mv(viewB(1, 2, v)));
+            }
+        }
+    };
+
+    SECTION("missing-if-all-missing") { check("missing-if-all-missing", false, false); }
+    SECTION("missing-if-any-missing") { check("missing-if-any-missing", true, true); }
+    SECTION("missing-if-heaviest-missing") { check("missing-if-heaviest-missing", false, true); }
+}
+
+
 }  // namespace test
 }  // namespace atlas
 
@@ -330,6 +330,45 @@ CASE("sparse_matrix matrix multiply (spmm)") {
 
 //----------------------------------------------------------------------------------------------------------------------
 
+CASE("sparse_matrix transpose multiply add, without transposing the matrix") {
+    // A =  2  . -3
+    //      .  2  .
+    //      .  .  2
+    //      1  1  .
+    SparseMatrix A{4, 3, {{0, 0, 2.}, {0, 2, -3.}, {1, 1, 2.}, {2, 2, 2.}, {3, 0, 1.}, {3, 1, 1.}}};
+
+    SparseMatrixRowColouring colouring(A);
+    EXPECT(not colouring.empty());
+    // rows 0 and 3 share column 0, rows 1 and 3 share column 1, rows 0 and 2 share column 2
+    EXPECT(colouring.colours() >= 2);
+    for (idx_t colour = 0; colour < colouring.colours(); ++colour) {
+        std::vector<int> count(A.cols(), 0);
+        for (idx_t jr = colouring.begin(colour); jr < colouring.end(colour); ++jr) {
+            const idx_t r = colouring.rows()[jr];
+            for (auto c = A.outer()[r]; c < A.outer()[r + 1]; ++c) {
+                EXPECT_EQ(++count[A.inner()[c]], 1);
+            }
+        }
+    }
+
+    SECTION("rank 1") {
+        ArrayVector<double> x(Vector{1., 2., 3., 4.});
+        ArrayVector<double> y(Vector{1., 1., 1.});
+        sparse_matrix_multiply_add_transpose(A, colouring, x.view(), y.view());
+        // y = 1 + A^T x
+        expect_equal(y.view(), Vector{7., 9., 4.});
+    }
+
+    SECTION("rank 2") {
+        ArrayMatrix<float> x(Matrix{{1., 2.}, {2., 4.}, {3., 6.}, {4., 8.}});
+        ArrayMatrix<float> y(Matrix{{0., 0.}, {0., 0.}, {0., 0.}});
+        sparse_matrix_multiply_add_transpose(A, colouring, x.view(), y.view());
+        expect_equal(y.view(), ArrayMatrix<float>(Matrix{{6., 12.}, {8., 16.}, {3., 6.}}).view());
+    }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
 }  // namespace test
 }  // namespace atlas
 
@@ -8,6 +8,9 @@
  * nor does it submit to any jurisdiction.
  */
 
+#include <algorithm>
+
+#include "atlas/array/MakeView.h"
 #include "atlas/grid.h"
 #include "atlas/mesh/Mesh.h"
 #include "atlas/mesh/Nodes.h"
@@ -128,6 +131,39 @@ CASE("test_create_healpix_mesh") {
 
 //-----------------------------------------------------------------------------
 
+CASE("test_partitioned_healpix_mesh") {
+    // Generate all parts of a partitioned mesh from a single task: every cell must be owned by exactly one part
+    Grid grid("H8");
+    const int nb_parts = 4;
+    for (std::string partitioner : {"bands", "equal_regions"}) {
+        Distribution distribution(grid, Partitioner(partitioner, nb_parts));
+        for (std::string pole_elements : {"quads", "pentagons"}) {
+            SECTION(partitioner + " " + pole_elements) {
+                std::vector<gidx_t> cells;
+                for (int part = 0; part < nb_parts; ++part) {
+                    util::Config opts;
+                    opts.set("nb_parts", nb_parts);
+                    opts.set("part", part);
+                    opts.set("pole_elements", pole_elements);
+                    Mesh mesh    = HealpixMeshGenerator(opts).generate(grid, distribution);
+                    auto glb_idx = array::make_view<gidx_t, 1>(mesh.cells().global_index());
+                    for (idx_t jcell = 0; jcell < glb_idx.size(); ++jcell) {
+                        cells.emplace_back(glb_idx(jcell));
+                    }
+                }
+                const gidx_t nb_cells = 12 * 8 * 8 + (pole_elements == "quads" ? 8 : 0);
+                std::sort(cells.begin(), cells.end());
+                EXPECT_EQ(static_cast<gidx_t>(cells.size()), nb_cells);
+                EXPECT(std::adjacent_find(cells.begin(), cells.end()) == cells.end());
+                EXPECT_EQ(cells.front(), 1);
+                EXPECT_EQ(cells.back(), nb_cells);
+            }
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+
 CASE("construction by integer") {
     EXPECT(HealpixGrid(3) == Grid("H3"));
 }
@@ -8,6 +8,7 @@
  * nor does it submit to any jurisdiction.
  */
 
+#include "atlas/functionspace/NodeColumns.h"
 #include "atlas/grid/Grid.h"
 #include "atlas/library/config.h"
 #include "atlas/mesh/HybridElements.h"
@@ -512,6 +513,55 @@ CASE("test_build_edges_triangles_only") {
 
 //-----------------------------------------------------------------------------
 
+CASE("test_accumulate_facets_sorted_matches_node_to_facet") {
+    struct Facets {
+        std::vector<idx_t> nodes;
+        std::vector<idx_t> to_elem;
+        std::vector<idx_t> halo_offsets;
+        idx_t nb_facets;
+        idx_t nb_inner_facets;
+        idx_t missing_value;
+    };
+    auto check = [](const std::string& gridname, const Config& config, int halo) {
+        Log::info() << "grid " << gridname << ", halo " << halo << std::endl;
+        Mesh mesh = StructuredMeshGenerator(config).generate(Grid(gridname));
+        functionspace::NodeColumns(mesh, option::halo(halo));
+
+        Facets sorted;
+        Facets reference;
+        mesh::detail::accumulate_facets_ordered_by_halo(mesh.cells(), mesh.nodes(), sorted.nodes, sorted.to_elem,
+                                                        sorted.nb_facets, sorted.nb_inner_facets,
+                                                        sorted.missing_value, sorted.halo_offsets);
+        mesh::detail::accumulate_facets_ordered_by_halo_node_to_facet(
+            mesh.cells(), mesh.nodes(), reference.nodes, reference.to_elem, reference.nb_facets,
+            reference.nb_inner_facets, reference.missing_value, reference.halo_offsets);
+        EXPECT_EQ(sorted.nb_facets, reference.nb_facets);
+        EXPECT_EQ(sorted.nb_inner_facets, reference.nb_inner_facets);
+        EXPECT_EQ(sorted.missing_value, reference.missing_value);
+        EXPECT(sorted.halo_offsets == reference.halo_offsets);
+        EXPECT(sorted.nodes == reference.nodes);
+        EXPECT(sorted.to_elem == reference.to_elem);
+
+        sorted    = Facets();
+        reference = Facets();
+        mesh::detail::accumulate_facets(mesh.cells(), mesh.nodes(), sorted.nodes, sorted.to_elem, sorted.nb_facets,
+                                        sorted.nb_inner_facets, sorted.missing_value);
+        mesh::detail::accumulate_facets_node_to_facet(mesh.cells(), mesh.nodes(), reference.nodes, reference.to_elem,
+                                                      reference.nb_facets, reference.nb_inner_facets,
+                                                      reference.missing_value);
+        EXPECT_EQ(sorted.nb_facets, reference.nb_facets);
+        EXPECT_EQ(sorted.nb_inner_facets, reference.nb_inner_facets);
+        EXPECT(sorted.nodes == reference.nodes);
+        EXPECT(sorted.to_elem == reference.to_elem);
+    };
+    check("O16", Config(), 0);
+    check("O16", Config(), 2);
+    check("N16", Config("triangulate", true), 1);
+    check("F8", Config("patch_pole", true), 1);
+}
+
+//-----------------------------------------------------------------------------
+
 CASE("test_pole_edge_default") {
     auto pole_edges = [](const Grid& grid) {
         auto mesh = StructuredMeshGenerator().generate(grid);
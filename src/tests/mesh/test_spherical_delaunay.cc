@@ -0,0 +1,148 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "atlas/array/MakeView.h"
+#include "atlas/grid.h"
+#include "atlas/mesh/HybridElements.h"
+#include "atlas/mesh/Mesh.h"
+#include "atlas/mesh/Nodes.h"
+#include "atlas/mesh/detail/SphericalDelaunay.h"
+#include "atlas/meshgenerator.h"
+#include "atlas/util/Config.h"
+#include "atlas/util/CoordinateEnums.h"
+#include "atlas/util/Point.h"
+
+#include "tests/AtlasTestEnvironment.h"
+
+using atlas::util::Config;
+
+namespace atlas {
+namespace test {
+
+//-----------------------------------------------------------------------------
+
+// Checks that triangles close the sphere, with outward normals, and form the convex hull of the points
+void check_convex_hull(const std::vector<PointXYZ>& points, const std::vector<idx_t>& triangles) {
+    using Vector  = std::array<double, 3>;
+    const idx_t n = points.size();
+    const idx_t nb_triangles = triangles.size() / 3;
+    EXPECT_EQ(nb_triangles, 2 * n - 4);
+
+    auto vector = [&](idx_t i) -> Vector { return {points[i].x(), points[i].y(), points[i].z()}; };
+
+    std::vector<std::pair<idx_t, idx_t>> edges;
+    for (idx_t t = 0; t < nb_triangles; ++t) {
+        const Vector a = vector(triangles[3 * t]);
+        const Vector b = vector(triangles[3 * t + 1]);
+        const Vector c = vector(triangles[3 * t + 2]);
+        const Vector u{b[0] - a[0], b[1] - a[1], b[2] - a[2]};
+        const Vector v{c[0] - a[0], c[1] - a[1], c[2] - a[2]};
+        const Vector normal{u[1] * v[2] - u[2] * v[1], u[2] * v[0] - u[0] * v[2], u[0] * v[1] - u[1] * v[0]};
+        const double norm = std::sqrt(normal[0] * normal[0] + normal[1] * normal[1] + normal[2] * normal[2]);
+        EXPECT(normal[0] * a[0] + normal[1] * a[1] + normal[2] * a[2] > 0.);
+        for (idx_t i = 0; i < n; ++i) {
+            const Vector p = vector(i);
+            EXPECT(normal[0] * (p[0] - a[0]) + normal[1] * (p[1] - a[1]) + normal[2] * (p[2] - a[2]) <= 1.e-12 * norm);
+        }
+        for (idx_t j = 0; j < 3; ++j) {
+            edges.emplace_back(triangles[3 * t + j], triangles[3 * t + (j + 1) % 3]);
+        }
+    }
+
+    // Each directed edge appears once, and is matched by the reversed edge of the neighbouring triangle
+    std::sort(edges.begin(), edges.end());
+    EXPECT(std::adjacent_find(edges.begin(), edges.end()) == edges.end());
+    for (const auto& edge : edges) {
+        EXPECT(std::binary_search(edges.begin(), edges.end(), std::make_pair(edge.second, edge.first)));
+    }
+}
+
+CASE("test_spherical_delaunay_random_points") {
+    std::mt19937 generator(42);
+    std::normal_distribution<double> normal;
+    std::vector<PointXYZ> points;
+    for (idx_t i = 0; i < 500; ++i) {
+        PointXYZ p{normal(generator), normal(generator), normal(generator)};
+        p /= std::sqrt(p.x() * p.x() + p.y() * p.y() + p.z() * p.z());
+        points.emplace_back(p);
+    }
+    check_convex_hull(points, mesh::detail::spherical_delaunay(points));
+}
+
+CASE("test_spherical_delaunay_cocircular_points") {
+    // Regular longitude-latitude grid with poles: many cocircular points
+    const idx_t nx = 16;
+    const idx_t ny = 8;
+    std::vector<PointXYZ> points{{0., 0., 1.}, {0., 0., -1.}};
+    for (idx_t j = 1; j < ny; ++j) {
+        for (idx_t i = 0; i < nx; ++i) {
+            const double lat = M_PI_2 - M_PI * j / ny;
+            const double lon = 2. * M_PI * i / nx;
+            points.emplace_back(
+                PointXYZ{std::cos(lat) * std::cos(lon), std::cos(lat) * std::sin(lon), std::sin(lat)});
+        }
+    }
+    check_convex_hull(points, mesh::detail::spherical_delaunay(points));
+}
+
+CASE("test_spherical_delaunay_duplicate_points") {
+    std::vector<PointXYZ> points{{1., 0., 0.}, {0., 1., 0.}, {0., 0., 1.}, {0., 0., -1.}, {1., 0., 0.}};
+    EXPECT_THROWS(mesh::detail::spherical_delaunay(points));
+}
+
+CASE("test_delaunay_meshgenerator_native") {
+    auto check_mesh = [](const Grid& grid, idx_t nb_unique_points) {
+        Mesh mesh = MeshGenerator("delaunay", Config("method", "native")).generate(grid);
+        EXPECT_EQ(mesh.nodes().size(), grid.size());
+        EXPECT_EQ(mesh.cells().size(), 2 * nb_unique_points - 4);
+
+        // All unique nodes are part of the triangulation
+        std::vector<int> used(mesh.nodes().size(), 0);
+        const auto& connectivity = mesh.cells().node_connectivity();
+        for (idx_t jcell = 0; jcell < mesh.cells().size(); ++jcell) {
+            for (idx_t j = 0; j < 3; ++j) {
+                used[connectivity(jcell, j)] = 1;
+            }
+        }
+        EXPECT_EQ(std::count(used.begin(), used.end(), 1), nb_unique_points);
+    };
+
+    SECTION("O16") {
+        Grid grid("O16");
+        check_mesh(grid, grid.size());
+    }
+    SECTION("unstructured with duplicates") {
+        std::vector<PointXY> points;
+        for (double lat = -80.; lat <= 80.; lat += 20.) {
+            for (double lon = 0.; lon < 360.; lon += 30.) {
+                points.emplace_back(lon + 0.1 * lat, lat);
+            }
+        }
+        const idx_t nb_unique_points = points.size();
+        points.emplace_back(points[7]);
+        points.emplace_back(points[19]);
+        check_mesh(UnstructuredGrid(points), nb_unique_points);
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+}  // namespace test
+}  // namespace atlas
+
+int main(int argc, char** argv) {
+    return atlas::test::run(argc, argv);
+}
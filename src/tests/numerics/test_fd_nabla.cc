@@ -0,0 +1,265 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <string>
+
+#include "atlas/array/MakeView.h"
+#include "atlas/field/Field.h"
+#include "atlas/functionspace/StructuredColumns.h"
+#include "atlas/grid/Grid.h"
+#include "atlas/numerics/Nabla.h"
+#include "atlas/numerics/fd/Method.h"
+#include "atlas/option.h"
+#include "atlas/parallel/mpi/mpi.h"
+#include "atlas/util/Config.h"
+#include "atlas/util/CoordinateEnums.h"
+#include "atlas/util/Earth.h"
+
+#include "tests/AtlasTestEnvironment.h"
+
+using namespace atlas::numerics;
+
+namespace atlas {
+namespace test {
+
+//-----------------------------------------------------------------------------
+
+const double deg2rad = M_PI / 180.;
+const double radius  = util::Earth::radius();
+
+array::LocalView<double, 3> make_vectorview(Field& field) {
+    using array::Range;
+    return field.levels() ? array::make_view<double, 3>(field).slice(Range::all(), Range::all(), Range::all())
+                          : array::make_view<double, 2>(field).slice(Range::all(), Range::dummy(), Range::all());
+}
+
+array::LocalView<double, 2> make_scalarview(Field& field) {
+    using array::Range;
+    return field.levels() ? array::make_view<double, 2>(field).slice(Range::all(), Range::all())
+                          : array::make_view<double, 1>(field).slice(Range::all(), Range::dummy());
+}
+
+/// @brief Maximum over owned points with |lat| < max_lat of |f(lon,lat) - g(lon,lat)|, over all levels and tasks
+double max_error(const functionspace::StructuredColumns& fs, const std::function<double(idx_t, idx_t)>& f,
+                 const std::function<double(double, double)>& g, idx_t nlev, double max_lat = 90.) {
+    const auto xy = array::make_view<double, 2>(fs.xy());
+    double error  = 0.;
+    for (idx_t n = 0; n < fs.sizeOwned(); ++n) {
+        if (std::abs(xy(n, YY)) < max_lat) {
+            const double exact = g(xy(n, XX) * deg2rad, xy(n, YY) * deg2rad);
+            for (idx_t jlev = 0; jlev < nlev; ++jlev) {
+                error = std::max(error, std::abs(f(n, jlev) - exact));
+            }
+        }
+    }
+    mpi::comm().allReduceInPlace(error, eckit::mpi::max());
+    return error;
+}
+
+/// @brief Scalar f = cos(lat) cos(lon), with gradient (-sin(lon), -sin(lat) cos(lon)) / R and laplacian -2 f / R^2
+void cosine_bell(const functionspace::StructuredColumns& fs, Field& field) {
+    const auto xy = array::make_view<double, 2>(fs.xy());
+    auto var      = make_scalarview(field);
+    for (idx_t n = 0; n < fs.sizeOwned(); ++n) {
+        const double lon = xy(n, XX) * deg2rad;
+        const double lat = xy(n, YY) * deg2rad;
+        for (idx_t jlev = 0; jlev < var.shape(1); ++jlev) {
+            var(n, jlev) = std::cos(lat) * std::cos(lon);
+        }
+    }
+    fs.haloExchange(field);
+}
+
+/// @brief Solid body rotation with rotation-angle beta and angular velocity pvel, which is non-divergent with
+/// vorticity 2 pvel (sin(lat) cos(beta) - cos(lat) cos(lon) sin(beta))
+void rotated_flow(const functionspace::StructuredColumns& fs, Field& field, double pvel, double beta) {
+    const auto xy = array::make_view<double, 2>(fs.xy());
+    auto var      = make_vectorview(field);
+    for (idx_t n = 0; n < fs.sizeOwned(); ++n) {
+        const double lon = xy(n, XX) * deg2rad;
+        const double lat = xy(n, YY) * deg2rad;
+        const double u =
+            pvel * radius * (std::cos(beta) * std::cos(lat) + std::sin(lat) * std::cos(lon) * std::sin(beta));
+        const double v = -pvel * radius * std::sin(lon) * std::sin(beta);
+        for (idx_t jlev = 0; jlev < var.shape(1); ++jlev) {
+            var(n, jlev, LON) = u;
+            var(n, jlev, LAT) = v;
+        }
+    }
+    fs.haloExchange(field);
+}
+
+double gradient_error(const std::string& gridname, idx_t levels) {
+    functionspace::StructuredColumns fs(Grid(gridname), option::halo(2) | option::levels(levels));
+    fd::Method fd(fs, util::Config("radius", radius));
+    Nabla nabla(fd);
+
+    Field scalar = fs.createField<double>(option::name("scalar"));
+    Field grad   = fs.createField<double>(option::name("grad") | option::variables(2));
+    cosine_bell(fs, scalar);
+    nabla.gradient(scalar, grad);
+    EXPECT(grad.dirty());
+
+    const auto g     = make_vectorview(grad);
+    const idx_t nlev = std::max<idx_t>(1, levels);
+    const double error_lon =
+        max_error(fs, [&](idx_t n, idx_t jlev) { return g(n, jlev, LON); },
+                  [](double lon, double) { return -std::sin(lon) / radius; }, nlev);
+    const double error_lat =
+        max_error(fs, [&](idx_t n, idx_t jlev) { return g(n, jlev, LAT); },
+                  [](double lon, double lat) { return -std::sin(lat) * std::cos(lon) / radius; }, nlev);
+    Log::info() << gridname << " : gradient error * R = " << std::max(error_lon, error_lat) * radius << std::endl;
+    return std::max(error_lon, error_lat);
+}
+
+//-----------------------------------------------------------------------------
+
+CASE("test_factory") {
+    EXPECT(NablaFactory::has("fd"));
+}
+
+CASE("test_gradient_convergence") {
+    for (idx_t levels : {0, 3}) {
+        const double error_F32 = gradient_error("F32", levels);
+        const double error_F64 = gradient_error("F64", levels);
+        EXPECT(error_F32 * radius < 1.e-3);
+        EXPECT(error_F32 / error_F64 > 3.);
+    }
+}
+
+CASE("test_octahedral") {
+    const idx_t nlev = 2;
+    functionspace::StructuredColumns fs(Grid("O32"), option::halo(2) | option::levels(nlev));
+    fd::Method fd(fs, util::Config("radius", radius));
+    Nabla nabla(fd);
+
+    SECTION("gradient") { EXPECT(gradient_error("O32", nlev) * radius < 0.025); }
+
+    // Near the poles, the few points of octahedral rows limit the accuracy of longitudinal derivatives
+    const double max_lat = 80.;
+
+    SECTION("divergence and curl") {
+        const double pvel = 20. / radius;
+        const double beta = 0.7;
+        Field wind        = fs.createField<double>(option::name("wind") | option::variables(2));
+        Field div         = fs.createField<double>(option::name("div"));
+        Field vor         = fs.createField<double>(option::name("vor"));
+        rotated_flow(fs, wind, pvel, beta);
+        nabla.divergence(wind, div);
+        nabla.curl(wind, vor);
+
+        const auto d = make_scalarview(div);
+        const auto c = make_scalarview(vor);
+        const double error_div =
+            max_error(fs, [&](idx_t n, idx_t jlev) { return d(n, jlev); }, [](double, double) { return 0.; }, nlev,
+                      max_lat);
+        const double error_vor = max_error(
+            fs, [&](idx_t n, idx_t jlev) { return c(n, jlev); },
+            [&](double lon, double lat) {
+                return 2. * pvel * (std::sin(lat) * std::cos(beta) - std::cos(lat) * std::cos(lon) * std::sin(beta));
+            },
+            nlev, max_lat);
+        Log::info() << "divergence error / pvel = " << error_div / pvel << std::endl;
+        Log::info() << "curl error / pvel = " << error_vor / pvel << std::endl;
+        EXPECT(error_div / pvel < 0.05);
+        EXPECT(error_vor / pvel < 0.05);
+    }
+
+    // Halo exchange reverses the components of fields of type "vector" across the poles, but not of fields with
+    // 2 variables of type "scalar"; both must give the same derivatives
+    SECTION("wind of type vector") {
+        const double pvel = 20. / radius;
+        const double beta = 0.7;
+        Field wind_scalar = fs.createField<double>(option::name("wind") | option::variables(2));
+        Field wind_vector = fs.createField<double>(option::name("wind") | option::vector());
+        rotated_flow(fs, wind_scalar, pvel, beta);
+        rotated_flow(fs, wind_vector, pvel, beta);
+
+        // Maximum over owned points, levels and tasks of |a(n, jlev) - b(n, jlev)|
+        auto max_difference = [&](const std::function<double(idx_t, idx_t)>& a,
+                                  const std::function<double(idx_t, idx_t)>& b) {
+            double difference = 0.;
+            for (idx_t n = 0; n < fs.sizeOwned(); ++n) {
+                for (idx_t jlev = 0; jlev < nlev; ++jlev) {
+                    difference = std::max(difference, std::abs(a(n, jlev) - b(n, jlev)));
+                }
+            }
+            mpi::comm().allReduceInPlace(difference, eckit::mpi::max());
+            return difference;
+        };
+
+        Field grad_scalar = fs.createField<double>(option::name("grad") | option::variables(4));
+        Field grad_vector = fs.createField<double>(option::name("grad") | option::variables(4));
+        nabla.gradient(wind_scalar, grad_scalar);
+        nabla.gradient(wind_vector, grad_vector);
+        const auto gs = make_vectorview(grad_scalar);
+        const auto gv = make_vectorview(grad_vector);
+        for (idx_t jvar = 0; jvar < 4; ++jvar) {
+            EXPECT(max_difference([&](idx_t n, idx_t jlev) { return gs(n, jlev, jvar); },
+                                  [&](idx_t n, idx_t jlev) { return gv(n, jlev, jvar); }) < 1.e-12 * pvel);
+        }
+
+        Field div_scalar = fs.createField<double>(option::name("div"));
+        Field div_vector = fs.createField<double>(option::name("div"));
+        Field vor_scalar = fs.createField<double>(option::name("vor"));
+        Field vor_vector = fs.createField<double>(option::name("vor"));
+        nabla.divergence(wind_scalar, div_scalar);
+        nabla.divergence(wind_vector, div_vector);
+        nabla.curl(wind_scalar, vor_scalar);
+        nabla.curl(wind_vector, vor_vector);
+        const auto ds = make_scalarview(div_scalar);
+        const auto dv = make_scalarview(div_vector);
+        const auto cs = make_scalarview(vor_scalar);
+        const auto cv = make_scalarview(vor_vector);
+        EXPECT(max_difference([&](idx_t n, idx_t jlev) { return ds(n, jlev); },
+                              [&](idx_t n, idx_t jlev) { return dv(n, jlev); }) < 1.e-12 * pvel);
+        EXPECT(max_difference([&](idx_t n, idx_t jlev) { return cs(n, jlev); },
+                              [&](idx_t n, idx_t jlev) { return cv(n, jlev); }) < 1.e-12 * pvel);
+    }
+
+    SECTION("laplacian") {
+        Field scalar = fs.createField<double>(option::name("scalar"));
+        Field lapl   = fs.createField<double>(option::name("lapl"));
+        cosine_bell(fs, scalar);
+        nabla.laplacian(scalar, lapl);
+
+        const auto l = make_scalarview(lapl);
+        const double error =
+            max_error(fs, [&](idx_t n, idx_t jlev) { return l(n, jlev); },
+                      [](double lon, double lat) { return -2. * std::cos(lat) * std::cos(lon) / (radius * radius); },
+                      nlev, max_lat);
+        Log::info() << "laplacian error * R^2 = " << error * radius * radius << std::endl;
+        EXPECT(error * radius * radius < 0.1);
+    }
+}
+
+CASE("test_requirements") {
+    SECTION("grid with points at the poles") {
+        functionspace::StructuredColumns fs(Grid("L32"), option::halo(2));
+        fd::Method fd(fs);
+        EXPECT_THROWS_AS(Nabla{fd}, eckit::NotImplemented);
+    }
+    SECTION("halo") {
+        functionspace::StructuredColumns fs(Grid("O32"), option::halo(1));
+        EXPECT_THROWS_AS(fd::Method{fs}, eckit::Exception);
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+}  // namespace test
+}  // namespace atlas
+
+int main(int argc, char** argv) {
+    return atlas::test::run(argc, argv);
+}
@@ -8,9 +8,14 @@
  * nor does it submit to any jurisdiction.
  */
 
+#include <algorithm>
 #include <cmath>
+#include <functional>
 #include <iomanip>
 #include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
 
 #include "eckit/config/Resource.h"
 
@@ -414,6 +419,79 @@ CASE("test_lapl") {
     EXPECT_APPROX_EQ(mean, -1.03409e-13);
 }
 
+CASE("test_precision") {
+    Log::info() << "test_precision" << std::endl;
+    Grid grid(griduid());
+    MeshGenerator meshgenerator("structured");
+    Mesh mesh = meshgenerator.generate(grid, Distribution(grid, Partitioner("equal_regions")));
+    fvm::Method fvm(mesh, util::Config("radius", util::Earth::radius()) | option::levels(test_levels()));
+    Nabla nabla(fvm);
+    const auto& fs = fvm.node_columns();
+
+    Field scalar = fs.createField<double>(option::name("scalar"));
+    Field wind   = fs.createField<double>(option::name("wind") | option::variables(2));
+    rotated_flow_magnitude(fvm, scalar, M_PI_2 * 0.75);
+    rotated_flow(fvm, wind, M_PI_2 * 0.75);
+
+    auto value = [](const Field& field, size_t j) -> double {
+        return field.datatype() == array::DataType::kind<float>() ? field.array().host_data<float>()[j]
+                                                                   : field.array().host_data<double>()[j];
+    };
+    auto convert = [&](const Field& field, array::DataType datatype) {
+        Field converted = fs.createField(field, option::datatype(datatype));
+        for (size_t j = 0; j < field.size(); ++j) {
+            if (datatype == array::DataType::kind<float>()) {
+                converted.array().host_data<float>()[j] = value(field, j);
+            }
+            else {
+                converted.array().host_data<double>()[j] = value(field, j);
+            }
+        }
+        return converted;
+    };
+    // Maximum difference relative to the maximum of the reference
+    auto relative_difference = [&](const Field& field, const Field& reference) {
+        EXPECT(field.size() == reference.size());
+        double max_reference = 0.;
+        double max_diff      = 0.;
+        for (size_t j = 0; j < reference.size(); ++j) {
+            max_reference = std::max(max_reference, std::abs(value(reference, j)));
+            max_diff      = std::max(max_diff, std::abs(value(field, j) - value(reference, j)));
+        }
+        return max_diff / max_reference;
+    };
+
+    const auto float_type  = array::make_datatype<float>();
+    const auto double_type = array::make_datatype<double>();
+    const std::vector<std::pair<array::DataType, array::DataType>> precisions{
+        {float_type, float_type}, {float_type, double_type}, {double_type, float_type}};
+
+    auto check = [&](const std::string& name, const Field& input, const Field& output,
+                     const std::function<void(const Field&, Field&)>& op) {
+        Field reference = fs.createField(output);
+        op(input, reference);
+        for (const auto& precision : precisions) {
+            Field in  = convert(input, precision.first);
+            Field out = fs.createField(output, option::datatype(precision.second));
+            op(in, out);
+            const double diff = relative_difference(out, reference);
+            Log::info() << name << " " << precision.first.str() << " -> " << precision.second.str()
+                        << " : relative difference " << diff << std::endl;
+            EXPECT(diff < 1.e-4);
+        }
+    };
+
+    check("gradient", scalar, fs.createField<double>(option::variables(2)),
+          [&](const Field& in, Field& out) { nabla.gradient(in, out); });
+    check("gradient", wind, fs.createField<double>(option::variables(4)),
+          [&](const Field& in, Field& out) { nabla.gradient(in, out); });
+    check("divergence", wind, fs.createField<double>(),
+          [&](const Field& in, Field& out) { nabla.divergence(in, out); });
+    check("curl", wind, fs.createField<double>(), [&](const Field& in, Field& out) { nabla.curl(in, out); });
+    check("laplacian", scalar, fs.createField<double>(),
+          [&](const Field& in, Field& out) { nabla.laplacian(in, out); });
+}
+
 //-----------------------------------------------------------------------------
 
 }  // namespace test
@@ -0,0 +1,103 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+
+#include "atlas/array/MakeView.h"
+#include "atlas/field/Field.h"
+#include "atlas/functionspace/NodeColumns.h"
+#include "atlas/mesh/Mesh.h"
+#include "atlas/mesh/Nodes.h"
+#include "atlas/option.h"
+#include "atlas/output/VTU.h"
+#include "atlas/parallel/mpi/mpi.h"
+
+#include "tests/AtlasTestEnvironment.h"
+#include "tests/TestMeshes.h"
+
+namespace atlas {
+namespace test {
+
+//-----------------------------------------------------------------------------
+
+std::string read_file(const std::string& path) {
+    std::ifstream in(path, std::ios_base::in | std::ios_base::binary);
+    EXPECT(in.is_open());
+    return std::string(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+}
+
+std::string piece_path(const std::string& stem) {
+    return mpi::size() == 1 ? stem + ".vtu" : stem + "_p" + std::to_string(mpi::rank()) + ".vtu";
+}
+
+//-----------------------------------------------------------------------------
+
+CASE("test_vtu_output_mesh") {
+    Mesh mesh = test::generate_mesh(Grid("N16"));
+    output::VTU vtu("test_vtu_output_mesh.vtu");
+    vtu.write(mesh);
+
+    std::string content = read_file(piece_path("test_vtu_output_mesh"));
+    EXPECT(content.find("NumberOfPoints=\"" + std::to_string(mesh.nodes().size()) + "\"") != std::string::npos);
+    EXPECT(content.find("NumberOfCells=\"" + std::to_string(mesh.cells().size()) + "\"") != std::string::npos);
+    EXPECT(content.find("Name=\"connectivity\"") != std::string::npos);
+    EXPECT(content.find("Name=\"vtkGhostType\"") != std::string::npos);
+    if (mpi::size() > 1 && mpi::rank() == 0) {
+        EXPECT(read_file("test_vtu_output_mesh.pvtu").find("<Piece Source=\"test_vtu_output_mesh_p0.vtu\"/>") !=
+               std::string::npos);
+    }
+}
+
+CASE("test_vtu_output_field") {
+    Mesh mesh = test::generate_mesh(Grid("N16"));
+    functionspace::NodeColumns fs(mesh);
+    Field field = fs.createField<double>(option::name("temperature") | option::levels(3));
+    auto view   = array::make_view<double, 2>(field);
+    for (idx_t n = 0; n < view.shape(0); ++n) {
+        for (idx_t k = 0; k < view.shape(1); ++k) {
+            view(n, k) = 1000. * n + k;
+        }
+    }
+
+    output::VTU vtu("test_vtu_output_field.vtu", util::Config("coordinates", "xyz"));
+    vtu.write(mesh);
+    vtu.write(field);
+
+    // Locate the appended data block of the field and compare it against memory
+    std::string content = read_file(piece_path("test_vtu_output_field"));
+
+    std::string declaration = "Name=\"temperature\" NumberOfComponents=\"3\" format=\"appended\" offset=\"";
+    auto declaration_pos    = content.find(declaration);
+    EXPECT(declaration_pos != std::string::npos);
+    size_t offset = std::stoul(content.substr(declaration_pos + declaration.size()));
+
+    std::string appended = "<AppendedData encoding=\"raw\">\n_";
+    auto appended_pos    = content.find(appended);
+    EXPECT(appended_pos != std::string::npos);
+    const char* block = content.data() + appended_pos + appended.size() + offset;
+
+    std::uint64_t bytes;
+    std::memcpy(&bytes, block, sizeof(bytes));
+    EXPECT_EQ(bytes, field.size() * sizeof(double));
+    EXPECT(std::memcmp(block + sizeof(bytes), view.data(), bytes) == 0);
+}
+
+//-----------------------------------------------------------------------------
+
+}  // namespace test
+}  // namespace atlas
+
+int main(int argc, char** argv) {
+    return atlas::test::run(argc, argv);
+}
@@ -9,10 +9,16 @@
  */
 
 #include <algorithm>   // generate, is_sorted
+#include <chrono>      // steady_clock
+#include <cstdint>     // int64_t
 #include <functional>  // bind
+#include <iomanip>     // setw
+#include <limits>      // numeric_limits
 #include <random>      // mt19937 and uniform_int_distribution
 #include <vector>      // vector
 
+#include "atlas/library/config.h"
+#include "atlas/parallel/omp/omp.h"
 #include "atlas/parallel/omp/sort.h"
 #include "atlas/util/vector.h"
 
@@ -34,6 +40,15 @@ atlas::vector<int> create_random_data(int n) {
     return v;
 }
 
+template <typename T>
+std::vector<T> create_random_keys(size_t n, T min, T max) {
+    std::mt19937_64 eng(n);
+    std::uniform_int_distribution<T> dist(min, max);
+    std::vector<T> v(n);
+    std::generate(v.begin(), v.end(), std::bind(dist, eng));
+    return v;
+}
+
 //-----------------------------------------------------------------------------
 
 CASE("test_sort_little") {
@@ -85,6 +100,83 @@ CASE("test_merge_blocks") {
     EXPECT(std::is_sorted(integers.begin(), integers.end()));
 }
 
+CASE("test_radix_sort") {
+    for (size_t n : {size_t(20), size_t(1000000)}) {
+        SECTION("signed 64-bit, n = " + std::to_string(n)) {
+            auto keys = create_random_keys<std::int64_t>(n, -(std::int64_t(1) << 62), std::int64_t(1) << 62);
+            omp::radix_sort(keys.begin(), keys.end());
+            EXPECT(std::is_sorted(keys.begin(), keys.end()));
+        }
+
+        SECTION("unsigned 32-bit via sort, n = " + std::to_string(n)) {
+            auto keys = create_random_keys<unsigned>(n, 0, std::numeric_limits<unsigned>::max());
+            auto ref  = keys;
+            std::sort(ref.begin(), ref.end());
+            omp::sort(keys.begin(), keys.end());
+            EXPECT(keys == ref);
+        }
+
+        SECTION("stable with key, n = " + std::to_string(n)) {
+            struct Element {
+                gidx_t g;
+                idx_t i;
+            };
+            auto keys = create_random_keys<gidx_t>(n, -100, 100);
+            std::vector<Element> elements(n);
+            for (size_t i = 0; i < n; ++i) {
+                elements[i] = Element{keys[i], idx_t(i)};
+            }
+            omp::radix_sort(elements.begin(), elements.end(), [](const Element& e) { return e.g; });
+            EXPECT(std::is_sorted(elements.begin(), elements.end(), [](const Element& a, const Element& b) {
+                return a.g < b.g || (a.g == b.g && a.i < b.i);
+            }));
+        }
+
+        SECTION("argsort and sort_by_key, n = " + std::to_string(n)) {
+            auto keys = create_random_keys<idx_t>(n, -1000, 1000);
+            std::vector<idx_t> indices(n);
+            omp::radix_argsort(keys.begin(), keys.end(), indices.begin());
+            for (size_t i = 1; i < n; ++i) {
+                EXPECT(keys[indices[i - 1]] < keys[indices[i]] ||
+                       (keys[indices[i - 1]] == keys[indices[i]] && indices[i - 1] < indices[i]));
+            }
+            std::vector<double> values(n);
+            for (size_t i = 0; i < n; ++i) {
+                values[i] = 0.5 * keys[i];
+            }
+            omp::radix_sort_by_key(keys.begin(), keys.end(), values.begin());
+            EXPECT(std::is_sorted(keys.begin(), keys.end()));
+            for (size_t i = 0; i < n; ++i) {
+                EXPECT_EQ(values[i], 0.5 * keys[i]);
+            }
+        }
+    }
+}
+
+CASE("test_sort_throughput") {
+    // Compare sorting algorithms on 64-bit keys, as used for unique ids of mesh entities
+    const size_t n = 1 << 23;
+    auto measure   = [&](const std::string& name, std::int64_t max, std::function<void(std::vector<std::int64_t>&)> f) {
+        auto keys  = create_random_keys<std::int64_t>(n, 0, max);
+        auto start = std::chrono::steady_clock::now();
+        f(keys);
+        std::chrono::duration<double> seconds = std::chrono::steady_clock::now() - start;
+        EXPECT(std::is_sorted(keys.begin(), keys.end()));
+        Log::info() << std::setw(40) << std::left << name << ": " << 1.e-6 * n / seconds.count() << " Mkeys/s"
+                    << std::endl;
+    };
+    Log::info() << "Sorting " << n << " keys with " << atlas_omp_get_max_threads() << " threads" << std::endl;
+    for (std::int64_t max : {std::numeric_limits<std::int64_t>::max(), std::int64_t(1) << 32}) {
+        std::string range = (max == std::numeric_limits<std::int64_t>::max() ? " (63-bit)" : " (32-bit)");
+        measure("std::sort" + range, max, [](std::vector<std::int64_t>& v) { std::sort(v.begin(), v.end()); });
+        measure("omp::sort with comparison" + range, max, [](std::vector<std::int64_t>& v) {
+            omp::sort(v.begin(), v.end(), std::less<std::int64_t>());
+        });
+        measure("omp::radix_sort" + range, max,
+                [](std::vector<std::int64_t>& v) { omp::radix_sort(v.begin(), v.end()); });
+    }
+}
+
 //-----------------------------------------------------------------------------
 
 }  // namespace test
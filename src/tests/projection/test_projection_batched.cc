@@ -0,0 +1,153 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#include <string>
+#include <vector>
+
+#include "atlas/grid.h"
+#include "atlas/projection.h"
+#include "atlas/util/Config.h"
+#include "atlas/util/Point.h"
+
+#include "tests/AtlasTestEnvironment.h"
+
+using atlas::util::Config;
+
+namespace atlas {
+namespace test {
+
+//-----------------------------------------------------------------------------
+
+// Points around given centre, which are valid for all tested projections
+std::vector<PointLonLat> lonlat_points(const PointLonLat& centre) {
+    std::vector<PointLonLat> points;
+    for (int j = -10; j <= 10; ++j) {
+        for (int i = -10; i <= 10; ++i) {
+            points.emplace_back(centre.lon() + 2. * i, centre.lat() + 2. * j);
+        }
+    }
+    return points;
+}
+
+void check_batched(const Projection& projection, const PointLonLat& centre) {
+    Log::info() << "projection " << projection.type() << std::endl;
+
+    auto lonlat                = lonlat_points(centre);
+    const idx_t n              = lonlat.size();
+    constexpr double tolerance = 1.e-10;
+
+    // Reference, computed point by point
+    std::vector<PointXY> xy(n);
+    std::vector<PointLonLat> lonlat_ref(n);
+    for (idx_t i = 0; i < n; ++i) {
+        xy[i]         = projection.xy(lonlat[i]);
+        lonlat_ref[i] = projection.lonlat(xy[i]);
+    }
+
+    // separate arrays
+    {
+        std::vector<double> x(n), y(n), lon(n), lat(n);
+        for (idx_t i = 0; i < n; ++i) {
+            x[i] = xy[i].x();
+            y[i] = xy[i].y();
+        }
+        projection.xy2lonlat(n, x.data(), y.data(), lon.data(), lat.data());
+        for (idx_t i = 0; i < n; ++i) {
+            EXPECT_APPROX_EQ(lon[i], lonlat_ref[i].lon(), tolerance);
+            EXPECT_APPROX_EQ(lat[i], lonlat_ref[i].lat(), tolerance);
+        }
+
+        projection.lonlat2xy(n, lon.data(), lat.data(), x.data(), y.data());
+        for (idx_t i = 0; i < n; ++i) {
+            EXPECT_APPROX_EQ(x[i], projection.xy(lonlat_ref[i]).x(), tolerance);
+            EXPECT_APPROX_EQ(y[i], projection.xy(lonlat_ref[i]).y(), tolerance);
+        }
+    }
+
+    // interleaved, in place
+    {
+        std::vector<double> crd(2 * n);
+        for (idx_t i = 0; i < n; ++i) {
+            crd[2 * i]     = xy[i].x();
+            crd[2 * i + 1] = xy[i].y();
+        }
+        projection.xy2lonlat(n, crd.data(), crd.data() + 1, crd.data(), crd.data() + 1, 2);
+        for (idx_t i = 0; i < n; ++i) {
+            EXPECT_APPROX_EQ(crd[2 * i], lonlat_ref[i].lon(), tolerance);
+            EXPECT_APPROX_EQ(crd[2 * i + 1], lonlat_ref[i].lat(), tolerance);
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+CASE("test_batched_lonlat") {
+    check_batched(Projection(), {0., 0.});
+    check_batched(Projection(Config("type", "rotated_lonlat") | Config("north_pole", std::vector<double>{-176., 40.})),
+                  {10., 20.});
+    check_batched(Projection(Config("type", "rotated_lonlat") | Config("rotation_angle", 30.)), {10., 20.});
+}
+
+CASE("test_batched_schmidt") {
+    check_batched(Projection(Config("type", "schmidt") | Config("stretching_factor", 2.4)), {0., 0.});
+    check_batched(Projection("rotated_schmidt", Config("stretching_factor", 2.4) | Config("rotation_angle", 180.0) |
+                                                    Config("north_pole", std::vector<double>{2.0, 46.7})),
+                  {0., 0.});
+}
+
+CASE("test_batched_mercator") {
+    check_batched(Projection(Config("type", "mercator") | Config("longitude0", -10.) | Config("latitude1", 45.)),
+                  {0., 0.});
+    check_batched(
+        Projection(Config("type", "rotated_mercator") | Config("north_pole", std::vector<double>{-176., 40.})),
+        {0., 0.});
+    check_batched(Projection(Config("type", "mercator") | Config("semi_major_axis", 6378137.0) |
+                             Config("semi_minor_axis", 6356752.3142)),
+                  {0., 0.});
+}
+
+CASE("test_batched_lambert") {
+    check_batched(Projection(Config("type", "lambert_conformal_conic") | Config("longitude0", 2.) |
+                             Config("latitude0", 46.2) | Config("latitude1", 46.2) | Config("latitude2", 46.2)),
+                  {2., 46.2});
+    check_batched(Projection(Config("type", "lambert_azimuthal_equal_area") | Config("central_longitude", -10.) |
+                             Config("standard_parallel", 52.)),
+                  {-10., 52.});
+}
+
+CASE("test_batched_cubedsphere") {
+    check_batched(Grid("CS-LFR-12").projection(), {10., 10.});
+    check_batched(Grid("CS-EA-L-12").projection(), {10., 10.});
+}
+
+CASE("test_batched_structured_grid_iterator") {
+    auto projection = Projection("rotated_schmidt", Config("stretching_factor", 2.4) |
+                                                        Config("north_pole", std::vector<double>{2.0, 46.7}));
+    auto nx         = std::vector<int>{20, 24, 28, 32, 36, 40, 44, 48, 48, 44, 40, 36, 32, 28, 24, 20};
+    ReducedGaussianGrid grid(nx, projection);
+
+    // grid.lonlat() iterates through the batched projection, one latitude at a time
+    auto it = grid.lonlat().begin();
+    for (idx_t j = 0; j < grid.ny(); ++j) {
+        for (idx_t i = 0; i < grid.nx(j); ++i, ++it) {
+            EXPECT_APPROX_EQ((*it).lon(), grid.lonlat(i, j).lon(), 1.e-10);
+            EXPECT_APPROX_EQ((*it).lat(), grid.lonlat(i, j).lat(), 1.e-10);
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+}  // namespace test
+}  // namespace atlas
+
+int main(int argc, char** argv) {
+    return atlas::test::run(argc, argv);
+}
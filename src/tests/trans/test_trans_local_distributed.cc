@@ -0,0 +1,187 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "atlas/array/MakeView.h"
+#include "atlas/field/Field.h"
+#include "atlas/functionspace/Spectral.h"
+#include "atlas/grid.h"
+#include "atlas/grid/Distribution.h"
+#include "atlas/grid/Partitioner.h"
+#include "atlas/option.h"
+#include "atlas/parallel/mpi/mpi.h"
+#include "atlas/trans/Trans.h"
+#include "atlas/trans/local/LegendrePolynomials.h"
+#include "atlas/util/Config.h"
+#include "atlas/util/Constants.h"
+
+#include "tests/AtlasTestEnvironment.h"
+
+namespace atlas {
+namespace test {
+
+//-----------------------------------------------------------------------------
+
+namespace {
+
+// Arbitrary spectral coefficient of (m,n), real (imag=0) or imaginary (imag=1) part
+double coefficient(int m, int n, int imag) {
+    return (m == 0 && imag == 1) ? 0. : std::sin(1.3 * m + 0.7 * n + 2.1 * imag + 0.1);
+}
+
+// Loop over the local spectral coefficients: f(real, imag, n, m)
+template <typename Functor>
+void for_each_coefficient(const functionspace::Spectral& spectral, const Functor& f) {
+    const auto zonal_wavenumbers = spectral.zonal_wavenumbers();
+    idx_t jc                     = 0;
+    for (idx_t jm = 0; jm < zonal_wavenumbers.size(); ++jm) {
+        const int m = zonal_wavenumbers(jm);
+        for (int n = m; n <= spectral.truncation(); ++n, jc += 2) {
+            f(jc, jc + 1, n, m);
+        }
+    }
+    EXPECT_EQ(jc, spectral.nb_spectral_coefficients());
+}
+
+}  // namespace
+
+//-----------------------------------------------------------------------------
+
+CASE("test_spectral_distribution_mpi") {
+    const int truncation = 21;
+    functionspace::Spectral spectral(truncation, util::Config("distribution", "mpi"));
+
+    EXPECT(spectral.distribution() == "mpi");
+    idx_t nb_coefficients = spectral.nb_spectral_coefficients();
+    mpi::comm().allReduceInPlace(nb_coefficients, eckit::mpi::sum());
+    EXPECT_EQ(nb_coefficients, spectral.nb_spectral_coefficients_global());
+
+    Field global = spectral.createField<double>(option::global());
+    Field local  = spectral.createField<double>();
+    if (mpi::rank() == 0) {
+        auto glb = array::make_view<double, 1>(global);
+        idx_t jc = 0;
+        for (int m = 0; m <= truncation; ++m) {
+            for (int n = m; n <= truncation; ++n) {
+                glb(jc++) = coefficient(m, n, 0);
+                glb(jc++) = coefficient(m, n, 1);
+            }
+        }
+    }
+
+    SECTION("scatter") {
+        spectral.scatter(global, local);
+        auto loc = array::make_view<double, 1>(local);
+        for_each_coefficient(spectral, [&](idx_t real, idx_t imag, int n, int m) {
+            EXPECT_EQ(loc(real), coefficient(m, n, 0));
+            EXPECT_EQ(loc(imag), coefficient(m, n, 1));
+        });
+    }
+
+    SECTION("gather") {
+        spectral.scatter(global, local);
+        Field gathered = spectral.createField<double>(option::global());
+        spectral.gather(local, gathered);
+        if (mpi::rank() == 0) {
+            auto glb = array::make_view<double, 1>(global);
+            auto gth = array::make_view<double, 1>(gathered);
+            for (idx_t jc = 0; jc < spectral.nb_spectral_coefficients_global(); ++jc) {
+                EXPECT_EQ(gth(jc), glb(jc));
+            }
+        }
+    }
+
+    SECTION("norm") {
+        auto loc = array::make_view<double, 1>(local);
+        loc.assign(0.);
+        for_each_coefficient(spectral, [&](idx_t real, idx_t imag, int n, int m) {
+            if (m == 1 && n == 2) {
+                loc(real) = 3.;
+                loc(imag) = 4.;
+            }
+        });
+        double norm;
+        spectral.norm(local, norm);
+        // zonal wavenumbers m > 0 count twice, for m and -m
+        EXPECT_APPROX_EQ(norm, std::sqrt(2. * 25.), 1.e-14);
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+CASE("test_invtrans_local_distributed") {
+    const int truncation = 20;
+    const int nb_fields  = 2;
+    StructuredGrid grid("F24");
+    trans::Trans trans(grid, truncation, option::type("local"));
+    const auto& spectral = trans.spectral();
+    EXPECT(spectral.distribution() == (mpi::size() > 1 ? "mpi" : "serial"));
+
+    // Spectral coefficients [coefficient][field], with field f scaled by (f+1)
+    std::vector<double> spectra(spectral.nb_spectral_coefficients() * nb_fields);
+    for_each_coefficient(spectral, [&](idx_t real, idx_t imag, int n, int m) {
+        for (int jfld = 0; jfld < nb_fields; ++jfld) {
+            spectra[real * nb_fields + jfld] = (jfld + 1) * coefficient(m, n, 0);
+            spectra[imag * nb_fields + jfld] = (jfld + 1) * coefficient(m, n, 1);
+        }
+    });
+
+    grid::Distribution distribution(grid, grid::Partitioner("equal_bands"));
+    const idx_t nb_gridpoints = distribution.nb_pts()[mpi::rank()];
+    std::vector<double> gp(nb_gridpoints * nb_fields);
+    trans.invtrans(nb_fields, spectra.data(), gp.data());
+
+    // Evaluate the spherical harmonics expansion at the grid points of this task
+    std::vector<double> legpol((truncation + 2) * (truncation + 1) / 2);
+    std::vector<double> zfn((truncation + 1) * (truncation + 1));
+    trans::compute_zfn(truncation, zfn.data());
+    auto idxmn = [truncation](int m, int n) { return (2 * truncation + 3 - m) * m / 2 + n - m; };
+
+    const double deg2rad = util::Constants::degreesToRadians();
+    double maxerr        = 0.;
+    gidx_t jglb          = 0;
+    idx_t jloc           = 0;
+    for (idx_t j = 0; j < grid.ny(); ++j) {
+        trans::compute_legendre_polynomials_lat(truncation, grid.y(j) * deg2rad, legpol.data(), zfn.data());
+        for (idx_t i = 0; i < grid.nx(j); ++i, ++jglb) {
+            if (distribution.partition(jglb) != mpi::rank()) {
+                continue;
+            }
+            const double lon = grid.x(i, j) * deg2rad;
+            double expected  = 0.;
+            for (int m = 0; m <= truncation; ++m) {
+                const double factor = (m == 0 ? 1. : 2.);
+                for (int n = m; n <= truncation; ++n) {
+                    expected += factor * legpol[idxmn(m, n)] *
+                                (coefficient(m, n, 0) * std::cos(m * lon) - coefficient(m, n, 1) * std::sin(m * lon));
+                }
+            }
+            for (int jfld = 0; jfld < nb_fields; ++jfld) {
+                maxerr = std::max(maxerr, std::abs(gp[jfld * nb_gridpoints + jloc] - (jfld + 1) * expected));
+            }
+            ++jloc;
+        }
+    }
+    EXPECT_EQ(jloc, nb_gridpoints);
+    Log::info() << "maximum error: " << maxerr << std::endl;
+    EXPECT(maxerr < 1.e-10);
+}
+
+//-----------------------------------------------------------------------------
+
+}  // namespace test
+}  // namespace atlas
+
+int main(int argc, char** argv) {
+    return atlas::test::run(argc, argv);
+}
@@ -9,7 +9,9 @@
  */
 
 #include <algorithm>
+#include <chrono>
 #include <cmath>
+#include <functional>
 #include <iomanip>
 #include <numeric>
 
@@ -29,8 +31,11 @@
 #include "atlas/output/Gmsh.h"
 #include "atlas/parallel/mpi/mpi.h"
 #include "atlas/runtime/Trace.h"
+#include "atlas/trans/LegendreCacheCreator.h"
 #include "atlas/trans/Trans.h"
 #include "atlas/trans/ifs/TransIFS.h"
+#include "atlas/trans/local/ButterflyMatrix.h"
+#include "atlas/trans/local/LegendrePolynomials.h"
 #include "atlas/trans/local/TransLocal.h"
 #include "atlas/util/Constants.h"
 #include "atlas/util/Earth.h"
@@ -1486,6 +1491,325 @@ CASE("test_trans_unstructured") {
 #endif
 
 //-----------------------------------------------------------------------------
+#if 1
+CASE("test_trans_local_fieldset_batched") {
+    Log::info() << "test_trans_local_fieldset_batched" << std::endl;
+    // test that transforming a FieldSet with fields of different numbers of levels all at once
+    // gives the same result as transforming every field and level separately
+
+    int trc          = 15;
+    const idx_t nlev = 3;
+    functionspace::Spectral specFS(trc);
+    const idx_t nb_coeffs = specFS.nb_spectral_coefficients();
+
+    for (std::string gridname : {"F16", "O16"}) {
+        Log::info() << "grid: " << gridname << std::endl;
+        Grid g(gridname);
+        trans::Trans trans(g, trc, option::type("local"));
+
+        FieldSet spfields;
+        spfields.add(specFS.createField<double>(option::name("sp3d") | option::levels(nlev)));
+        spfields.add(specFS.createField<double>(option::name("sp2d")));
+        FieldSet gpfields;
+        gpfields.add(Field("gp3d", array::make_datatype<double>(), array::make_shape(g.size(), nlev)));
+        gpfields.add(Field("gp2d", array::make_datatype<double>(), array::make_shape(g.size())));
+
+        auto sp3d = make_view<double, 2>(spfields[0]);
+        auto sp2d = make_view<double, 1>(spfields[1]);
+        for (idx_t jc = 0; jc < nb_coeffs; ++jc) {
+            for (idx_t jlev = 0; jlev < nlev; ++jlev) {
+                sp3d(jc, jlev) = std::sin(0.1 * jc + jlev);
+            }
+            sp2d(jc) = std::cos(0.3 * jc);
+        }
+
+        EXPECT_NO_THROW(trans.invtrans(spfields, gpfields));
+
+        auto check = [&](const std::vector<double>& sp, std::function<double(idx_t)> gp_batched) {
+            std::vector<double> gp(g.size());
+            trans.invtrans(1, sp.data(), gp.data());
+            double maxdiff = 0.;
+            for (idx_t jgp = 0; jgp < g.size(); ++jgp) {
+                maxdiff = std::max(maxdiff, std::abs(gp[jgp] - gp_batched(jgp)));
+            }
+            Log::info() << "max difference: " << maxdiff << std::endl;
+            EXPECT(maxdiff < 1.e-12);
+        };
+
+        auto gp3d = make_view<double, 2>(gpfields[0]);
+        auto gp2d = make_view<double, 1>(gpfields[1]);
+        std::vector<double> sp(nb_coeffs);
+        for (idx_t jlev = 0; jlev < nlev; ++jlev) {
+            for (idx_t jc = 0; jc < nb_coeffs; ++jc) {
+                sp[jc] = sp3d(jc, jlev);
+            }
+            check(sp, [&](idx_t jgp) { return gp3d(jgp, jlev); });
+        }
+        for (idx_t jc = 0; jc < nb_coeffs; ++jc) {
+            sp[jc] = sp2d(jc);
+        }
+        check(sp, [&](idx_t jgp) { return gp2d(jgp); });
+    }
+}
+#endif
+
+//-----------------------------------------------------------------------------
+// Wall-clock time in seconds of a call
+double timed(const std::function<void()>& f) {
+    auto start = std::chrono::system_clock::now();
+    f();
+    std::chrono::duration<double> elapsed_seconds = std::chrono::system_clock::now() - start;
+    return elapsed_seconds.count();
+}
+
+// Maximum absolute error relative to the maximum absolute value of the reference, for nb_fields fields stored one
+// after another; the largest of the relative errors of the fields is returned
+double relative_error(const std::vector<double>& values, const std::vector<double>& reference, size_t nb_fields = 1) {
+    ATLAS_ASSERT(values.size() == reference.size());
+    const size_t size = reference.size() / nb_fields;
+    double error      = 0.;
+    for (size_t jfld = 0; jfld < nb_fields; ++jfld) {
+        double max_error = 0.;
+        double max_value = 0.;
+        for (size_t j = jfld * size; j < (jfld + 1) * size; ++j) {
+            max_error = std::max(max_error, std::abs(values[j] - reference[j]));
+            max_value = std::max(max_value, std::abs(reference[j]));
+        }
+        error = std::max(error, max_error / max_value);
+    }
+    return error;
+}
+
+// Symmetric part of the Legendre coefficients of zonal wavenumber m at latitudes in degrees, ordered as in TransLocal:
+// total wavenumbers n = trc, trc - 2, ... >= m with n - m even, stored column-major as [latitude][n]
+std::vector<double> legendre_symmetric(int trc, int m, const std::vector<double>& lats) {
+    const size_t rows = size_t(trc - m) / 2 + 1;
+    std::vector<double> legendre(rows * lats.size());
+    std::vector<double> legpol((trc + 2) * (trc + 1) / 2);
+    std::vector<double> zfn((trc + 1) * (trc + 1));
+    trans::compute_zfn(trc, zfn.data());
+    auto idxmn = [&](int jm, int jn) { return (2 * trc + 3 - jm) * jm / 2 + jn - jm; };
+    for (size_t jlat = 0; jlat < lats.size(); ++jlat) {
+        trans::compute_legendre_polynomials_lat(trc, lats[jlat] * util::Constants::degreesToRadians(), legpol.data(),
+                                                zfn.data());
+        for (int jn = trc - (trc - m) % 2, jr = 0; jn >= m; jn -= 2, ++jr) {
+            legendre[jr + rows * jlat] = legpol[idxmn(m, jn)];
+        }
+    }
+    return legendre;
+}
+
+// Dense product C = A * B, with A (nvec x rows) and C (nvec x (col_end - col_begin)), B (rows x cols) column-major
+std::vector<double> dense_product(const std::vector<double>& A, size_t nvec, const std::vector<double>& B, size_t rows,
+                                  size_t col_begin, size_t col_end) {
+    std::vector<double> C(nvec * (col_end - col_begin), 0.);
+    for (size_t c = col_begin; c < col_end; ++c) {
+        for (size_t r = 0; r < rows; ++r) {
+            for (size_t v = 0; v < nvec; ++v) {
+                C[v + nvec * (c - col_begin)] += A[v + nvec * r] * B[r + rows * c];
+            }
+        }
+    }
+    return C;
+}
+
+//-----------------------------------------------------------------------------
+#if 1
+CASE("test_trans_local_flt") {
+    Log::info() << "test_trans_local_flt" << std::endl;
+    // compare the fast Legendre transform (butterfly compressed Legendre coefficients)
+    // with the dense Legendre transform, for accuracy and performance
+
+    int trc = 191;
+    StructuredGrid g("O96");
+    functionspace::Spectral spectral(trc);
+    std::vector<double> sp(spectral.nb_spectral_coefficients());
+    for (size_t jc = 0; jc < sp.size(); ++jc) {
+        sp[jc] = std::sin(0.1 * jc);
+    }
+
+    auto invtrans = [&](const trans::Trans& trans, std::vector<double>& gp) {
+        gp.resize(g.size());
+        return timed([&] { trans.invtrans(1, sp.data(), gp.data()); });
+    };
+
+    std::vector<double> gp_dense;
+    trans::Trans trans_dense(g, trc, option::type("local"));
+    double seconds_dense = invtrans(trans_dense, gp_dense);
+    Log::info() << "dense: " << seconds_dense << " s" << std::endl;
+
+    // the errors of the compressed matrices partly cancel in the Fourier synthesis: at this truncation the
+    // relative error of the transform is a few percent of the threshold
+    std::vector<double> gp_flt;
+    for (double threshold : {1.e-6, 1.e-10}) {
+        trans::Trans trans_flt(g, trc, option::type("local") | option::flt(true) | option::flt_threshold(threshold));
+        double seconds = invtrans(trans_flt, gp_flt);
+        double error   = relative_error(gp_flt, gp_dense);
+        Log::info() << "flt (threshold " << threshold << "): " << seconds << " s, relative error " << error
+                    << std::endl;
+        EXPECT(error < threshold);
+    }
+
+    // compressed coefficients in a Legendre cache give the same result
+    auto config = option::type("local") | option::flt(true) | option::flt_threshold(1.e-10);
+    trans::Cache cache = trans::LegendreCacheCreator(g, trc, config).create();
+    std::vector<double> gp_cache;
+    trans::Trans trans_cache(cache, g, trc, config);
+    invtrans(trans_cache, gp_cache);
+    EXPECT(gp_cache == gp_flt);
+
+    // ranges of latitudes, as used for cropped grids, with a number of latitudes that is not divisible by the
+    // number of column blocks of the butterfly
+    std::vector<double> lats;
+    for (idx_t jlat = 0; jlat < g.ny() / 2 - 1; ++jlat) {
+        lats.emplace_back(g.y(jlat));
+    }
+    const size_t cols = lats.size();
+    const size_t rows = size_t(trc) / 2 + 1;
+    const size_t nvec = 2;
+    std::vector<double> legendre = legendre_symmetric(trc, 0, lats);
+    std::vector<double> sp0(nvec * rows);
+    for (size_t j = 0; j < sp0.size(); ++j) {
+        sp0[j] = std::sin(0.1 * j);
+    }
+    const double threshold = 1.e-10;
+    trans::ButterflyMatrix butterfly(legendre.data(), rows, cols, threshold);
+    EXPECT(cols % 2 == 1 && butterfly.levels() >= 1);
+    std::vector<double> fourier_dense = dense_product(sp0, nvec, legendre, rows, 0, cols);
+    double max_value = 0.;
+    for (double value : fourier_dense) {
+        max_value = std::max(max_value, std::abs(value));
+    }
+    double max_error = 0.;
+    for (size_t col_begin = 0; col_begin < cols; ++col_begin) {
+        for (size_t col_end = col_begin + 1; col_end <= cols; ++col_end) {
+            std::vector<double> fourier(nvec * (col_end - col_begin));
+            butterfly.multiply(sp0.data(), nvec, fourier.data(), col_begin, col_end);
+            std::vector<double> fourier_ref = dense_product(sp0, nvec, legendre, rows, col_begin, col_end);
+            for (size_t j = 0; j < fourier.size(); ++j) {
+                max_error = std::max(max_error, std::abs(fourier[j] - fourier_ref[j]));
+            }
+        }
+    }
+    Log::info() << "flt on ranges of " << cols << " latitudes: levels " << butterfly.levels() << ", relative error "
+                << max_error / max_value << std::endl;
+    EXPECT(max_error / max_value < threshold);
+}
+#endif
+
+//-----------------------------------------------------------------------------
+#if 1
+CASE("test_trans_local_flt_butterfly_levels") {
+    Log::info() << "test_trans_local_flt_butterfly_levels" << std::endl;
+    // At T191 the Legendre matrices are compressed with at most one butterfly level. Compare the butterfly with
+    // the dense Legendre transform at a truncation with several levels, for the symmetric Legendre coefficients
+    // of single zonal wavenumbers, ordered as in TransLocal
+
+    int trc = 639;
+    StructuredGrid g("N320");
+    const size_t nlats = size_t(g.ny()) / 2;
+
+    std::vector<double> lats;
+    for (size_t jlat = 0; jlat < nlats; ++jlat) {
+        lats.emplace_back(g.y(jlat));
+    }
+    const std::vector<int> zonal_wavenumbers{0, 100};
+    std::vector<size_t> rows;
+    std::vector<std::vector<double>> legendre;
+    for (int m : zonal_wavenumbers) {
+        rows.emplace_back(size_t(trc - m) / 2 + 1);
+        legendre.emplace_back(legendre_symmetric(trc, m, lats));
+    }
+
+    // real and imaginary parts of the spectral coefficients
+    const size_t nvec = 2;
+    for (size_t jm = 0; jm < zonal_wavenumbers.size(); ++jm) {
+        std::vector<double> sp(nvec * rows[jm]);
+        for (size_t j = 0; j < sp.size(); ++j) {
+            sp[j] = std::sin(0.1 * j);
+        }
+        std::vector<double> fourier_dense;
+        double seconds_dense =
+            timed([&] { fourier_dense = dense_product(sp, nvec, legendre[jm], rows[jm], 0, nlats); });
+
+        for (double threshold : {1.e-6, 1.e-10}) {
+            trans::ButterflyMatrix butterfly(legendre[jm].data(), rows[jm], nlats, threshold);
+            std::vector<double> fourier(nvec * nlats);
+            double seconds = timed([&] { butterfly.multiply(sp.data(), nvec, fourier.data()); });
+            double error   = relative_error(fourier, fourier_dense);
+            Log::info() << "m = " << zonal_wavenumbers[jm] << " (threshold " << threshold << "): levels "
+                        << butterfly.levels() << ", footprint " << butterfly.footprint() << " of " << rows[jm] * nlats
+                        << ", " << seconds << " s (dense " << seconds_dense << " s), relative error " << error
+                        << std::endl;
+            EXPECT(butterfly.levels() >= 3);
+            EXPECT(butterfly.footprint() < rows[jm] * nlats);
+            EXPECT(error < threshold);
+        }
+    }
+}
+#endif
+
+//-----------------------------------------------------------------------------
+#if 1
+CASE("test_trans_local_unstructured_auxiliary_grid") {
+    Log::info() << "test_trans_local_unstructured_auxiliary_grid" << std::endl;
+    // compare the synthesis to unstructured points via an auxiliary grid with the direct synthesis,
+    // for scalar and wind fields, with points close to the poles
+
+    int trc = 63;
+    std::vector<PointXY> pts;
+    for (int j = 0; j < 2000; ++j) {
+        double lon = 720. * std::abs(std::sin(12.9898 * j)) - 180.;
+        double lat = std::asin(2. * std::abs(std::sin(78.233 * j)) - 1.) * util::Constants::radiansToDegrees();
+        pts.emplace_back(lon, lat);
+    }
+    pts.emplace_back(30., 89.99);
+    pts.emplace_back(210., -89.99);
+    Grid gu = UnstructuredGrid(new std::vector<PointXY>(pts));
+
+    int nb_scalar = 1, nb_vordiv = 1;
+    int N = (trc + 2) * (trc + 1) / 2, nb_all = nb_scalar + 2 * nb_vordiv;
+    std::vector<double> sp(2 * N * nb_scalar);
+    std::vector<double> vor(2 * N * nb_vordiv);
+    std::vector<double> div(2 * N * nb_vordiv);
+    for (int j = 0; j < 2 * N; ++j) {
+        sp[j]  = std::sin(0.1 * j);
+        vor[j] = std::cos(0.3 * j);
+        div[j] = std::sin(0.7 * j + 1.);
+    }
+    for (int j = 0; j <= trc; ++j) {  // m=0 coefficients are real
+        sp[2 * j + 1]  = 0.;
+        vor[2 * j + 1] = 0.;
+        div[2 * j + 1] = 0.;
+    }
+    vor[0] = 0.;
+    div[0] = 0.;
+
+    // fields are stored as [wind components..., scalars...]
+    auto invtrans = [&](const trans::Trans& trans, std::vector<double>& gp) {
+        gp.resize(nb_all * gu.size());
+        return timed([&] { trans.invtrans(nb_scalar, sp.data(), nb_vordiv, vor.data(), div.data(), gp.data()); });
+    };
+
+    std::vector<double> gp_direct;
+    trans::Trans trans_direct(gu, trc, option::type("local") | util::Config("precompute", false));
+    double seconds_direct = invtrans(trans_direct, gp_direct);
+    Log::info() << "direct: " << seconds_direct << " s" << std::endl;
+
+    // the relative error of every field stays within about the tolerance
+    std::vector<double> gp_auxiliary;
+    for (double tolerance : {1.e-6, 1.e-10}) {
+        trans::Trans trans_auxiliary(gu, trc, option::type("local") | option::auxiliary_grid(true) |
+                                                  option::auxiliary_grid_tolerance(tolerance));
+        double seconds = invtrans(trans_auxiliary, gp_auxiliary);
+        double error   = relative_error(gp_auxiliary, gp_direct, nb_all);
+        Log::info() << "auxiliary grid (tolerance " << tolerance << "): " << seconds << " s, relative error "
+                    << error << std::endl;
+        EXPECT(error < 2. * tolerance);
+    }
+}
+#endif
+
 #if ATLAS_HAVE_TRANS
 CASE("test_trans_levels") {
     Log::info() << "test_trans_levels" << std::endl;
@@ -12,9 +12,11 @@
 #include <cmath>
 #include <limits>
 #include <numeric>
+#include <string>
 #include <vector>
 
 #include "atlas/grid.h"
+#include "atlas/util/Config.h"
 #include "atlas/util/KDTree.h"
 
 #include "tests/AtlasTestEnvironment.h"
@@ -312,6 +314,77 @@ CASE("test IndexKDTree 2D vs 3D") {
     // Note that the expected values are different whether 2D search or 3D search is used
 }
 
+CASE("test flat kdtree") {
+    auto check = [](bool single_precision) {
+        auto grid = Grid{"O32"};
+        IndexKDTree search(util::Config("type", "flat")("single_precision", single_precision), geometry());
+        search.reserve(grid.size());
+        idx_t n{0};
+        for (auto& point : grid.lonlat()) {
+            search.insert(point, n++);
+            EXPECT(search.empty());
+        }
+        // Not built yet --> assertion thrown when trying to access
+        EXPECT_THROWS_AS(search.closestPoint(PointLonLat{180., 45.}), eckit::AssertionFailed);
+        search.build();
+        EXPECT_EQ(search.size(), grid.size());
+
+        EXPECT_EQ(search.closestPoint(PointLonLat{180., 45.}).payload(), 760);
+        auto neighbours = search.closestPoints(PointLonLat{180., 45.}, 4).payloads();
+        EXPECT_EQ(neighbours, (std::vector<idx_t>{760, 842, 759, 761}));
+
+        double km     = 1000. * radius() / util::Earth::radius();
+        auto within   = search.closestPointsWithinRadius(PointLonLat{180., 45.}, 500 * km).payloads();
+        auto expected = std::vector<idx_t>{760, 842, 759, 761, 841, 843, 682};
+        EXPECT_EQ(within, expected);
+    };
+    SECTION("double precision") { check(false); }
+    SECTION("single precision") { check(true); }
+    SECTION("small trees") {
+        IndexKDTree search(util::Config("type", "flat"), geometry());
+        search.build(test_lonlat(), test_payloads());
+        validate(search);
+    }
+}
+
+CASE("test batched search") {
+    std::vector<PointLonLat> points;
+    for (double lat = -90.; lat <= 90.; lat += 7.5) {
+        for (double lon = 0.; lon < 360.; lon += 11.) {
+            points.emplace_back(lon, lat);
+        }
+    }
+    auto grid      = Grid{"O32"};
+    const size_t k = 5;
+
+    auto check = [&](const std::string& type) {
+        IndexKDTree search(util::Config("type", type), geometry());
+        search.build(grid.lonlat(), PayloadGenerator(grid.size()));
+
+        IndexKDTree::PayloadList payloads;
+        std::vector<double> distances;
+        search.closestPoints(points, k, payloads, distances);
+        EXPECT_EQ(payloads.size(), points.size() * k);
+        EXPECT_EQ(distances.size(), points.size() * k);
+
+        std::vector<IndexKDTree::ValueList> within;
+        double km = 1000. * radius() / util::Earth::radius();
+        search.closestPointsWithinRadius(points, 300 * km, within);
+        EXPECT_EQ(within.size(), points.size());
+
+        for (size_t i = 0; i < points.size(); ++i) {
+            auto neighbours = search.closestPoints(points[i], k);
+            for (size_t j = 0; j < k; ++j) {
+                EXPECT_EQ(payloads[i * k + j], neighbours[j].payload());
+                EXPECT_APPROX_EQ(distances[i * k + j], neighbours[j].distance(), 1.e-6);
+            }
+            EXPECT_EQ(within[i].payloads(), search.closestPointsWithinRadius(points[i], 300 * km).payloads());
+        }
+    };
+    SECTION("eckit") { check("eckit"); }
+    SECTION("flat") { check("flat"); }
+}
+
 //------------------------------------------------------------------------------------------------
 
 }  // namespace test
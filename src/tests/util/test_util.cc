@@ -8,7 +8,14 @@
  * nor does it submit to any jurisdiction.
  */
 
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "atlas/parallel/omp/omp.h"
+#include "atlas/util/ContentHash.h"
 #include "atlas/util/MicroDeg.h"
+#include "atlas/util/SpaceFillingCurve.h"
 
 #include "tests/AtlasTestEnvironment.h"
 
@@ -36,6 +43,66 @@ CASE("convert to microdegrees") {
 
 //-----------------------------------------------------------------------------
 
+CASE("xxhash64 reference values") {
+    const char* text = "Nobody inspects the spammish repetition";
+    EXPECT_EQ(xxhash64("", 0), 0xEF46DB3751D8E999ULL);
+    EXPECT_EQ(xxhash64("abc", 3), 0x44BC2CF5AD770999ULL);
+    EXPECT_EQ(xxhash64(text, std::strlen(text)), 0xFBCEA83C8A378BF1ULL);
+    EXPECT_EQ(content_hash(text, std::strlen(text)), xxhash64(text, std::strlen(text)));
+}
+
+CASE("content_hash independent of number of threads") {
+    std::vector<double> values(3 * content_hash_block_size / sizeof(double) + 7);
+    for (size_t i = 0; i < values.size(); ++i) {
+        values[i] = 0.37 * i;
+    }
+    const size_t bytes = values.size() * sizeof(double);
+
+    const int max_threads = atlas_omp_get_max_threads();
+    atlas_omp_set_num_threads(1);
+    const auto serial = content_hash(values.data(), bytes);
+    atlas_omp_set_num_threads(max_threads);
+    EXPECT_EQ(content_hash(values.data(), bytes), serial);
+
+    values.back() += 1.;
+    EXPECT(content_hash(values.data(), bytes) != serial);
+}
+
+//-----------------------------------------------------------------------------
+
+CASE("space filling curve keys") {
+    EXPECT_EQ(morton_key(0, 0), 0u);
+    EXPECT_EQ(morton_key(1, 0), 1u);
+    EXPECT_EQ(morton_key(0, 1), 2u);
+    EXPECT_EQ(morton_key(3, 5), 0b100111u);
+
+    // The Hilbert curve visits all cells of the lower-left 2^k x 2^k block first, moving to an adjacent cell each step
+    const int n = 16;
+    std::vector<int> x(n * n, -1), y(n * n, -1);
+    for (int i = 0; i < n; ++i) {
+        for (int j = 0; j < n; ++j) {
+            const auto key = hilbert_key(i, j);
+            EXPECT(key < static_cast<unsigned>(n * n));
+            EXPECT_EQ(x[key], -1);
+            x[key] = i;
+            y[key] = j;
+        }
+    }
+    for (int k = 1; k < n * n; ++k) {
+        EXPECT_EQ(std::abs(x[k] - x[k - 1]) + std::abs(y[k] - y[k - 1]), 1);
+    }
+}
+
+CASE("space filling curve order") {
+    std::vector<PointXY> points{{1., 1.}, {0., 0.}, {1., 0.}, {0., 1.}, {0., 0.}};
+    EXPECT(space_filling_curve_order("morton", points) == (std::vector<idx_t>{1, 4, 2, 3, 0}));
+    EXPECT(space_filling_curve_order("hilbert", points) == (std::vector<idx_t>{1, 4, 3, 0, 2}));
+    EXPECT_THROWS_AS(space_filling_curve_order("peano", points), eckit::Exception);
+    EXPECT(not space_filling_curve_ordering("none"));
+}
+
+//-----------------------------------------------------------------------------
+
 }  // namespace test
 }  // namespace atlas
 